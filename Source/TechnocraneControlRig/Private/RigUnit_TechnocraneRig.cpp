@@ -0,0 +1,144 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// RigUnit_TechnocraneRig.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "RigUnit_TechnocraneRig.h"
+#include "TechnocraneRigKinematics.h"
+#include "TechnocranePresetRegistry.h"
+#include "TechnocraneStats.h"
+#include "Units/RigUnitContext.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(RigUnit_TechnocraneRig)
+
+DECLARE_CYCLE_STAT(TEXT("Technocrane Rig Unit"), STAT_TechnocraneRigUnit, STATGROUP_Technocrane);
+
+FRigUnit_TechnocraneRig_Execute()
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_RIGUNIT()
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneRigUnit);
+
+	URigHierarchy* Hierarchy = ExecuteContext.Hierarchy;
+	if (!Hierarchy)
+	{
+		return;
+	}
+
+	// presets are compiled on the game thread by the module after the engine init, this is a fallback for an editor preview
+	FTechnocranePresetRegistry& Registry = FTechnocranePresetRegistry::Get();
+	if (!Registry.IsInitialized() && IsInGameThread())
+	{
+		Registry.Initialize();
+	}
+
+	FRigUnit_TechnocraneRig_WorkData& Data = WorkData;
+
+	if (Data.CachedTopologyVersion != Hierarchy->GetTopologyVersion() || Data.CachedCraneModel != CraneModel)
+	{
+		Data.Geometry.Reset();
+		Data.CachedTopologyVersion = Hierarchy->GetTopologyVersion();
+		Data.CachedCraneModel = CraneModel;
+		Data.bReportedFailure = false;
+	}
+
+	if (!Data.Geometry.IsValid())
+	{
+		// the geometry is built again on every execute until it succeeds, a failure is reported once
+		const FCranePresetEntryPtr Preset = Registry.Find(CraneModel);
+		if (!Preset)
+		{
+			if (!Data.bReportedFailure)
+			{
+				UE_CONTROLRIG_RIGUNIT_REPORT_WARNING(TEXT("Crane preset %d is not available."), static_cast<int32>(CraneModel));
+				Data.bReportedFailure = true;
+			}
+			return;
+		}
+
+		TSharedPtr<FCraneRigGeometry> Geometry = MakeShared<FCraneRigGeometry>();
+		if (!BuildGeometry(Hierarchy, Preset->Data.ColumnRotationBone, *Geometry, Data.JointElements))
+		{
+			if (!Data.bReportedFailure)
+			{
+				UE_CONTROLRIG_RIGUNIT_REPORT_WARNING(TEXT("Crane joints are missing in the hierarchy."));
+				Data.bReportedFailure = true;
+			}
+			return;
+		}
+
+		Data.Geometry = MoveTemp(Geometry);
+		Data.Preset = Preset->Preset;
+	}
+
+	// the camera is already in the rig space, the same input as the anim node builds for the camera actor
+	FCraneRigSolverInput Input;
+	FTechnocraneRigKinematics::MakeCameraInput(Camera, Camera, CameraPivotOffset, FTransform::Identity, Input);
+	Input.TrackPosition = TrackPosition;
+
+	FCraneRigSolution Solution;
+	SolveHierarchy(Hierarchy, *Data.Geometry, Data.Preset, Data.JointElements, Input, Solution);
+
+	GroundHeight = Solution.GroundHeight;
+	TiltAngle = Solution.TiltAngle;
+	ExtensionLength = Solution.ExtensionLength;
+}
+
+bool FRigUnit_TechnocraneRig::BuildGeometry(const URigHierarchy* Hierarchy, const FName& ColumnRotationBone, FCraneRigGeometry& OutGeometry, TArray<int32>& OutJointElements)
+{
+	const TArray<FRigElementKey> BoneKeys = Hierarchy->GetAllKeys(false, ERigElementType::Bone);
+	const int32 NumBones = BoneKeys.Num();
+
+	TArray<FName> BoneNames;
+	TArray<FTransform> RefPose;
+	TArray<int32> ParentIndices;
+	BoneNames.SetNumUninitialized(NumBones);
+	RefPose.SetNumUninitialized(NumBones);
+	ParentIndices.SetNumUninitialized(NumBones);
+
+	for (int32 i = 0; i < NumBones; ++i)
+	{
+		BoneNames[i] = BoneKeys[i].Name;
+		RefPose[i] = Hierarchy->GetInitialLocalTransform(BoneKeys[i]);
+		// a bone parented to a null or a control is a root bone for the crane
+		ParentIndices[i] = BoneKeys.IndexOfByKey(Hierarchy->GetFirstParent(BoneKeys[i]));
+	}
+
+	if (!FTechnocraneRigKinematics::BuildGeometry(OutGeometry, BoneNames, RefPose, ParentIndices, ColumnRotationBone))
+	{
+		return false;
+	}
+
+	OutJointElements.Init(INDEX_NONE, FCraneRigGeometry::JointCount);
+
+	for (int32 Joint = 0; Joint < FCraneRigGeometry::JointCount; ++Joint)
+	{
+		if (OutGeometry.HasJoint(Joint))
+		{
+			OutJointElements[Joint] = Hierarchy->GetIndex(BoneKeys[OutGeometry.RefBoneIndex[Joint]]);
+		}
+	}
+	return true;
+}
+
+void FRigUnit_TechnocraneRig::SolveHierarchy(URigHierarchy* Hierarchy, const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, TArrayView<const int32> JointElements,
+	const FCraneRigSolverInput& Input, FCraneRigSolution& OutSolution)
+{
+	FCraneRigSolver::Solve(Geometry, Preset, Input, OutSolution);
+
+	FCraneRigPose Pose;
+	FCraneRigSolver::BuildPose(Geometry, Preset, Input.TrackPosition, OutSolution, Pose);
+
+	// joints are stored in a hierarchy order, children keep their local transforms and follow a joint
+	for (int32 i = 0; i < Geometry.NumJoints; ++i)
+	{
+		const int32 Joint = Geometry.JointOrder[i];
+		const int32 Element = JointElements[Joint];
+
+		if (Element != INDEX_NONE)
+		{
+			Hierarchy->SetGlobalTransform(Element, Pose.ComponentSpace[Joint], false, true);
+		}
+	}
+}
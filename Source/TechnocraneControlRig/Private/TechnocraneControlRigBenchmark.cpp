@@ -0,0 +1,123 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneControlRigBenchmark.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "RigUnit_TechnocraneRig.h"
+#include "TechnocraneRigKinematics.h"
+#include "TechnocranePresetRegistry.h"
+
+#include "Engine/SkeletalMesh.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Rigs/RigHierarchy.h"
+#include "Rigs/RigHierarchyController.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTechnocraneControlRig, Log, All);
+
+namespace NTechnocraneControlRigBenchmark
+{
+	// compare the rig unit with the anim node solver path on a hierarchy imported from the crane model
+	void BenchmarkRigUnit(const TArray<FString>& Args)
+	{
+		const int32 CraneModel = (Args.Num() > 0) ? FMath::Clamp(FCString::Atoi(*Args[0]), 0, static_cast<int32>(ECranePreviewModelsEnum::ECranePreview_Count) - 1) : 0;
+		const int32 NumEvaluations = (Args.Num() > 1) ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 10000;
+
+		FTechnocranePresetRegistry& Registry = FTechnocranePresetRegistry::Get();
+		const FCranePresetEntryPtr Preset = (Registry.Initialize()) ? Registry.Find(CraneModel) : nullptr;
+		const USkeletalMesh* Mesh = (Preset) ? Cast<USkeletalMesh>(Preset->ModelPath.TryLoad()) : nullptr;
+
+		if (!Mesh)
+		{
+			UE_LOG(LogTechnocraneControlRig, Warning, TEXT("Crane model %d is not available"), CraneModel);
+			return;
+		}
+
+		// anim node geometry comes from the reference skeleton
+		FCraneRigGeometry NodeGeometry;
+		if (!FTechnocraneRigKinematics::BuildGeometry(NodeGeometry, Mesh->GetRefSkeleton(), Preset->Data.ColumnRotationBone))
+		{
+			return;
+		}
+
+		URigHierarchy* Hierarchy = NewObject<URigHierarchy>(GetTransientPackage());
+		Hierarchy->GetController(true)->ImportBones(Mesh->GetRefSkeleton(), NAME_None, false, false, false, false);
+
+		FCraneRigGeometry UnitGeometry;
+		TArray<int32> JointElements;
+
+		if (!FRigUnit_TechnocraneRig::BuildGeometry(Hierarchy, Preset->Data.ColumnRotationBone, UnitGeometry, JointElements))
+		{
+			return;
+		}
+
+		FRandomStream RandomStream(NumEvaluations);
+		TArray<FCraneRigSolverInput> Inputs;
+		Inputs.SetNum(NumEvaluations);
+
+		for (FCraneRigSolverInput& Input : Inputs)
+		{
+			const FTransform Camera(FRotator(RandomStream.FRandRange(-30.0f, 30.0f), RandomStream.FRandRange(-180.0f, 180.0f), 0.0f),
+				FVector(RandomStream.FRandRange(-600.0f, 600.0f), RandomStream.FRandRange(-600.0f, 600.0f), RandomStream.FRandRange(0.0f, 400.0f)));
+
+			FTechnocraneRigKinematics::MakeCameraInput(Camera, Camera, FVector::ZeroVector, FTransform::Identity, Input);
+			Input.TrackPosition = RandomStream.FRandRange(0.0f, 200.0f);
+		}
+
+		// joint transforms have to match between the anim node and the unit
+
+		double MaxError = 0.0;
+
+		for (const FCraneRigSolverInput& Input : Inputs)
+		{
+			FCraneRigSolution Solution;
+			FCraneRigPose Pose;
+			FCraneRigSolver::Solve(NodeGeometry, Preset->Preset, Input, Solution);
+			FCraneRigSolver::BuildPose(NodeGeometry, Preset->Preset, Input.TrackPosition, Solution, Pose);
+
+			FRigUnit_TechnocraneRig::SolveHierarchy(Hierarchy, UnitGeometry, Preset->Preset, JointElements, Input, Solution);
+
+			for (int32 Joint = 0; Joint < FCraneRigGeometry::JointCount; ++Joint)
+			{
+				if (JointElements[Joint] != INDEX_NONE)
+				{
+					const FTransform UnitTransform = Hierarchy->GetGlobalTransform(JointElements[Joint]);
+					MaxError = FMath::Max(MaxError, (UnitTransform.GetLocation() - Pose.ComponentSpace[Joint].GetLocation()).Size());
+					MaxError = FMath::Max(MaxError, static_cast<double>(UnitTransform.GetRotation().AngularDistance(Pose.ComponentSpace[Joint].GetRotation())));
+				}
+			}
+		}
+
+		// solver cost shared by both, the anim node adds a compact pose conversion on top (stat Technocrane, Technocrane Rig)
+
+		double StartTime = FPlatformTime::Seconds();
+		for (const FCraneRigSolverInput& Input : Inputs)
+		{
+			FCraneRigSolution Solution;
+			FCraneRigPose Pose;
+			FCraneRigSolver::Solve(NodeGeometry, Preset->Preset, Input, Solution);
+			FCraneRigSolver::BuildPose(NodeGeometry, Preset->Preset, Input.TrackPosition, Solution, Pose);
+		}
+		const double SolverUs = 1000000.0 * (FPlatformTime::Seconds() - StartTime) / NumEvaluations;
+
+		StartTime = FPlatformTime::Seconds();
+		for (const FCraneRigSolverInput& Input : Inputs)
+		{
+			FCraneRigSolution Solution;
+			FRigUnit_TechnocraneRig::SolveHierarchy(Hierarchy, UnitGeometry, Preset->Preset, JointElements, Input, Solution);
+		}
+		const double UnitUs = 1000000.0 * (FPlatformTime::Seconds() - StartTime) / NumEvaluations;
+
+		UE_LOG(LogTechnocraneControlRig, Display, TEXT("Technocrane rig unit, %s, %d bones, %d evaluations: solver %.3f us, unit %.3f us per evaluation, max joint difference %g"),
+			*Preset->RowName.ToString(), Hierarchy->Num(ERigElementType::Bone), NumEvaluations, SolverUs, UnitUs, MaxError);
+	}
+};
+
+static FAutoConsoleCommand GTechnocraneBenchmarkRigUnitCmd(
+	TEXT("Technocrane.BenchmarkRigUnit"),
+	TEXT("Compare the Technocrane Rig control rig unit with the anim node solver, joint transforms and cost per evaluation. Arguments: [CraneModel] [Evaluations]."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&NTechnocraneControlRigBenchmark::BenchmarkRigUnit)
+);
@@ -0,0 +1,47 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneControlRigModule.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Misc/CoreDelegates.h"
+#include "Modules/ModuleManager.h"
+
+#include "TechnocranePresetRegistry.h"
+
+class FTechnocraneControlRigModule : public IModuleInterface
+{
+public:
+
+	virtual void StartupModule() override
+	{
+		// a control rig could be evaluated on worker threads only, presets are compiled on the game thread ahead of it
+		if (GEngine && GEngine->IsInitialized())
+		{
+			InitializePresets();
+		}
+		else
+		{
+			PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FTechnocraneControlRigModule::InitializePresets);
+		}
+	}
+
+	virtual void ShutdownModule() override
+	{
+		FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	}
+
+private:
+
+	FDelegateHandle PostEngineInitHandle;
+
+	void InitializePresets()
+	{
+		FTechnocranePresetRegistry::Get().Initialize();
+	}
+};
+
+IMPLEMENT_MODULE(FTechnocraneControlRigModule, TechnocraneControlRig)
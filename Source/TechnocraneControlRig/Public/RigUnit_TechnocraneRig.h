@@ -0,0 +1,90 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// RigUnit_TechnocraneRig.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Units/RigUnit.h"
+#include "TechnocraneRigSolver.h"
+#include "TechnocraneRig.h"
+#include "RigUnit_TechnocraneRig.generated.h"
+
+// forward
+class URigHierarchy;
+
+USTRUCT()
+struct FRigUnit_TechnocraneRig_WorkData
+{
+	GENERATED_BODY()
+
+	/** hierarchy element index of every crane joint, INDEX_NONE when the joint is missing */
+	UPROPERTY()
+	TArray<int32> JointElements;
+
+	UPROPERTY()
+	int32 CachedTopologyVersion{ INDEX_NONE };
+
+	UPROPERTY()
+	ECranePreviewModelsEnum CachedCraneModel{ ECranePreviewModelsEnum::ECranePreview_Count };
+
+	/** derived from the hierarchy initial transforms, rebuilt when the topology or the crane model changes */
+	TSharedPtr<FCraneRigGeometry> Geometry;
+	FCraneRigPreset Preset;
+
+	/** a missing preset or joints are reported once until the topology or the crane model changes */
+	bool bReportedFailure{ false };
+};
+
+/**
+ * Crane kinematics of the Technocrane rig anim node as a native control rig unit.
+ *  Crane joints are found by name in the bone hierarchy and set in the global space, children follow their joints.
+ */
+USTRUCT(meta = (DisplayName = "Technocrane Rig", Category = "Technocrane", Keywords = "Crane,Technodolly,Supertechno"))
+struct TECHNOCRANECONTROLRIG_API FRigUnit_TechnocraneRig : public FRigUnitMutable
+{
+	GENERATED_BODY()
+
+	RIGVM_METHOD()
+	virtual void Execute() override;
+
+	/** crane preset, limits and the column rotation bone are taken from the crane presets data table */
+	UPROPERTY(meta = (Input))
+	ECranePreviewModelsEnum CraneModel{ ECranePreviewModelsEnum::ECranePreview_Technodolly25 };
+
+	/** camera transform in the rig global space, the crane head follows the camera */
+	UPROPERTY(meta = (Input))
+	FTransform Camera{ FTransform::Identity };
+
+	/** offset along camera axes, the same as the crane rig camera pivot offset */
+	UPROPERTY(meta = (Input))
+	FVector CameraPivotOffset{ FVector::ZeroVector };
+
+	UPROPERTY(meta = (Input))
+	float TrackPosition{ 0.0f };
+
+	UPROPERTY(meta = (Output))
+	float GroundHeight{ 0.0f };
+
+	UPROPERTY(meta = (Output))
+	float TiltAngle{ 0.0f };
+
+	UPROPERTY(meta = (Output))
+	float ExtensionLength{ 0.0f };
+
+	UPROPERTY(transient)
+	FRigUnit_TechnocraneRig_WorkData WorkData;
+
+	/**
+	 * derive crane geometry from initial transforms of hierarchy bones, the same way the anim node derives it from a reference skeleton
+	 * @param OutJointElements hierarchy element index of every crane joint
+	 */
+	static bool BuildGeometry(const URigHierarchy* Hierarchy, const FName& ColumnRotationBone, FCraneRigGeometry& OutGeometry, TArray<int32>& OutJointElements);
+
+	/** solve the crane and set global transforms of crane joints */
+	static void SolveHierarchy(URigHierarchy* Hierarchy, const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, TArrayView<const int32> JointElements,
+		const FCraneRigSolverInput& Input, FCraneRigSolution& OutSolution);
+};
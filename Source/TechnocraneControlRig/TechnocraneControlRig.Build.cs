@@ -0,0 +1,37 @@
+// Copyright (c) 2025 Technocrane s.r.o. 
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneControlRig.Build.cs
+// Sergei <Neill3d> Solokhin
+
+using Path = System.IO.Path;
+
+namespace UnrealBuildTool.Rules
+{
+	// crane kinematics as a native control rig unit
+	public class TechnocraneControlRig : ModuleRules
+	{
+        public TechnocraneControlRig(ReadOnlyTargetRules Target) : base(Target)
+		{
+            PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+            bLegacyPublicIncludePaths = false;
+
+            PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public"));
+
+            PublicDependencyModuleNames.AddRange(
+				new string[]
+				{
+                    "Core",
+                    "CoreUObject",
+                    "Engine",
+                    "RigVM",
+                    "ControlRig",
+                    "TechnocraneKinematics",
+                    "TechnocranePlugin"
+                }
+			);
+        }
+    }
+}
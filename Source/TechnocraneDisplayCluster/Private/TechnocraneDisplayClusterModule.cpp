@@ -0,0 +1,142 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneDisplayClusterModule.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "Misc/ScopeLock.h"
+
+#include "DisplayClusterEnums.h"
+#include "IDisplayCluster.h"
+#include "IDisplayClusterCallbacks.h"
+#include "Cluster/IDisplayClusterClusterManager.h"
+#include "Cluster/IDisplayClusterClusterSyncObject.h"
+
+#include "TechnocraneClusterSamples.h"
+
+namespace NTechnocraneDisplayCluster
+{
+	/** replicates a sample selection of the primary node to other nodes before they tick a frame */
+	class FSampleSyncObject : public IDisplayClusterClusterSyncObject
+	{
+	public:
+
+		virtual FString GetSyncId() const override { return TEXT("TechnocraneClusterSamples"); }
+		virtual bool IsActive() const override { return true; }
+		virtual bool IsDirty() const override { return bDirty; }
+		virtual void ClearDirty() override { bDirty = false; }
+
+		virtual FString SerializeToString() const override
+		{
+			FScopeLock ScopeLock(&Lock);
+			return Selection;
+		}
+
+		virtual bool DeserializeFromString(const FString& Data) override
+		{
+			FTechnocraneClusterSamples::ApplySelection(Data);
+			return true;
+		}
+
+		/** primary node, a selection of the frame goes to other nodes even when it is the same as before */
+		void SetSelection(FString&& InSelection)
+		{
+			FScopeLock ScopeLock(&Lock);
+			Selection = MoveTemp(InSelection);
+			bDirty = true;
+		}
+
+	private:
+		mutable FCriticalSection Lock;
+		FString Selection;
+		bool bDirty{ false };
+	};
+};
+
+class FTechnocraneDisplayClusterModule : public IModuleInterface
+{
+public:
+
+	virtual void StartupModule() override
+	{
+		if (!IDisplayCluster::IsAvailable())
+		{
+			return;
+		}
+
+		IDisplayClusterCallbacks& Callbacks = IDisplayCluster::Get().GetCallbacks();
+
+		Callbacks.OnDisplayClusterStartSession().AddRaw(this, &FTechnocraneDisplayClusterModule::OnStartSession);
+		Callbacks.OnDisplayClusterEndSession().AddRaw(this, &FTechnocraneDisplayClusterModule::OnEndSession);
+		Callbacks.OnDisplayClusterStartFrame().AddRaw(this, &FTechnocraneDisplayClusterModule::OnStartFrame);
+	}
+
+	virtual void ShutdownModule() override
+	{
+		OnEndSession();
+
+		if (IDisplayCluster::IsAvailable())
+		{
+			IDisplayClusterCallbacks& Callbacks = IDisplayCluster::Get().GetCallbacks();
+
+			Callbacks.OnDisplayClusterStartSession().RemoveAll(this);
+			Callbacks.OnDisplayClusterEndSession().RemoveAll(this);
+			Callbacks.OnDisplayClusterStartFrame().RemoveAll(this);
+		}
+	}
+
+private:
+
+	NTechnocraneDisplayCluster::FSampleSyncObject SyncObject;
+	bool bRegistered{ false };
+
+	void OnStartSession()
+	{
+		IDisplayCluster& DisplayCluster = IDisplayCluster::Get();
+		IDisplayClusterClusterManager* ClusterManager = DisplayCluster.GetClusterMgr();
+
+		// a standalone or editor session renders samples as they come
+		if (bRegistered || !ClusterManager || DisplayCluster.GetOperationMode() != EDisplayClusterOperationMode::Cluster)
+		{
+			return;
+		}
+
+		FTechnocraneClusterSamples::SetMode((ClusterManager->IsPrimary()) ? ECraneClusterMode::Primary : ECraneClusterMode::Secondary);
+
+		ClusterManager->RegisterSyncObject(&SyncObject, EDisplayClusterSyncGroup::PreTick);
+		bRegistered = true;
+	}
+
+	void OnEndSession()
+	{
+		if (!bRegistered)
+		{
+			return;
+		}
+
+		if (IDisplayCluster::IsAvailable())
+		{
+			if (IDisplayClusterClusterManager* ClusterManager = IDisplayCluster::Get().GetClusterMgr())
+			{
+				ClusterManager->UnregisterSyncObject(&SyncObject);
+			}
+		}
+
+		FTechnocraneClusterSamples::SetMode(ECraneClusterMode::Disabled);
+		bRegistered = false;
+	}
+
+	/** the primary node chooses samples at the frame start, they are replicated with pre tick sync objects */
+	void OnStartFrame(uint64 FrameNum)
+	{
+		if (bRegistered && FTechnocraneClusterSamples::GetMode() == ECraneClusterMode::Primary)
+		{
+			SyncObject.SetSelection(FTechnocraneClusterSamples::SelectSamples());
+		}
+	}
+};
+
+IMPLEMENT_MODULE(FTechnocraneDisplayClusterModule, TechnocraneDisplayCluster)
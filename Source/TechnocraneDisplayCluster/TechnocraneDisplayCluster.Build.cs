@@ -0,0 +1,31 @@
+// Copyright (c) 2025 Technocrane s.r.o. 
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneDisplayCluster.Build.cs
+// Sergei <Neill3d> Solokhin
+
+namespace UnrealBuildTool.Rules
+{
+	// crane sample selection shared by the nodes of an nDisplay cluster
+	public class TechnocraneDisplayCluster : ModuleRules
+	{
+        public TechnocraneDisplayCluster(ReadOnlyTargetRules Target) : base(Target)
+		{
+            PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+            bLegacyPublicIncludePaths = false;
+
+            PrivateDependencyModuleNames.AddRange(
+				new string[]
+				{
+                    "Core",
+                    "CoreUObject",
+                    "Engine",
+                    "DisplayCluster",
+                    "TechnocranePlugin"
+                }
+			);
+        }
+    }
+}
@@ -0,0 +1,670 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// CraneShotAnalyzer.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "CraneShotAnalyzer.h"
+#include "TechnocraneEditorPCH.h"
+#include "SCraneShotReport.h"
+
+#include "Async/ParallelFor.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/Selection.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Misc/MessageDialog.h"
+#include "ScopedTransaction.h"
+#include "Widgets/SWindow.h"
+
+#include "LevelSequence.h"
+#include "LevelSequenceEditorBlueprintLibrary.h"
+#include "MovieScene.h"
+#include "MovieSceneBindingProxy.h"
+#include "MovieSceneTimeHelpers.h"
+#include "Channels/MovieSceneDoubleChannel.h"
+#include "Sections/MovieScene3DTransformSection.h"
+#include "Sections/MovieSceneFloatSection.h"
+#include "Tracks/MovieScene3DTransformTrack.h"
+#include "Tracks/MovieSceneFloatTrack.h"
+
+#include "MovieSceneTechnocraneSection.h"
+#include "MovieSceneTechnocraneTrack.h"
+#include "TechnocraneCameraComponent.h"
+#include "TechnocraneRig.h"
+#include "TechnocraneRigKinematics.h"
+#include "TechnocraneReachField.h"
+#include "TechnocraneTrackLayout.h"
+
+#define LOCTEXT_NAMESPACE "TechnocraneCamera"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTechnocraneShotAnalysis, Log, All);
+
+namespace NCraneShotAnalyzer
+{
+	// translation, rotation and scale channels of a transform section
+	constexpr int32 NumTransformChannels = 9;
+
+	// a dolly pushed along tracks, the track position changes slower than that
+	constexpr float MaxTrackSpeed = 150.0f;
+
+	struct FTransformSectionChannels
+	{
+		const FMovieSceneDoubleChannel* Channels[NumTransformChannels]{ nullptr };
+	};
+
+	ATechnocraneRig* FindCraneRig()
+	{
+		if (!GEditor)
+		{
+			return nullptr;
+		}
+
+		for (FSelectionIterator It(GEditor->GetSelectedActorIterator()); It; ++It)
+		{
+			if (ATechnocraneRig* Rig = Cast<ATechnocraneRig>(*It))
+			{
+				return Rig;
+			}
+		}
+
+		if (UWorld* World = GEditor->GetEditorWorldContext().World())
+		{
+			for (TActorIterator<ATechnocraneRig> It(World); It; ++It)
+			{
+				return *It;
+			}
+		}
+		return nullptr;
+	}
+
+	void ShowError(const FText& Message)
+	{
+		UE_LOG(LogTechnocraneShotAnalysis, Warning, TEXT("%s"), *Message.ToString());
+		FMessageDialog::Open(EAppMsgType::Ok, Message);
+	}
+
+	const UMovieScene3DTransformTrack* FindSelectedTransformTrack(const UMovieScene* MovieScene, FGuid& OutBindingId)
+	{
+		for (const FMovieSceneBindingProxy& Binding : ULevelSequenceEditorBlueprintLibrary::GetSelectedBindings())
+		{
+			if (const UMovieScene3DTransformTrack* Track = MovieScene->FindTrack<UMovieScene3DTransformTrack>(Binding.BindingID))
+			{
+				OutBindingId = Binding.BindingID;
+				return Track;
+			}
+		}
+		return nullptr;
+	}
+
+	// a possessable of the crane rig, added to the sequence when there is none
+	FGuid FindOrAddRigBinding(ULevelSequence* Sequence, ATechnocraneRig* Rig)
+	{
+		UMovieScene* MovieScene = Sequence->GetMovieScene();
+		const FString RigLabel = Rig->GetActorLabel();
+
+		for (int32 i = 0; i < MovieScene->GetPossessableCount(); ++i)
+		{
+			const FMovieScenePossessable& Possessable = MovieScene->GetPossessable(i);
+			const UClass* PossessedClass = Possessable.GetPossessedObjectClass();
+
+			if (PossessedClass && PossessedClass->IsChildOf(ATechnocraneRig::StaticClass()) && Possessable.GetName() == RigLabel)
+			{
+				return Possessable.GetGuid();
+			}
+		}
+
+		const FGuid BindingId = MovieScene->AddPossessable(RigLabel, Rig->GetClass());
+		Sequence->BindPossessableObject(BindingId, *Rig, Rig->GetWorld());
+		return BindingId;
+	}
+
+	// a float track of a camera property, on the camera binding or on a binding of its component
+	const UMovieSceneFloatTrack* FindCameraFloatTrack(const UMovieScene* MovieScene, const FGuid& BindingId, const FName& PropertyName)
+	{
+		TArray<FGuid, TInlineAllocator<4>> BindingIds{ BindingId };
+		for (int32 i = 0; i < MovieScene->GetPossessableCount(); ++i)
+		{
+			const FMovieScenePossessable& Possessable = MovieScene->GetPossessable(i);
+			if (Possessable.GetParent() == BindingId)
+			{
+				BindingIds.Add(Possessable.GetGuid());
+			}
+		}
+
+		for (const FGuid& Id : BindingIds)
+		{
+			if (const FMovieSceneBinding* Binding = MovieScene->FindBinding(Id))
+			{
+				for (const UMovieSceneTrack* Track : Binding->GetTracks())
+				{
+					const UMovieSceneFloatTrack* FloatTrack = Cast<UMovieSceneFloatTrack>(Track);
+					if (FloatTrack && FloatTrack->GetPropertyName() == PropertyName)
+					{
+						return FloatTrack;
+					}
+				}
+			}
+		}
+		return nullptr;
+	}
+
+	// a crane target is a camera pivot, the same way the rig anim node makes it
+	FVector MakeCraneTarget(const FTransform& CameraTM, const FVector& PivotOffset)
+	{
+		const FQuat CameraRot = CameraTM.GetRotation();
+
+		return CameraTM.GetLocation()
+			+ CameraRot.GetForwardVector() * PivotOffset.X
+			- CameraRot.GetRightVector() * PivotOffset.Y
+			+ CameraRot.GetUpVector() * PivotOffset.Z;
+	}
+
+	// an empty float track of a rig property, existing keys are removed
+	UMovieSceneFloatTrack* ResetRigFloatTrack(UMovieScene* MovieScene, const FGuid& RigBindingId, const FName& PropertyName)
+	{
+		UMovieSceneFloatTrack* PropertyTrack = nullptr;
+		if (const FMovieSceneBinding* Binding = MovieScene->FindBinding(RigBindingId))
+		{
+			for (UMovieSceneTrack* Track : Binding->GetTracks())
+			{
+				UMovieSceneFloatTrack* FloatTrack = Cast<UMovieSceneFloatTrack>(Track);
+				if (FloatTrack && FloatTrack->GetPropertyName() == PropertyName)
+				{
+					PropertyTrack = FloatTrack;
+					break;
+				}
+			}
+		}
+
+		if (PropertyTrack)
+		{
+			PropertyTrack->Modify();
+			PropertyTrack->RemoveAllAnimationData();
+		}
+		else
+		{
+			PropertyTrack = MovieScene->AddTrack<UMovieSceneFloatTrack>(RigBindingId);
+			PropertyTrack->SetPropertyNameAndPath(PropertyName, PropertyName.ToString());
+		}
+		return PropertyTrack;
+	}
+
+	// pose cache time goes from zero at the first sampled frame to the shot duration at the last one
+	void KeyPoseCacheTime(UMovieScene* MovieScene, const FGuid& RigBindingId, const FFrameNumber StartFrame, const int32 NumFrames)
+	{
+		UMovieSceneFloatTrack* TimeTrack = ResetRigFloatTrack(MovieScene, RigBindingId, GET_MEMBER_NAME_CHECKED(ATechnocraneRig, PoseCacheTime));
+
+		const FFrameRate TickResolution = MovieScene->GetTickResolution();
+		const FFrameRate DisplayRate = MovieScene->GetDisplayRate();
+
+		const FFrameNumber StartTick = FFrameRate::TransformTime(FFrameTime(StartFrame), DisplayRate, TickResolution).RoundToFrame();
+		const FFrameNumber EndTick = FFrameRate::TransformTime(FFrameTime(StartFrame + NumFrames - 1), DisplayRate, TickResolution).RoundToFrame();
+
+		UMovieSceneFloatSection* Section = CastChecked<UMovieSceneFloatSection>(TimeTrack->CreateNewSection());
+		Section->SetRange(MovieScene->GetPlaybackRange());
+		TimeTrack->AddSection(*Section);
+
+		FMovieSceneFloatChannel& Channel = Section->GetChannel();
+		Channel.AddLinearKey(StartTick, 0.0f);
+		Channel.AddLinearKey(EndTick, static_cast<float>(DisplayRate.AsSeconds(FFrameTime(NumFrames - 1))));
+	}
+
+	// a key for every display frame of the shot
+	void KeyTrackPosition(UMovieScene* MovieScene, const FGuid& RigBindingId, const FFrameNumber StartFrame, TArrayView<const float> TrackPositions)
+	{
+		UMovieSceneFloatTrack* PositionTrack = ResetRigFloatTrack(MovieScene, RigBindingId, GET_MEMBER_NAME_CHECKED(ATechnocraneRig, TrackPosition));
+
+		const FFrameRate TickResolution = MovieScene->GetTickResolution();
+		const FFrameRate DisplayRate = MovieScene->GetDisplayRate();
+
+		UMovieSceneFloatSection* Section = CastChecked<UMovieSceneFloatSection>(PositionTrack->CreateNewSection());
+		Section->SetRange(MovieScene->GetPlaybackRange());
+		PositionTrack->AddSection(*Section);
+
+		FMovieSceneFloatChannel& Channel = Section->GetChannel();
+		for (int32 i = 0; i < TrackPositions.Num(); ++i)
+		{
+			const FFrameNumber Tick = FFrameRate::TransformTime(FFrameTime(StartFrame + i), DisplayRate, TickResolution).RoundToFrame();
+			Channel.AddLinearKey(Tick, TrackPositions[i]);
+		}
+	}
+};
+
+bool FCraneShotAnalyzer::CanAnalyze()
+{
+	return ULevelSequenceEditorBlueprintLibrary::GetCurrentLevelSequence() != nullptr;
+}
+
+bool FCraneShotAnalyzer::SampleTransformTrack(const UMovieScene* MovieScene, const UMovieScene3DTransformTrack* Track, TArray<FTransform>& OutTransforms, FFrameNumber& OutStartFrame)
+{
+	using namespace NCraneShotAnalyzer;
+
+	OutTransforms.Reset();
+
+	const TArray<UMovieSceneSection*>& Sections = Track->GetAllSections();
+	if (Sections.IsEmpty())
+	{
+		return false;
+	}
+
+	// resolve channels on the calling thread, workers only evaluate curves
+	TMap<const UMovieSceneSection*, FTransformSectionChannels> SectionChannels;
+	for (const UMovieSceneSection* Section : Sections)
+	{
+		if (const UMovieScene3DTransformSection* TransformSection = Cast<UMovieScene3DTransformSection>(Section))
+		{
+			TArrayView<FMovieSceneDoubleChannel*> Channels = TransformSection->GetChannelProxy().GetChannels<FMovieSceneDoubleChannel>();
+
+			FTransformSectionChannels& Entry = SectionChannels.Add(Section);
+			for (int32 i = 0; i < FMath::Min(Channels.Num(), NumTransformChannels); ++i)
+			{
+				Entry.Channels[i] = Channels[i];
+			}
+		}
+	}
+
+	const FFrameRate TickResolution = MovieScene->GetTickResolution();
+	const FFrameRate DisplayRate = MovieScene->GetDisplayRate();
+	const TRange<FFrameNumber> PlaybackRange = MovieScene->GetPlaybackRange();
+
+	const FFrameNumber StartTick = UE::MovieScene::DiscreteInclusiveLower(PlaybackRange);
+	const FFrameNumber EndTick = UE::MovieScene::DiscreteExclusiveUpper(PlaybackRange);
+
+	OutStartFrame = FFrameRate::TransformTime(FFrameTime(StartTick), TickResolution, DisplayRate).FloorToFrame();
+	const FFrameNumber EndFrame = FFrameRate::TransformTime(FFrameTime(EndTick), TickResolution, DisplayRate).CeilToFrame();
+
+	const int32 NumFrames = EndFrame.Value - OutStartFrame.Value;
+	if (NumFrames <= 0)
+	{
+		return false;
+	}
+
+	OutTransforms.SetNumUninitialized(NumFrames);
+	const FFrameNumber StartFrame = OutStartFrame;
+
+	ParallelFor(NumFrames, [&](const int32 FrameIndex)
+	{
+		const FFrameTime Time = FFrameRate::TransformTime(FFrameTime(StartFrame + FrameIndex), DisplayRate, TickResolution);
+
+		// the same section Sequencer would evaluate, or the closest one in between sections
+		const UMovieSceneSection* Section = MovieSceneHelpers::FindNearestSectionAtTime(Sections, Time.FrameNumber);
+		const FTransformSectionChannels* Entry = SectionChannels.Find(Section);
+
+		double Values[NumTransformChannels] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0 };
+		if (Entry)
+		{
+			for (int32 i = 0; i < NumTransformChannels; ++i)
+			{
+				if (Entry->Channels[i])
+				{
+					Entry->Channels[i]->Evaluate(Time, Values[i]);
+				}
+			}
+		}
+
+		// rotation channels are roll, pitch, yaw
+		OutTransforms[FrameIndex] = FTransform(
+			FRotator(Values[4], Values[5], Values[3]),
+			FVector(Values[0], Values[1], Values[2]),
+			FVector(Values[6], Values[7], Values[8]));
+	});
+
+	return true;
+}
+
+const UMovieSceneTrack* FCraneShotAnalyzer::SampleTrackPosition(const UMovieScene* MovieScene, const FGuid& BindingId, const FFrameNumber StartFrame, const int32 NumFrames, TArray<float>& OutTrackPositions)
+{
+	using namespace NCraneShotAnalyzer;
+
+	OutTrackPositions.Reset();
+
+	const FFrameRate TickResolution = MovieScene->GetTickResolution();
+	const FFrameRate DisplayRate = MovieScene->GetDisplayRate();
+
+	// a recorded crane take drives the camera track position
+	if (const UMovieSceneTechnocraneTrack* TakeTrack = MovieScene->FindTrack<UMovieSceneTechnocraneTrack>(BindingId))
+	{
+		const TArray<UMovieSceneSection*>& Sections = TakeTrack->GetAllSections();
+		if (!Sections.IsEmpty())
+		{
+			OutTrackPositions.SetNumUninitialized(NumFrames);
+
+			for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+			{
+				const FFrameTime Time = FFrameRate::TransformTime(FFrameTime(StartFrame + FrameIndex), DisplayRate, TickResolution);
+				const UMovieSceneTechnocraneSection* Section = Cast<UMovieSceneTechnocraneSection>(MovieSceneHelpers::FindNearestSectionAtTime(Sections, Time.FrameNumber));
+
+				float Sample[FCraneTakeSamples::NumChannels]{ 0.0f };
+				if (Section)
+				{
+					Section->EvaluateSamples(Time, TickResolution, MakeArrayView(Sample));
+				}
+				OutTrackPositions[FrameIndex] = Sample[static_cast<int32>(ECraneTakeChannel::TrackPosition)];
+			}
+			return TakeTrack;
+		}
+	}
+
+	// or a key framed camera property
+	const UMovieSceneFloatTrack* PositionTrack = FindCameraFloatTrack(MovieScene, BindingId, GET_MEMBER_NAME_CHECKED(UTechnocraneCameraComponent, TrackPos));
+	if (!PositionTrack || PositionTrack->GetAllSections().IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const TArray<UMovieSceneSection*>& Sections = PositionTrack->GetAllSections();
+
+	OutTrackPositions.SetNumUninitialized(NumFrames);
+
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+	{
+		const FFrameTime Time = FFrameRate::TransformTime(FFrameTime(StartFrame + FrameIndex), DisplayRate, TickResolution);
+		const UMovieSceneFloatSection* Section = Cast<UMovieSceneFloatSection>(MovieSceneHelpers::FindNearestSectionAtTime(Sections, Time.FrameNumber));
+
+		float Value = 0.0f;
+		if (Section)
+		{
+			Section->GetChannel().Evaluate(Time, Value);
+		}
+		OutTrackPositions[FrameIndex] = Value;
+	}
+	return PositionTrack;
+}
+
+bool FCraneShotAnalyzer::Analyze(const ATechnocraneRig* Rig, TArrayView<const FTransform> CameraTransforms, FCraneShotReport& OutReport)
+{
+	FCraneData CraneData;
+	FCraneRigGeometry Geometry;
+
+	if (!FTechnocraneRigKinematics::LoadPreset(FTechnocraneRigKinematics::GetPresetRowName(static_cast<int32>(Rig->CraneModel)), CraneData, Geometry))
+	{
+		return false;
+	}
+
+	OutReport.CraneName = CraneData.Name;
+	OutReport.Limits.Preset = FTechnocraneRigKinematics::MakePreset(CraneData);
+	OutReport.Limits.PanMin = CraneData.PanMin;
+	OutReport.Limits.PanMax = CraneData.PanMax;
+
+	// crane target is a camera pivot in the crane rig space, the same way the rig anim node does
+	const FTransform RigTM = Rig->GetActorTransform();
+	const FVector PivotOffset = Rig->CameraPivotOffset;
+
+	TArray<FVector> Targets;
+	Targets.SetNumUninitialized(CameraTransforms.Num());
+
+	for (int32 i = 0; i < CameraTransforms.Num(); ++i)
+	{
+		Targets[i] = RigTM.InverseTransformPosition(NCraneShotAnalyzer::MakeCraneTarget(CameraTransforms[i], PivotOffset));
+	}
+
+	const float TrackPosition = Rig->TrackPosition;
+	FCraneShotAnalysis::Analyze(Geometry, OutReport.Limits, Targets, MakeArrayView(&TrackPosition, 1), OutReport.Frames);
+	return true;
+}
+
+void FCraneShotAnalyzer::AnalyzeSelectedBinding()
+{
+	using namespace NCraneShotAnalyzer;
+
+	ULevelSequence* Sequence = ULevelSequenceEditorBlueprintLibrary::GetCurrentLevelSequence();
+	UMovieScene* MovieScene = (Sequence) ? Sequence->GetMovieScene() : nullptr;
+
+	if (!MovieScene)
+	{
+		ShowError(LOCTEXT("ShotAnalysisNoSequence", "Open a level sequence in Sequencer to analyze a crane shot."));
+		return;
+	}
+
+	FGuid BindingId;
+	const UMovieScene3DTransformTrack* TransformTrack = FindSelectedTransformTrack(MovieScene, BindingId);
+
+	if (!TransformTrack)
+	{
+		ShowError(LOCTEXT("ShotAnalysisNoBinding", "Select a camera binding with a transform track in Sequencer."));
+		return;
+	}
+
+	const ATechnocraneRig* Rig = FindCraneRig();
+	if (!Rig)
+	{
+		ShowError(LOCTEXT("ShotAnalysisNoRig", "Place (or select) a Technocrane Rig in the level to analyze the shot for."));
+		return;
+	}
+
+	TSharedRef<FCraneShotReport> Report = MakeShared<FCraneShotReport>();
+	Report->SequenceName = Sequence->GetName();
+	Report->BindingName = MovieScene->GetObjectDisplayName(BindingId).ToString();
+	Report->DisplayRate = MovieScene->GetDisplayRate();
+
+	double StartTime = FPlatformTime::Seconds();
+
+	TArray<FTransform> CameraTransforms;
+	if (!SampleTransformTrack(MovieScene, TransformTrack, CameraTransforms, Report->StartFrame))
+	{
+		ShowError(LOCTEXT("ShotAnalysisEmpty", "The camera transform track has nothing to sample in the playback range."));
+		return;
+	}
+
+	Report->SampleSeconds = FPlatformTime::Seconds() - StartTime;
+	StartTime = FPlatformTime::Seconds();
+
+	if (!Analyze(Rig, CameraTransforms, *Report))
+	{
+		ShowError(LOCTEXT("ShotAnalysisNoPreset", "Failed to load the crane preset of the Technocrane Rig."));
+		return;
+	}
+
+	Report->AnalyzeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogTechnocraneShotAnalysis, Log, TEXT("%s / %s on %s: %d frames, sampled in %.2f ms, solved in %.2f ms"),
+		*Report->SequenceName, *Report->BindingName, *Report->CraneName, Report->Frames.Num(),
+		1000.0 * Report->SampleSeconds, 1000.0 * Report->AnalyzeSeconds);
+
+	TSharedRef<SWindow> Window = SNew(SWindow)
+		.Title(FText::Format(LOCTEXT("ShotAnalysisTitle", "Crane Shot Analysis - {0}"), FText::FromString(Report->BindingName)))
+		.ClientSize(FVector2D(900.0, 420.0))
+		.SupportsMaximize(true)
+		.SupportsMinimize(false)
+		[
+			SNew(SCraneShotReport)
+			.Report(Report)
+		];
+
+	FSlateApplication::Get().AddWindow(Window);
+}
+
+void FCraneShotAnalyzer::BakeSelectedBinding()
+{
+	using namespace NCraneShotAnalyzer;
+
+	ULevelSequence* Sequence = ULevelSequenceEditorBlueprintLibrary::GetCurrentLevelSequence();
+	UMovieScene* MovieScene = (Sequence) ? Sequence->GetMovieScene() : nullptr;
+
+	if (!MovieScene)
+	{
+		ShowError(LOCTEXT("PoseCacheNoSequence", "Open a level sequence in Sequencer to bake a crane shot."));
+		return;
+	}
+
+	FGuid BindingId;
+	const UMovieScene3DTransformTrack* TransformTrack = FindSelectedTransformTrack(MovieScene, BindingId);
+
+	if (!TransformTrack)
+	{
+		ShowError(LOCTEXT("PoseCacheNoBinding", "Select a camera binding with a transform track in Sequencer."));
+		return;
+	}
+
+	ATechnocraneRig* Rig = FindCraneRig();
+	if (!Rig)
+	{
+		ShowError(LOCTEXT("PoseCacheNoRig", "Place (or select) a Technocrane Rig in the level to bake the shot for."));
+		return;
+	}
+
+	TArray<FTransform> CameraTransforms;
+	FFrameNumber StartFrame;
+
+	if (!SampleTransformTrack(MovieScene, TransformTrack, CameraTransforms, StartFrame))
+	{
+		ShowError(LOCTEXT("PoseCacheEmpty", "The camera transform track has nothing to sample in the playback range."));
+		return;
+	}
+
+	// the camera moves along tracks during the shot
+	TArray<float> TrackPositions;
+	const UMovieSceneTrack* TrackPositionTrack = SampleTrackPosition(MovieScene, BindingId, StartFrame, CameraTransforms.Num(), TrackPositions);
+
+	if (!Rig->BakePoseCache(CameraTransforms, TrackPositions, MovieScene->GetDisplayRate(), TransformTrack, TrackPositionTrack))
+	{
+		ShowError(LOCTEXT("PoseCacheNoPreset", "Failed to load the crane preset of the Technocrane Rig."));
+		return;
+	}
+
+	const FScopedTransaction Transaction(LOCTEXT("BakeCranePoseCache", "Bake Crane Pose Cache"));
+	MovieScene->Modify();
+
+	const FGuid RigBindingId = FindOrAddRigBinding(Sequence, Rig);
+	KeyPoseCacheTime(MovieScene, RigBindingId, StartFrame, CameraTransforms.Num());
+
+	UE_LOG(LogTechnocraneShotAnalysis, Log, TEXT("%s / %s: baked %d crane poses for %s"),
+		*Sequence->GetName(), *MovieScene->GetObjectDisplayName(BindingId).ToString(), CameraTransforms.Num(), *Rig->GetActorLabel());
+
+	// the whole shot against the set, a collision frame is reported in the display rate
+	if (Rig->bCheckClearance)
+	{
+		TArray<float> Clearance;
+		const int32 CollisionFrame = Rig->CheckPoseCacheClearance(Clearance);
+
+		if (CollisionFrame != INDEX_NONE)
+		{
+			UE_LOG(LogTechnocraneShotAnalysis, Warning, TEXT("%s: the crane intersects the set at frame %d"),
+				*Rig->GetActorLabel(), StartFrame.Value + CollisionFrame);
+		}
+		else if (Clearance.Num() > 0)
+		{
+			UE_LOG(LogTechnocraneShotAnalysis, Log, TEXT("%s: the shot is clear, min clearance %.1f cm"),
+				*Rig->GetActorLabel(), FMath::Min(Clearance));
+		}
+	}
+}
+
+void FCraneShotAnalyzer::OptimizeSelectedBinding()
+{
+	using namespace NCraneShotAnalyzer;
+
+	ULevelSequence* Sequence = ULevelSequenceEditorBlueprintLibrary::GetCurrentLevelSequence();
+	UMovieScene* MovieScene = (Sequence) ? Sequence->GetMovieScene() : nullptr;
+
+	if (!MovieScene)
+	{
+		ShowError(LOCTEXT("TrackLayoutNoSequence", "Open a level sequence in Sequencer to lay out crane tracks for a shot."));
+		return;
+	}
+
+	FGuid BindingId;
+	const UMovieScene3DTransformTrack* TransformTrack = FindSelectedTransformTrack(MovieScene, BindingId);
+
+	if (!TransformTrack)
+	{
+		ShowError(LOCTEXT("TrackLayoutNoBinding", "Select a camera binding with a transform track in Sequencer."));
+		return;
+	}
+
+	ATechnocraneRig* Rig = FindCraneRig();
+	if (!Rig)
+	{
+		ShowError(LOCTEXT("TrackLayoutNoRig", "Place (or select) a Technocrane Rig in the level to lay out the tracks for."));
+		return;
+	}
+
+	TArray<FTransform> CameraTransforms;
+	FFrameNumber StartFrame;
+
+	if (!SampleTransformTrack(MovieScene, TransformTrack, CameraTransforms, StartFrame))
+	{
+		ShowError(LOCTEXT("TrackLayoutEmpty", "The camera transform track has nothing to sample in the playback range."));
+		return;
+	}
+
+	FCraneData CraneData;
+	FCraneRigGeometry Geometry;
+
+	if (!FTechnocraneRigKinematics::LoadPreset(FTechnocraneRigKinematics::GetPresetRowName(static_cast<int32>(Rig->CraneModel)), CraneData, Geometry))
+	{
+		ShowError(LOCTEXT("TrackLayoutNoPreset", "Failed to load the crane preset of the Technocrane Rig."));
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FVector> Targets;
+	Targets.SetNumUninitialized(CameraTransforms.Num());
+
+	for (int32 i = 0; i < CameraTransforms.Num(); ++i)
+	{
+		Targets[i] = MakeCraneTarget(CameraTransforms[i], Rig->CameraPivotOffset);
+	}
+
+	const FCraneRigPreset Preset = FTechnocraneRigKinematics::MakePreset(CraneData);
+
+	FCraneReachField Field;
+	Field.Build(Geometry, Preset, 10.0f);
+
+	FCraneTrackLayoutSettings Settings;
+	Settings.TrackStart = Rig->TracksStartPosition;
+	Settings.TrackLength = Rig->GetTracksLength();
+	Settings.MaxTrackStep = MaxTrackSpeed / static_cast<float>(MovieScene->GetDisplayRate().AsDecimal());
+
+	if (Settings.TrackLength <= 0.0f)
+	{
+		UE_LOG(LogTechnocraneShotAnalysis, Warning, TEXT("%s has no tracks, only the crane placement is optimized"), *Rig->GetActorLabel());
+	}
+
+	FCraneTrackLayout Layout;
+	if (!FCraneTrackLayoutOptimizer::Optimize(Geometry, Preset, Field, Targets, static_cast<float>(Rig->GetActorLocation().Z), Settings, Layout))
+	{
+		ShowError(LOCTEXT("TrackLayoutFailed", "Failed to find a crane placement for the shot."));
+		return;
+	}
+
+	const double OptimizeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// the dolly can't be pushed faster than that, a layout is not applied then
+	if (!Layout.bWithinTrackStep)
+	{
+		ShowError(FText::Format(LOCTEXT("TrackLayoutTooFast", "The track layout moves the crane by {0} cm per frame, the limit is {1} cm."),
+			FText::AsNumber(Layout.LargestTrackStep), FText::AsNumber(Settings.MaxTrackStep)));
+		return;
+	}
+
+	const FScopedTransaction Transaction(LOCTEXT("OptimizeCraneTrackLayout", "Optimize Crane Track Layout"));
+	MovieScene->Modify();
+	Rig->Modify();
+
+	Rig->SetActorLocationAndRotation(Layout.BaseLocation, FRotator(0.0f, Layout.Heading, 0.0f));
+
+	if (Settings.TrackLength > 0.0f)
+	{
+		const FGuid RigBindingId = FindOrAddRigBinding(Sequence, Rig);
+		KeyTrackPosition(MovieScene, RigBindingId, StartFrame, Layout.TrackPositions);
+	}
+
+	UE_LOG(LogTechnocraneShotAnalysis, Log, TEXT("%s / %s: %s placed at %s heading %.1f, largest track step %.1f cm of %.1f cm, %d candidates in %.2f ms"),
+		*Sequence->GetName(), *MovieScene->GetObjectDisplayName(BindingId).ToString(), *Rig->GetActorLabel(),
+		*Layout.BaseLocation.ToString(), Layout.Heading, Layout.LargestTrackStep, Settings.MaxTrackStep, Layout.NumCandidates, 1000.0 * OptimizeSeconds);
+
+	if (Layout.MinMargin < 0.0f)
+	{
+		UE_LOG(LogTechnocraneShotAnalysis, Warning, TEXT("%s: the shot is out of the crane reach by %.1f cm"), *Rig->GetActorLabel(), -Layout.MinMargin);
+	}
+	else
+	{
+		UE_LOG(LogTechnocraneShotAnalysis, Log, TEXT("%s: min margin to crane limits %.1f cm"), *Rig->GetActorLabel(), Layout.MinMargin);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// CraneShotAnalyzer.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/FrameRate.h"
+#include "Misc/FrameNumber.h"
+#include "TechnocraneShotAnalysis.h"
+
+class UMovieScene;
+class UMovieScene3DTransformTrack;
+class UMovieSceneTrack;
+class ATechnocraneRig;
+
+/** result of a crane feasibility check for a camera binding */
+struct FCraneShotReport
+{
+	FString SequenceName;
+	FString BindingName;
+	FString CraneName;
+
+	FFrameRate DisplayRate;
+	FFrameNumber StartFrame;
+
+	FCraneShotLimits Limits;
+	TArray<FCraneShotFrame> Frames;
+
+	double SampleSeconds{ 0.0 };
+	double AnalyzeSeconds{ 0.0 };
+};
+
+/**
+ * Check that a crane rig can follow a Sequencer camera binding over the whole playback range
+ *  the transform track is sampled and solved for every display frame in parallel
+ */
+class FCraneShotAnalyzer
+{
+public:
+
+	/** analyze the selected binding of the opened level sequence with the selected (or the first) crane rig in the level */
+	static void AnalyzeSelectedBinding();
+
+	/** bake crane poses of the selected (or the first) crane rig for the selected binding, the rig pose cache time is keyed over the shot */
+	static void BakeSelectedBinding();
+
+	/** place the selected (or the first) crane rig and key its track position to follow the selected binding with the largest margin to limits */
+	static void OptimizeSelectedBinding();
+
+	static bool CanAnalyze();
+
+	/** evaluate transform track channels for every display frame of the playback range */
+	static bool SampleTransformTrack(const UMovieScene* MovieScene, const UMovieScene3DTransformTrack* Track, TArray<FTransform>& OutTransforms, FFrameNumber& OutStartFrame);
+
+	/**
+	 * evaluate camera track positions for display frames of a shot, from a crane take or a TrackPos track of the camera binding
+	 * @return the sampled track, nullptr when the binding doesn't animate the track position
+	 */
+	static const UMovieSceneTrack* SampleTrackPosition(const UMovieScene* MovieScene, const FGuid& BindingId, const FFrameNumber StartFrame, const int32 NumFrames, TArray<float>& OutTrackPositions);
+
+	static bool Analyze(const ATechnocraneRig* Rig, TArrayView<const FTransform> CameraTransforms, FCraneShotReport& OutReport);
+};
@@ -0,0 +1,397 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// CraneTakeRecorder.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "CraneTakeRecorder.h"
+#include "TechnocraneEditorPCH.h"
+
+#include "Editor.h"
+#include "Engine/Selection.h"
+#include "Features/IModularFeatures.h"
+#include "Misc/App.h"
+#include "Misc/MessageDialog.h"
+#include "ScopedTransaction.h"
+
+#include "ILiveLinkClient.h"
+#include "LiveLinkComponentController.h"
+#include "Roles/LiveLinkTransformTypes.h"
+
+#include "LevelSequence.h"
+#include "LevelSequenceEditorBlueprintLibrary.h"
+#include "MovieScene.h"
+
+#include "MovieSceneTechnocraneTrack.h"
+#include "TechnocraneCamera.h"
+#include "TechnocraneCameraComponent.h"
+#include "LiveLinkTechnocraneTypes.h"
+
+#define LOCTEXT_NAMESPACE "TechnocraneCamera"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTechnocraneTakeRecorder, Log, All);
+
+namespace NCraneTakeRecorder
+{
+	// take channels read from LiveLink properties of a technocrane subject
+	constexpr ECraneTakeChannel PropertyChannels[] = { ECraneTakeChannel::TrackPosition, ECraneTakeChannel::Zoom, ECraneTakeChannel::Iris, ECraneTakeChannel::Focus };
+	constexpr EPacketProperties ChannelProperties[] = { EPacketProperties::TrackPosition, EPacketProperties::Zoom, EPacketProperties::Iris, EPacketProperties::Focus };
+	constexpr int32 NumPropertyChannels = UE_ARRAY_COUNT(PropertyChannels);
+
+	bool IsRotationChannel(const int32 Channel)
+	{
+		return Channel == static_cast<int32>(ECraneTakeChannel::Pitch)
+			|| Channel == static_cast<int32>(ECraneTakeChannel::Yaw)
+			|| Channel == static_cast<int32>(ECraneTakeChannel::Roll);
+	}
+
+	// a source without a timecode marks its packets
+	bool HasTimeCode(const FLiveLinkTransformFrameData& FrameData)
+	{
+		const FString* HasTimeCodeValue = FrameData.MetaData.StringMetaData.Find(TEXT("HasTimeCode"));
+		return !HasTimeCodeValue || *HasTimeCodeValue == TEXT("1");
+	}
+
+	// timecode of the engine timecode provider, or a time of day when there is no provider
+	FFrameNumber GetTimecodeFrame(const FFrameRate SampleRate)
+	{
+		if (const TOptional<FQualifiedFrameTime> FrameTime = FApp::GetCurrentFrameTime())
+		{
+			return FrameTime->ConvertTo(SampleRate).FloorToFrame();
+		}
+		return SampleRate.AsFrameTime(FDateTime::Now().GetTimeOfDay().GetTotalSeconds()).FloorToFrame();
+	}
+
+	/** frames of a LiveLink subject, they come on the thread that pushes them to LiveLink */
+	class FRecording
+	{
+	public:
+
+		TWeakObjectPtr<ULevelSequence> Sequence;
+		TWeakObjectPtr<ATDCamera> Camera;
+
+		FLiveLinkSubjectName SubjectName;
+		FDelegateHandle StaticDataHandle;
+		FDelegateHandle FrameDataHandle;
+
+		/** a rate of frames without a timecode */
+		FFrameRate DisplayRate;
+
+		void OnStaticData(FLiveLinkSubjectKey SubjectKey, TSubclassOf<ULiveLinkRole> SubjectRole, const FLiveLinkStaticDataStruct& StaticData)
+		{
+			FScopeLock Lock(&CriticalSection);
+			UpdatePropertyIndices(StaticData);
+		}
+
+		void OnFrameData(FLiveLinkSubjectKey SubjectKey, TSubclassOf<ULiveLinkRole> SubjectRole, const FLiveLinkFrameDataStruct& FrameData)
+		{
+			if (const FLiveLinkTransformFrameData* TransformData = FrameData.Cast<FLiveLinkTransformFrameData>())
+			{
+				FScopeLock Lock(&CriticalSection);
+				if (!bTaken)
+				{
+					AddFrame(*TransformData);
+				}
+			}
+		}
+
+		void UpdatePropertyIndices(const FLiveLinkStaticDataStruct& StaticData)
+		{
+			const FLiveLinkBaseStaticData* BaseData = StaticData.GetBaseData();
+
+			for (int32 i = 0; i < NumPropertyChannels; ++i)
+			{
+				const FName PropertyName(PacketPropertyNames[static_cast<int32>(ChannelProperties[i])]);
+				PropertyIndices[i] = (BaseData) ? BaseData->PropertyNames.IndexOfByKey(PropertyName) : INDEX_NONE;
+			}
+		}
+
+		/** the recorded take, no frames are added after that */
+		FCraneTakeSamples TakeSamples(int32& OutNumDropped)
+		{
+			FScopeLock Lock(&CriticalSection);
+			bTaken = true;
+			OutNumDropped = NumDropped;
+			return MoveTemp(Samples);
+		}
+
+	private:
+
+		// the same values the take section applies on evaluation
+		void ReadSample(const FLiveLinkTransformFrameData& FrameData, float* OutSample) const
+		{
+			const FVector Location = FrameData.Transform.GetLocation();
+			const FRotator Rotation = FrameData.Transform.Rotator();
+
+			OutSample[static_cast<int32>(ECraneTakeChannel::LocationX)] = static_cast<float>(Location.X);
+			OutSample[static_cast<int32>(ECraneTakeChannel::LocationY)] = static_cast<float>(Location.Y);
+			OutSample[static_cast<int32>(ECraneTakeChannel::LocationZ)] = static_cast<float>(Location.Z);
+			OutSample[static_cast<int32>(ECraneTakeChannel::Pitch)] = static_cast<float>(Rotation.Pitch);
+			OutSample[static_cast<int32>(ECraneTakeChannel::Yaw)] = static_cast<float>(Rotation.Yaw);
+			OutSample[static_cast<int32>(ECraneTakeChannel::Roll)] = static_cast<float>(Rotation.Roll);
+
+			for (int32 i = 0; i < NumPropertyChannels; ++i)
+			{
+				const int32 PropertyIndex = PropertyIndices[i];
+				OutSample[static_cast<int32>(PropertyChannels[i])] = (FrameData.PropertyValues.IsValidIndex(PropertyIndex)) ? FrameData.PropertyValues[PropertyIndex] : 0.0f;
+			}
+		}
+
+		// a frame of the packet timecode, or of the arrival time when the packet has none
+		FFrameNumber GetFrameNumber(const FLiveLinkTransformFrameData& FrameData, const FFrameRate SampleRate) const
+		{
+			if (HasTimeCode(FrameData))
+			{
+				return FrameData.MetaData.SceneTime.ConvertTo(SampleRate).FloorToFrame();
+			}
+			return Samples.StartFrame + SampleRate.AsFrameTime(FPlatformTime::Seconds() - StartSeconds).FloorToFrame();
+		}
+
+		void AddFrame(const FLiveLinkTransformFrameData& FrameData)
+		{
+			float Sample[FCraneTakeSamples::NumChannels];
+			ReadSample(FrameData, Sample);
+
+			// the take runs at the rate of the packet timecode
+			if (Samples.IsEmpty())
+			{
+				const bool bHasTimeCode = HasTimeCode(FrameData);
+				const FFrameRate SampleRate = (bHasTimeCode) ? FrameData.MetaData.SceneTime.Rate : DisplayRate;
+
+				StartSeconds = FPlatformTime::Seconds();
+				Samples.Reset(SampleRate, (bHasTimeCode) ? FrameData.MetaData.SceneTime.ConvertTo(SampleRate).FloorToFrame() : GetTimecodeFrame(SampleRate));
+				Samples.AddSample(MakeArrayView(Sample));
+				FMemory::Memcpy(LastSample, Sample, sizeof(Sample));
+				return;
+			}
+
+			// a packet that comes again or out of order
+			const int32 SampleIndex = (GetFrameNumber(FrameData, Samples.SampleRate) - Samples.StartFrame).Value;
+			const int32 LastIndex = Samples.Num() - 1;
+
+			if (SampleIndex <= LastIndex)
+			{
+				++NumDropped;
+				return;
+			}
+
+			// angles are unwound, so a take interpolates them the short way around
+			for (int32 i = 0; i < FCraneTakeSamples::NumChannels; ++i)
+			{
+				if (IsRotationChannel(i))
+				{
+					Sample[i] = LastSample[i] + FMath::FindDeltaAngleDegrees(LastSample[i], Sample[i]);
+				}
+			}
+
+			// frames of lost packets are interpolated
+			float Interpolated[FCraneTakeSamples::NumChannels];
+			for (int32 Index = LastIndex + 1; Index < SampleIndex; ++Index)
+			{
+				const float Alpha = static_cast<float>(Index - LastIndex) / static_cast<float>(SampleIndex - LastIndex);
+				for (int32 i = 0; i < FCraneTakeSamples::NumChannels; ++i)
+				{
+					Interpolated[i] = FMath::Lerp(LastSample[i], Sample[i], Alpha);
+				}
+				Samples.AddSample(MakeArrayView(Interpolated));
+			}
+
+			Samples.AddSample(MakeArrayView(Sample));
+			FMemory::Memcpy(LastSample, Sample, sizeof(Sample));
+		}
+
+		FCriticalSection CriticalSection;
+
+		FCraneTakeSamples Samples;
+		double StartSeconds{ 0.0 };
+		float LastSample[FCraneTakeSamples::NumChannels]{ 0.0f };
+		int32 NumDropped{ 0 };
+		bool bTaken{ false };
+
+		/** an index of a channel property in the subject properties, INDEX_NONE when the subject doesn't have it */
+		int32 PropertyIndices[NumPropertyChannels]{ INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	};
+
+	TSharedPtr<FRecording, ESPMode::ThreadSafe> Recording;
+
+	ILiveLinkClient* GetLiveLinkClient()
+	{
+		IModularFeatures& ModularFeatures = IModularFeatures::Get();
+		return (ModularFeatures.IsModularFeatureAvailable(ILiveLinkClient::ModularFeatureName))
+			? &ModularFeatures.GetModularFeature<ILiveLinkClient>(ILiveLinkClient::ModularFeatureName)
+			: nullptr;
+	}
+
+	ATDCamera* FindSelectedCamera()
+	{
+		if (!GEditor)
+		{
+			return nullptr;
+		}
+
+		for (FSelectionIterator It(GEditor->GetSelectedActorIterator()); It; ++It)
+		{
+			if (ATDCamera* Camera = Cast<ATDCamera>(*It))
+			{
+				return Camera;
+			}
+		}
+		return nullptr;
+	}
+
+	// a subject of the LiveLink controller that drives the camera
+	FLiveLinkSubjectName FindCameraSubject(const ATDCamera& Camera)
+	{
+		const ULiveLinkComponentController* Controller = Camera.FindComponentByClass<ULiveLinkComponentController>();
+		return (Controller) ? Controller->SubjectRepresentation.Subject : FLiveLinkSubjectName();
+	}
+
+	void ShowError(const FText& Message)
+	{
+		UE_LOG(LogTechnocraneTakeRecorder, Warning, TEXT("%s"), *Message.ToString());
+		FMessageDialog::Open(EAppMsgType::Ok, Message);
+	}
+
+	// a possessable of the camera, added to the sequence when there is none
+	FGuid FindOrAddCameraBinding(ULevelSequence* Sequence, ATDCamera* Camera)
+	{
+		UMovieScene* MovieScene = Sequence->GetMovieScene();
+		const FString CameraLabel = Camera->GetActorLabel();
+
+		for (int32 i = 0; i < MovieScene->GetPossessableCount(); ++i)
+		{
+			const FMovieScenePossessable& Possessable = MovieScene->GetPossessable(i);
+			const UClass* PossessedClass = Possessable.GetPossessedObjectClass();
+
+			if (PossessedClass && PossessedClass->IsChildOf(ATDCamera::StaticClass()) && Possessable.GetName() == CameraLabel)
+			{
+				return Possessable.GetGuid();
+			}
+		}
+
+		const FGuid BindingId = MovieScene->AddPossessable(CameraLabel, Camera->GetClass());
+		Sequence->BindPossessableObject(BindingId, *Camera, Camera->GetWorld());
+		return BindingId;
+	}
+
+	void StartRecording()
+	{
+		ULevelSequence* Sequence = ULevelSequenceEditorBlueprintLibrary::GetCurrentLevelSequence();
+		if (!Sequence || !Sequence->GetMovieScene())
+		{
+			ShowError(LOCTEXT("RecordNoSequence", "Open a level sequence to record a crane take into"));
+			return;
+		}
+
+		ATDCamera* Camera = FindSelectedCamera();
+		if (!Camera)
+		{
+			ShowError(LOCTEXT("RecordNoCamera", "Select a Technocrane Camera actor to record a crane take of"));
+			return;
+		}
+
+		const FLiveLinkSubjectName SubjectName = FindCameraSubject(*Camera);
+		ILiveLinkClient* Client = GetLiveLinkClient();
+
+		if (SubjectName.IsNone() || !Client)
+		{
+			ShowError(LOCTEXT("RecordNoSubject", "The Technocrane Camera needs a LiveLink controller with a crane subject to record a take of"));
+			return;
+		}
+
+		TSharedRef<FRecording, ESPMode::ThreadSafe> NewRecording = MakeShared<FRecording, ESPMode::ThreadSafe>();
+		NewRecording->Sequence = Sequence;
+		NewRecording->Camera = Camera;
+		NewRecording->SubjectName = SubjectName;
+		NewRecording->DisplayRate = Sequence->GetMovieScene()->GetDisplayRate();
+
+		TSubclassOf<ULiveLinkRole> SubjectRole;
+		FLiveLinkStaticDataStruct StaticData;
+
+		const bool bRegistered = Client->RegisterForSubjectFrames(SubjectName,
+			FOnLiveLinkSubjectStaticDataAdded::FDelegate::CreateThreadSafeSP(NewRecording, &FRecording::OnStaticData),
+			FOnLiveLinkSubjectFrameDataAdded::FDelegate::CreateThreadSafeSP(NewRecording, &FRecording::OnFrameData),
+			NewRecording->StaticDataHandle, NewRecording->FrameDataHandle, SubjectRole, &StaticData);
+
+		if (!bRegistered)
+		{
+			ShowError(FText::Format(LOCTEXT("RecordSubjectFailed", "Failed to record LiveLink subject {0}"), FText::FromName(SubjectName.Name)));
+			return;
+		}
+
+		// properties of the static data the subject already has
+		NewRecording->OnStaticData(FLiveLinkSubjectKey(), SubjectRole, StaticData);
+		Recording = NewRecording;
+
+		UE_LOG(LogTechnocraneTakeRecorder, Log, TEXT("Recording a crane take of %s from LiveLink subject %s into %s"),
+			*Camera->GetActorLabel(), *SubjectName.ToString(), *Sequence->GetName());
+	}
+
+	void StopRecording()
+	{
+		TSharedPtr<FRecording, ESPMode::ThreadSafe> Take = MoveTemp(Recording);
+
+		if (ILiveLinkClient* Client = GetLiveLinkClient())
+		{
+			Client->UnregisterSubjectFramesHandle(Take->SubjectName, Take->StaticDataHandle, Take->FrameDataHandle);
+		}
+
+		int32 NumDropped = 0;
+		FCraneTakeSamples Samples = Take->TakeSamples(NumDropped);
+
+		ULevelSequence* Sequence = Take->Sequence.Get();
+		ATDCamera* Camera = Take->Camera.Get();
+		if (!Sequence || !Sequence->GetMovieScene() || !Camera || Samples.IsEmpty())
+		{
+			UE_LOG(LogTechnocraneTakeRecorder, Warning, TEXT("Crane take is dropped, the sequence or the camera is gone, or no frames have come"));
+			return;
+		}
+
+		UMovieScene* MovieScene = Sequence->GetMovieScene();
+		const int32 NumSamples = Samples.Num();
+		const double SampleRate = Samples.SampleRate.AsDecimal();
+
+		const FScopedTransaction Transaction(LOCTEXT("RecordCraneTake", "Record Crane Take"));
+		Sequence->Modify();
+		MovieScene->Modify();
+
+		const FGuid BindingId = FindOrAddCameraBinding(Sequence, Camera);
+
+		UMovieSceneTechnocraneTrack* Track = MovieScene->FindTrack<UMovieSceneTechnocraneTrack>(BindingId);
+		if (!Track)
+		{
+			Track = MovieScene->AddTrack<UMovieSceneTechnocraneTrack>(BindingId);
+		}
+
+		const FFrameNumber StartTick = MovieScene->GetPlaybackRange().GetLowerBoundValue();
+		Track->AddTake(MoveTemp(Samples), StartTick);
+
+		UE_LOG(LogTechnocraneTakeRecorder, Log, TEXT("Crane take of %s is added to %s, %d samples at %.2f fps, %d repeated packets dropped"),
+			*Camera->GetActorLabel(), *Sequence->GetName(), NumSamples, SampleRate, NumDropped);
+	}
+};
+
+void FCraneTakeRecorder::ToggleRecording()
+{
+	if (NCraneTakeRecorder::Recording)
+	{
+		NCraneTakeRecorder::StopRecording();
+	}
+	else
+	{
+		NCraneTakeRecorder::StartRecording();
+	}
+}
+
+bool FCraneTakeRecorder::CanRecord()
+{
+	return IsRecording() || ULevelSequenceEditorBlueprintLibrary::GetCurrentLevelSequence() != nullptr;
+}
+
+bool FCraneTakeRecorder::IsRecording()
+{
+	return NCraneTakeRecorder::Recording.IsValid();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,26 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// CraneTakeRecorder.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Record a take of a technocrane camera into the opened level sequence
+ *  every LiveLink frame of the subject that drives the selected technocrane camera actor is recorded
+ *  at the source rate and placed by its timecode, on stop the take is added to a technocrane track of the camera binding at the playback start
+ */
+class FCraneTakeRecorder
+{
+public:
+
+	/** start recording the selected technocrane camera, or stop and add the recorded take */
+	static void ToggleRecording();
+
+	static bool CanRecord();
+	static bool IsRecording();
+};
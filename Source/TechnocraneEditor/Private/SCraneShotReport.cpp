@@ -0,0 +1,267 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// SCraneShotReport.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "SCraneShotReport.h"
+#include "CraneShotAnalyzer.h"
+
+#include "Rendering/DrawElements.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/SLeafWidget.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Text/STextBlock.h"
+
+#define LOCTEXT_NAMESPACE "TechnocraneCamera"
+
+namespace NCraneShotReport
+{
+	constexpr float RowHeight{ 20.0f };
+
+	enum EHeatmapRow : int32
+	{
+		Row_Tilt = 0,
+		Row_Extension,
+		Row_Pan,
+		Row_Count
+	};
+
+	float GetUsage(const FCraneShotFrame& Frame, const int32 Row)
+	{
+		switch (Row)
+		{
+		case Row_Tilt: return Frame.TiltUsage;
+		case Row_Extension: return Frame.ExtensionUsage;
+		default: return Frame.PanUsage;
+		}
+	}
+
+	FLinearColor GetUsageColor(const float Usage)
+	{
+		// comfortable range is green, getting close to a limit goes to yellow, beyond a limit is red
+		constexpr float WarningUsage{ 0.8f };
+
+		if (Usage > 1.0f)
+		{
+			return FLinearColor::Red;
+		}
+		if (Usage < WarningUsage)
+		{
+			return FLinearColor(0.1f, 0.5f, 0.1f);
+		}
+		return FLinearColor::LerpUsingHSV(FLinearColor(0.1f, 0.5f, 0.1f), FLinearColor::Yellow, (Usage - WarningUsage) / (1.0f - WarningUsage));
+	}
+};
+
+/** timeline heatmap, one row per crane limit, every column shows the worst usage over frames it covers */
+class SCraneShotHeatmap : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SCraneShotHeatmap)
+	{}
+		SLATE_ARGUMENT(TSharedPtr<FCraneShotReport>, Report)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs)
+	{
+		Report = InArgs._Report;
+	}
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override
+	{
+		using namespace NCraneShotReport;
+
+		const int32 NumFrames = (Report.IsValid()) ? Report->Frames.Num() : 0;
+		if (NumFrames == 0)
+		{
+			return LayerId;
+		}
+
+		const FSlateBrush* Brush = FAppStyle::GetBrush("WhiteBrush");
+		const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+
+		const int32 NumColumns = FMath::Clamp(FMath::FloorToInt(LocalSize.X), 1, NumFrames);
+		const double ColumnWidth = LocalSize.X / NumColumns;
+
+		for (int32 Row = 0; Row < Row_Count; ++Row)
+		{
+			for (int32 Column = 0; Column < NumColumns; ++Column)
+			{
+				const int32 FirstFrame = static_cast<int32>(static_cast<int64>(Column) * NumFrames / NumColumns);
+				const int32 LastFrame = FMath::Max(FirstFrame + 1, static_cast<int32>(static_cast<int64>(Column + 1) * NumFrames / NumColumns));
+
+				float Usage = 0.0f;
+				for (int32 i = FirstFrame; i < LastFrame; ++i)
+				{
+					Usage = FMath::Max(Usage, GetUsage(Report->Frames[i], Row));
+				}
+
+				FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+					AllottedGeometry.ToPaintGeometry(FVector2D(ColumnWidth, RowHeight - 1.0), FSlateLayoutTransform(FVector2D(Column * ColumnWidth, Row * RowHeight))),
+					Brush, ESlateDrawEffect::None, GetUsageColor(Usage));
+			}
+		}
+
+		return LayerId + 1;
+	}
+
+	virtual FVector2D ComputeDesiredSize(float) const override
+	{
+		return FVector2D(600.0, NCraneShotReport::RowHeight * NCraneShotReport::Row_Count);
+	}
+
+private:
+	TSharedPtr<FCraneShotReport> Report;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////
+// SCraneShotReport
+
+void SCraneShotReport::Construct(const FArguments& InArgs)
+{
+	using namespace NCraneShotReport;
+
+	Report = InArgs._Report;
+
+	auto MakeRowLabel = [](const FText& Label) -> TSharedRef<SWidget>
+	{
+		return SNew(SBox)
+			.HeightOverride(RowHeight)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock).Text(Label)
+			];
+	};
+
+	ChildSlot
+	[
+		SNew(SBorder)
+		.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+		.Padding(8.0f)
+		[
+			SNew(SVerticalBox)
+
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.0f, 0.0f, 0.0f, 8.0f)
+			[
+				SNew(STextBlock)
+				.Text(MakeSummaryText())
+			]
+
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(0.0f, 0.0f, 0.0f, 8.0f)
+			[
+				SNew(SHorizontalBox)
+
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(0.0f, 0.0f, 8.0f, 0.0f)
+				[
+					SNew(SVerticalBox)
+					+ SVerticalBox::Slot().AutoHeight()[MakeRowLabel(LOCTEXT("ShotReportTilt", "Tilt"))]
+					+ SVerticalBox::Slot().AutoHeight()[MakeRowLabel(LOCTEXT("ShotReportExtension", "Extension"))]
+					+ SVerticalBox::Slot().AutoHeight()[MakeRowLabel(LOCTEXT("ShotReportPan", "Pan"))]
+				]
+
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.0f)
+				[
+					SNew(SCraneShotHeatmap)
+					.Report(Report)
+				]
+			]
+
+			+ SVerticalBox::Slot()
+			.FillHeight(1.0f)
+			[
+				SNew(SScrollBox)
+				+ SScrollBox::Slot()
+				[
+					SNew(STextBlock)
+					.Text(MakeClampRangesText())
+				]
+			]
+		]
+	];
+}
+
+FText SCraneShotReport::MakeSummaryText() const
+{
+	int32 NumClampedFrames = 0;
+	for (const FCraneShotFrame& Frame : Report->Frames)
+	{
+		if (Frame.Flags != ECraneLimitFlags::None)
+		{
+			++NumClampedFrames;
+		}
+	}
+
+	FFormatNamedArguments Args;
+	Args.Add(TEXT("Sequence"), FText::FromString(Report->SequenceName));
+	Args.Add(TEXT("Binding"), FText::FromString(Report->BindingName));
+	Args.Add(TEXT("Crane"), FText::FromString(Report->CraneName));
+	Args.Add(TEXT("NumFrames"), Report->Frames.Num());
+	Args.Add(TEXT("NumClamped"), NumClampedFrames);
+	Args.Add(TEXT("Time"), FText::AsNumber(1000.0 * (Report->SampleSeconds + Report->AnalyzeSeconds)));
+
+	return FText::Format(LOCTEXT("ShotReportSummary", "{Sequence} / {Binding} on {Crane}\n{NumFrames} frames, {NumClamped} frames out of crane limits, analyzed in {Time} ms"), Args);
+}
+
+FText SCraneShotReport::MakeClampRangesText() const
+{
+	struct FLimitDesc
+	{
+		uint8 Flag;
+		const TCHAR* Name;
+	};
+
+	const FLimitDesc Limits[] = {
+		{ ECraneLimitFlags::TiltMin, TEXT("Tilt min") },
+		{ ECraneLimitFlags::TiltMax, TEXT("Tilt max") },
+		{ ECraneLimitFlags::ExtensionMin, TEXT("Extension min") },
+		{ ECraneLimitFlags::ExtensionMax, TEXT("Extension max") },
+		{ ECraneLimitFlags::PanMin, TEXT("Pan min") },
+		{ ECraneLimitFlags::PanMax, TEXT("Pan max") }
+	};
+
+	const TArray<FCraneShotFrame>& Frames = Report->Frames;
+	const int32 StartFrame = Report->StartFrame.Value;
+
+	FString Result;
+
+	for (const FLimitDesc& Limit : Limits)
+	{
+		int32 RangeStart = INDEX_NONE;
+
+		for (int32 i = 0; i <= Frames.Num(); ++i)
+		{
+			const bool bClamped = i < Frames.Num() && (Frames[i].Flags & Limit.Flag) != 0;
+
+			if (bClamped && RangeStart == INDEX_NONE)
+			{
+				RangeStart = i;
+			}
+			else if (!bClamped && RangeStart != INDEX_NONE)
+			{
+				Result += FString::Printf(TEXT("%s: frames %d - %d\n"), Limit.Name, StartFrame + RangeStart, StartFrame + i - 1);
+				RangeStart = INDEX_NONE;
+			}
+		}
+	}
+
+	if (Result.IsEmpty())
+	{
+		return LOCTEXT("ShotReportNoClamps", "The crane follows the camera over the whole shot.");
+	}
+	return FText::FromString(Result);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// SCraneShotReport.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/SCompoundWidget.h"
+
+struct FCraneShotReport;
+
+/**
+ * Crane shot feasibility report, a timeline heatmap of tilt, extension and pan limits usage
+ *  and a list of frame ranges where the crane can't follow the camera
+ */
+class SCraneShotReport : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SCraneShotReport)
+	{}
+		SLATE_ARGUMENT(TSharedPtr<FCraneShotReport>, Report)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	FText MakeSummaryText() const;
+	FText MakeClampRangesText() const;
+
+	TSharedPtr<FCraneShotReport> Report;
+};
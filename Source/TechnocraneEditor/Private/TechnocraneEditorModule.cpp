@@ -22,6 +22,9 @@
 
 #include "CameraAssetTypeActions.h"
 #include "CameraDetailsCustomization.h"
+#include "CraneShotAnalyzer.h"
+#include "CraneTakeRecorder.h"
+#include "ToolMenus.h"
 
 #include "TechnocraneCamera.h"
 #include "TechnocraneEditorCommands.h"
@@ -103,6 +106,29 @@ void FTechnocraneEditorModule::StartupModule()
 		FExecuteAction::CreateRaw(this, &FTechnocraneEditorModule::PluginButtonClicked),
 		FCanExecuteAction());
 
+	PluginCommands->MapAction(
+		FTechnocraneEditorCommands::Get().AnalyzeCraneShot,
+		FExecuteAction::CreateStatic(&FCraneShotAnalyzer::AnalyzeSelectedBinding),
+		FCanExecuteAction::CreateStatic(&FCraneShotAnalyzer::CanAnalyze));
+
+	PluginCommands->MapAction(
+		FTechnocraneEditorCommands::Get().BakeCranePoseCache,
+		FExecuteAction::CreateStatic(&FCraneShotAnalyzer::BakeSelectedBinding),
+		FCanExecuteAction::CreateStatic(&FCraneShotAnalyzer::CanAnalyze));
+
+	PluginCommands->MapAction(
+		FTechnocraneEditorCommands::Get().OptimizeCraneTrackLayout,
+		FExecuteAction::CreateStatic(&FCraneShotAnalyzer::OptimizeSelectedBinding),
+		FCanExecuteAction::CreateStatic(&FCraneShotAnalyzer::CanAnalyze));
+
+	PluginCommands->MapAction(
+		FTechnocraneEditorCommands::Get().RecordCraneTake,
+		FExecuteAction::CreateStatic(&FCraneTakeRecorder::ToggleRecording),
+		FCanExecuteAction::CreateStatic(&FCraneTakeRecorder::CanRecord),
+		FIsActionChecked::CreateStatic(&FCraneTakeRecorder::IsRecording));
+
+	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FTechnocraneEditorModule::RegisterMenus));
+
 	// TODO: add functionality and activate the toolbar button
 	// Only add the toolbar if TechnocranePlugin is the currently active
 	//static FName SystemName(TEXT("Technocrane"));
@@ -116,6 +142,20 @@ void FTechnocraneEditorModule::StartupModule()
 	//}
 }
 
+void FTechnocraneEditorModule::RegisterMenus()
+{
+	FToolMenuOwnerScoped OwnerScoped(this);
+
+	UToolMenu* ToolsMenu = UToolMenus::Get()->ExtendMenu("LevelEditor.MainMenu.Tools");
+	FToolMenuSection& Section = ToolsMenu->FindOrAddSection("Technocrane");
+	Section.Label = LOCTEXT("TechnocraneToolsSection", "Technocrane");
+
+	Section.AddMenuEntryWithCommandList(FTechnocraneEditorCommands::Get().AnalyzeCraneShot, PluginCommands);
+	Section.AddMenuEntryWithCommandList(FTechnocraneEditorCommands::Get().BakeCranePoseCache, PluginCommands);
+	Section.AddMenuEntryWithCommandList(FTechnocraneEditorCommands::Get().OptimizeCraneTrackLayout, PluginCommands);
+	Section.AddMenuEntryWithCommandList(FTechnocraneEditorCommands::Get().RecordCraneTake, PluginCommands);
+}
+
 void FTechnocraneEditorModule::PluginButtonClicked()
 {
 	// Empty on purpose
@@ -141,6 +181,9 @@ TSharedRef<SWidget> FTechnocraneEditorModule::FillComboButton(TSharedPtr<class F
 
 void FTechnocraneEditorModule::ShutdownModule()
 {
+	UToolMenus::UnRegisterStartupCallback(this);
+	UToolMenus::UnregisterOwner(this);
+
 	UnregisterSettings();
 
 	// Unregister all the asset types that we registered
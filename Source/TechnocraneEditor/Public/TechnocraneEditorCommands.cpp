@@ -12,6 +12,10 @@
 void FTechnocraneEditorCommands::RegisterCommands()
 {
 	UI_COMMAND(PluginAction, "TechnocraneEditor", "Add Tracker to a camera", EUserInterfaceActionType::Button, FInputChord());
+	UI_COMMAND(AnalyzeCraneShot, "Analyze Crane Shot", "Check that a Technocrane Rig can follow the selected Sequencer camera binding over the whole shot", EUserInterfaceActionType::Button, FInputChord());
+	UI_COMMAND(BakeCranePoseCache, "Bake Crane Pose Cache", "Bake Technocrane Rig poses for the selected Sequencer camera binding, for fast scrubbing and playback of the shot", EUserInterfaceActionType::Button, FInputChord());
+	UI_COMMAND(OptimizeCraneTrackLayout, "Optimize Crane Track Layout", "Place the Technocrane Rig and key its track position to follow the selected Sequencer camera binding with the largest margin to crane limits", EUserInterfaceActionType::Button, FInputChord());
+	UI_COMMAND(RecordCraneTake, "Record Crane Take", "Record the selected Technocrane Camera into a Technocrane Take track of the opened level sequence, click again to stop", EUserInterfaceActionType::ToggleButton, FInputChord());
 }
 
 #undef LOCTEXT_NAMESPACE // "TechnocraneEditor"
\ No newline at end of file
@@ -21,4 +21,8 @@ public:
 
 public:
 	TSharedPtr<FUICommandInfo> PluginAction;
+	TSharedPtr<FUICommandInfo> AnalyzeCraneShot;
+	TSharedPtr<FUICommandInfo> BakeCranePoseCache;
+	TSharedPtr<FUICommandInfo> OptimizeCraneTrackLayout;
+	TSharedPtr<FUICommandInfo> RecordCraneTake;
 };
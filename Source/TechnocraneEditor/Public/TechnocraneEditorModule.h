@@ -28,6 +28,8 @@ protected:
 
 	void AddToolbarExtension(FToolBarBuilder& Builder);
 
+	void RegisterMenus();
+
 	TSharedPtr<class FUICommandList> PluginCommands;
 	TSharedRef<SWidget> FillComboButton(TSharedPtr<class FUICommandList> Commands);
 };
@@ -54,7 +54,13 @@ namespace UnrealBuildTool.Rules
                     "Engine",
                     "Slate",
                     "SlateCore",
-                    "TechnocranePlugin"
+                    "ToolMenus",
+                    "LevelSequence",
+                    "LevelSequenceEditor",
+                    "MovieScene",
+                    "MovieSceneTracks",
+                    "TechnocranePlugin",
+                    "TechnocraneKinematics"
                 }
             );
         }
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClearance.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneClearance.h"
+
+namespace NCraneRigClearance
+{
+	/** shorter segments are covered by neighbour capsules */
+	constexpr float MinSegmentLength = 1.0f;
+
+	void AddChain(const FCraneRigGeometry& Geometry, const FCraneRigPose& Pose, TArrayView<const int32> Chain, const float Radius,
+		TArray<FCraneClearanceCapsule, TFixedAllocator<FCraneRigClearance::MaxCapsules>>& OutCapsules)
+	{
+		int32 PrevJoint = INDEX_NONE;
+
+		for (const int32 Joint : Chain)
+		{
+			if (!Geometry.HasJoint(Joint))
+			{
+				continue;
+			}
+
+			if (PrevJoint != INDEX_NONE)
+			{
+				FCraneClearanceCapsule Capsule;
+				Capsule.Start = Pose.ComponentSpace[PrevJoint].GetLocation();
+				Capsule.End = Pose.ComponentSpace[Joint].GetLocation();
+				Capsule.Radius = Radius;
+				Capsule.Joint = PrevJoint;
+
+				if (FVector::DistSquared(Capsule.Start, Capsule.End) > FMath::Square(MinSegmentLength) && OutCapsules.Num() < FCraneRigClearance::MaxCapsules)
+				{
+					OutCapsules.Add(Capsule);
+				}
+			}
+			PrevJoint = Joint;
+		}
+	}
+};
+
+void FCraneRigClearance::MakeCapsules(const FCraneRigGeometry& Geometry, const FCraneRigPose& Pose, const FCraneClearanceRadii& Radii, TArray<FCraneClearanceCapsule, TFixedAllocator<MaxCapsules>>& OutCapsules)
+{
+	using namespace ECraneKinematicsJoint;
+
+	static const int32 ColumnChain[] = { Columns, Column1, Column2, Column3, Beams };
+	static const int32 BeamChain[] = { Beams, Beam1, Beam2, Beam3, Beam4, Beam5, Gravity };
+	static const int32 HeadChain[] = { Gravity, Neck, Head };
+
+	OutCapsules.Reset();
+
+	NCraneRigClearance::AddChain(Geometry, Pose, ColumnChain, Radii.Column, OutCapsules);
+	NCraneRigClearance::AddChain(Geometry, Pose, BeamChain, Radii.Beam, OutCapsules);
+	NCraneRigClearance::AddChain(Geometry, Pose, HeadChain, Radii.Head, OutCapsules);
+}
@@ -0,0 +1,11 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneKinematicsModule.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, TechnocraneKinematics)
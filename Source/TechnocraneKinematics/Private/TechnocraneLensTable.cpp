@@ -0,0 +1,123 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneLensTable.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneLensTable.h"
+
+bool FCraneLensTable::Build(TArrayView<const FVector2f> Points, const int32 NumEntries)
+{
+	Reset();
+
+	TArray<FVector2f> SortedPoints(Points.GetData(), Points.Num());
+	SortedPoints.StableSort([](const FVector2f& A, const FVector2f& B) { return A.X < B.X; });
+
+	// the same encoder value twice, the last point wins
+	for (int32 i = SortedPoints.Num() - 1; i > 0; --i)
+	{
+		if (FMath::IsNearlyEqual(SortedPoints[i].X, SortedPoints[i - 1].X))
+		{
+			SortedPoints.RemoveAt(i - 1);
+		}
+	}
+
+	if (SortedPoints.Num() < 2 || NumEntries < 2)
+	{
+		return false;
+	}
+
+	// values could go up or down with the encoder, but not both ways
+	bool bIncreasing = true;
+	bool bDecreasing = true;
+	for (int32 i = 1; i < SortedPoints.Num(); ++i)
+	{
+		bIncreasing &= SortedPoints[i].Y >= SortedPoints[i - 1].Y;
+		bDecreasing &= SortedPoints[i].Y <= SortedPoints[i - 1].Y;
+	}
+
+	if (!bIncreasing && !bDecreasing)
+	{
+		return false;
+	}
+
+	EncoderMin = SortedPoints[0].X;
+	EncoderMax = SortedPoints.Last().X;
+	InvStep = static_cast<float>(NumEntries - 1) / (EncoderMax - EncoderMin);
+
+	Values.SetNumUninitialized(NumEntries + 1);
+
+	// walk both the table and the points, entries are sorted as well
+	int32 Segment = 0;
+	for (int32 i = 0; i < NumEntries; ++i)
+	{
+		const float Encoder = EncoderMin + static_cast<float>(i) / InvStep;
+
+		while (Segment < SortedPoints.Num() - 2 && Encoder > SortedPoints[Segment + 1].X)
+		{
+			++Segment;
+		}
+
+		const FVector2f& A = SortedPoints[Segment];
+		const FVector2f& B = SortedPoints[Segment + 1];
+		const float Alpha = FMath::Clamp((Encoder - A.X) / (B.X - A.X), 0.0f, 1.0f);
+
+		Values[i] = FMath::Lerp(A.Y, B.Y, Alpha);
+	}
+
+	Values[NumEntries] = Values[NumEntries - 1];
+	return true;
+}
+
+void FCraneLensTable::Evaluate(TArrayView<const float> Encoders, TArrayView<float> OutValues) const
+{
+	check(Encoders.Num() == OutValues.Num());
+
+	if (!IsValid())
+	{
+		return;
+	}
+
+	const int32 NumValues = Encoders.Num();
+	const float* Input = Encoders.GetData();
+	float* Output = OutValues.GetData();
+	const float* Table = Values.GetData();
+
+	const VectorRegister4Float Min = VectorSetFloat1(EncoderMin);
+	const VectorRegister4Float Scale = VectorSetFloat1(InvStep);
+	const VectorRegister4Float MaxPosition = VectorSetFloat1(static_cast<float>(Values.Num() - 2));
+
+	int32 i = 0;
+	for (; i + 4 <= NumValues; i += 4)
+	{
+		VectorRegister4Float Position = VectorMultiply(VectorSubtract(VectorLoad(Input + i), Min), Scale);
+		Position = VectorMin(VectorMax(Position, GlobalVectorConstants::FloatZero), MaxPosition);
+
+		const VectorRegister4Float Floor = VectorFloor(Position);
+		const VectorRegister4Float Alpha = VectorSubtract(Position, Floor);
+
+		alignas(16) float Indices[4];
+		alignas(16) float Lower[4];
+		alignas(16) float Upper[4];
+		VectorStoreAligned(Floor, Indices);
+
+		// there is no gather, neighbour entries are fetched one by one
+		for (int32 k = 0; k < 4; ++k)
+		{
+			const int32 Index = static_cast<int32>(Indices[k]);
+			Lower[k] = Table[Index];
+			Upper[k] = Table[Index + 1];
+		}
+
+		const VectorRegister4Float LowerValues = VectorLoadAligned(Lower);
+		const VectorRegister4Float UpperValues = VectorLoadAligned(Upper);
+
+		VectorStore(VectorMultiplyAdd(Alpha, VectorSubtract(UpperValues, LowerValues), LowerValues), Output + i);
+	}
+
+	for (; i < NumValues; ++i)
+	{
+		Output[i] = Evaluate(Input[i]);
+	}
+}
@@ -0,0 +1,196 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneReachField.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneReachField.h"
+#include "TechnocraneStats.h"
+
+#include "Async/ParallelFor.h"
+#include "Misc/Crc.h"
+
+DECLARE_CYCLE_STAT(TEXT("Technocrane Reach Field Build"), STAT_TechnocraneReachFieldBuild, STATGROUP_Technocrane);
+
+namespace NTechnocraneReachFieldInternal
+{
+	// extra cells around the reachable volume, so that the interpolation near limits stays inside the grid
+	constexpr int32 PaddingCells = 2;
+
+	enum : int32
+	{
+		ArchiveVersionInitial = 1,
+		ArchiveVersionSourceHash,
+		ArchiveVersionLatest = ArchiveVersionSourceHash
+	};
+};
+
+void FCraneReachField::Build(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const float InCellSize)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneReachFieldBuild);
+
+	Reset();
+
+	if (!Geometry.IsValid() || InCellSize <= KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	CellSize = InCellSize;
+	SourceHash = GetSourceHash(Geometry, Preset);
+
+	// the beams pivot bounds the reachable volume
+	FCraneRigReach Reach;
+	FCraneRigSolver::ComputeReach(Geometry, Preset, FVector::ForwardVector, 0.0f, Reach);
+
+	const float Padding = NTechnocraneReachFieldInternal::PaddingCells * CellSize;
+	const float MaxRadius = Reach.BeamsPivot.Size2D() + Geometry.MaxExtension + Padding;
+	const float MaxHeight = Reach.BeamsPivot.Z + Geometry.MaxExtension + Padding;
+
+	MinHeight = Reach.BeamsPivot.Z - Geometry.MaxExtension - Geometry.DistCamHeadAndNeck - Padding;
+	NumRadial = FMath::CeilToInt(MaxRadius / CellSize) + 1;
+	NumHeight = FMath::CeilToInt((MaxHeight - MinHeight) / CellSize) + 1;
+
+	TArray<float> RawMargins;
+	RawMargins.SetNumUninitialized(NumRadial * NumHeight);
+
+	ParallelFor(NumHeight, [this, &Geometry, &Preset, &RawMargins](const int32 Row)
+	{
+		FCraneRigReach RowReach;
+		const float Height = MinHeight + Row * CellSize;
+
+		for (int32 i = 0; i < NumRadial; ++i)
+		{
+			FCraneRigSolver::ComputeReach(Geometry, Preset, FVector(i * CellSize, 0.0f, Height), 0.0f, RowReach);
+			RawMargins[Row * NumRadial + i] = RowReach.Margin;
+		}
+	});
+
+	float MaxAbsMargin = 0.0f;
+	for (const float Margin : RawMargins)
+	{
+		MaxAbsMargin = FMath::Max(MaxAbsMargin, FMath::Abs(Margin));
+	}
+
+	MarginStep = FMath::Max(MaxAbsMargin / MAX_int16, 0.01f);
+
+	Margins.SetNumUninitialized(RawMargins.Num());
+	for (int32 i = 0; i < RawMargins.Num(); ++i)
+	{
+		Margins[i] = static_cast<int16>(FMath::Clamp(FMath::RoundToInt(RawMargins[i] / MarginStep), -MAX_int16, MAX_int16));
+	}
+}
+
+uint32 FCraneReachField::GetSourceHash(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset)
+{
+	if (!Geometry.IsValid())
+	{
+		return 0;
+	}
+
+	FCraneRigReach Reach;
+	FCraneRigSolver::ComputeReach(Geometry, Preset, FVector::ForwardVector, 0.0f, Reach);
+
+	const float Values[] = {
+		Preset.ZOffsetOnGround, Preset.TiltMin, Preset.TiltMax,
+		Geometry.DistCamHeadAndNeck, Geometry.GravityOffsetLen, Geometry.Beam1Length,
+		Geometry.BeamMaxLength[0], Geometry.BeamMaxLength[1], Geometry.BeamMaxLength[2], Geometry.BeamMaxLength[3],
+		Geometry.MinExtension, Geometry.MaxExtension,
+		static_cast<float>(Reach.BeamsPivot.X), static_cast<float>(Reach.BeamsPivot.Y), static_cast<float>(Reach.BeamsPivot.Z)
+	};
+
+	return FCrc::MemCrc32(Values, sizeof(Values));
+}
+
+float FCraneReachField::Sample(const float Radius, const float Height) const
+{
+	const float U = Radius / CellSize;
+	const float V = (Height - MinHeight) / CellSize;
+
+	const float ClampedU = FMath::Clamp(U, 0.0f, static_cast<float>(NumRadial - 1));
+	const float ClampedV = FMath::Clamp(V, 0.0f, static_cast<float>(NumHeight - 1));
+
+	const int32 X0 = FMath::Min(static_cast<int32>(ClampedU), NumRadial - 2);
+	const int32 Y0 = FMath::Min(static_cast<int32>(ClampedV), NumHeight - 2);
+	const float Fx = ClampedU - X0;
+	const float Fy = ClampedV - Y0;
+
+	const int16* Row0 = Margins.GetData() + Y0 * NumRadial + X0;
+	const int16* Row1 = Row0 + NumRadial;
+
+	const float Bottom = FMath::Lerp(static_cast<float>(Row0[0]), static_cast<float>(Row0[1]), Fx);
+	const float Top = FMath::Lerp(static_cast<float>(Row1[0]), static_cast<float>(Row1[1]), Fx);
+	const float Margin = FMath::Lerp(Bottom, Top, Fy) * MarginStep;
+
+	// outside of the grid everything is out of reach, keep going down with a distance to the grid
+	const float OutsideDist = FMath::Sqrt(FMath::Square(U - ClampedU) + FMath::Square(V - ClampedV)) * CellSize;
+	return Margin - OutsideDist;
+}
+
+float FCraneReachField::GetMargin(const FVector& Position, const float TrackPosition) const
+{
+	if (!IsValid())
+	{
+		return 0.0f;
+	}
+
+	const float Radius = FMath::Sqrt(FMath::Square(Position.X) + FMath::Square(Position.Y - TrackPosition));
+	return Sample(Radius, Position.Z);
+}
+
+void FCraneReachField::GetMargins(TArrayView<const FVector> Positions, const float TrackPosition, TArrayView<float> OutMargins) const
+{
+	check(Positions.Num() == OutMargins.Num());
+
+	if (!IsValid())
+	{
+		for (float& Margin : OutMargins)
+		{
+			Margin = 0.0f;
+		}
+		return;
+	}
+
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		const FVector& Position = Positions[i];
+		const float Radius = FMath::Sqrt(FMath::Square(Position.X) + FMath::Square(Position.Y - TrackPosition));
+		OutMargins[i] = Sample(Radius, Position.Z);
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FCraneReachField& Field)
+{
+	using namespace NTechnocraneReachFieldInternal;
+
+	int32 Version = ArchiveVersionLatest;
+	Ar << Version;
+
+	// a layout of a newer version can't be read, the field has to be built again
+	if (Ar.IsLoading() && (Version < ArchiveVersionInitial || Version > ArchiveVersionLatest))
+	{
+		Ar.SetError();
+		Field.Reset();
+		return Ar;
+	}
+
+	Ar << Field.CellSize;
+	Ar << Field.MinHeight;
+	Ar << Field.NumRadial;
+	Ar << Field.NumHeight;
+	Ar << Field.MarginStep;
+	Ar << Field.Margins;
+
+	// a field of the initial version doesn't know its kinematics and never matches a preset
+	if (Version >= ArchiveVersionSourceHash)
+	{
+		Ar << Field.SourceHash;
+	}
+	else
+	{
+		Field.SourceHash = 0;
+	}
+
+	return Ar;
+}
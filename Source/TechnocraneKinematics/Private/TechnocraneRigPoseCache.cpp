@@ -0,0 +1,84 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneRigPoseCache.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneRigPoseCache.h"
+#include "TechnocraneStats.h"
+
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Technocrane Pose Cache Build"), STAT_TechnocranePoseCacheBuild, STATGROUP_Technocrane);
+
+void FCraneRigPoseCache::Build(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, TArrayView<const FCraneRigSolverInput> Inputs, const FFrameRate InFrameRate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TechnocranePoseCacheBuild);
+
+	Reset();
+
+	if (!Geometry.IsValid() || Inputs.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 NumFrames = Inputs.Num();
+	FrameRate = InFrameRate;
+
+	Rotations.SetNumUninitialized(NumFrames * JointCount);
+	Translations.SetNumUninitialized(NumFrames * JointCount);
+	Frames.SetNumUninitialized(NumFrames);
+
+	// frames are independent, every frame writes its own range of entries
+	ParallelFor(NumFrames, [this, &Geometry, &Preset, Inputs](const int32 FrameIndex)
+	{
+		const FCraneRigSolverInput& Input = Inputs[FrameIndex];
+
+		FCraneRigSolution Solution;
+		FCraneRigSolver::Solve(Geometry, Preset, Input, Solution);
+
+		FCraneRigPose Pose;
+		FCraneRigSolver::BuildPose(Geometry, Preset, Input.TrackPosition, Solution, Pose);
+
+		const int32 Offset = FrameIndex * JointCount;
+		for (int32 i = 0; i < JointCount; ++i)
+		{
+			Rotations[Offset + i] = FQuat4f(Pose.ComponentSpace[i].GetRotation());
+			Translations[Offset + i] = FVector3f(Pose.ComponentSpace[i].GetLocation());
+		}
+
+		FFrame& Frame = Frames[FrameIndex];
+		Frame.GroundHeight = Solution.GroundHeight;
+		Frame.TiltAngle = Solution.TiltAngle;
+		Frame.ExtensionLength = Solution.ExtensionLength;
+	});
+}
+
+void FCraneRigPoseCache::Evaluate(const double Seconds, FCraneRigPose& OutPose, FCraneRigSolution& OutSolution) const
+{
+	check(IsValid());
+
+	const double Position = FMath::Clamp(Seconds * FrameRate.AsDecimal(), 0.0, static_cast<double>(Frames.Num() - 1));
+	const int32 Index = static_cast<int32>(Position);
+	const int32 NextIndex = FMath::Min(Index + 1, Frames.Num() - 1);
+	const float Alpha = static_cast<float>(Position - static_cast<double>(Index));
+
+	const int32 Offset = Index * JointCount;
+	const int32 NextOffset = NextIndex * JointCount;
+
+	for (int32 i = 0; i < JointCount; ++i)
+	{
+		const FQuat4f Rotation = FQuat4f::Slerp(Rotations[Offset + i], Rotations[NextOffset + i], Alpha);
+		const FVector3f Translation = FMath::Lerp(Translations[Offset + i], Translations[NextOffset + i], Alpha);
+
+		OutPose.ComponentSpace[i] = FTransform(FQuat(Rotation), FVector(Translation));
+	}
+
+	const FFrame& Frame = Frames[Index];
+	const FFrame& NextFrame = Frames[NextIndex];
+
+	OutSolution.GroundHeight = FMath::Lerp(Frame.GroundHeight, NextFrame.GroundHeight, Alpha);
+	OutSolution.TiltAngle = FMath::Lerp(Frame.TiltAngle, NextFrame.TiltAngle, Alpha);
+	OutSolution.ExtensionLength = FMath::Lerp(Frame.ExtensionLength, NextFrame.ExtensionLength, Alpha);
+}
@@ -0,0 +1,967 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneRigSolver.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneRigSolver.h"
+#include "TechnocraneStats.h"
+
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Technocrane Rig Batch Solve"), STAT_TechnocraneRigBatch, STATGROUP_Technocrane);
+
+namespace NTechnocraneRigSolverInternal
+{
+	enum : int32
+	{
+		ArchiveVersionInitial = 1,
+		ArchiveVersionLatest = ArchiveVersionInitial
+	};
+
+	constexpr int32 Beam2Index = ECraneKinematicsJoint::Beam2;
+	constexpr int32 Beam5Index = ECraneKinematicsJoint::Beam5;
+
+	// the shortest position of an extension beam relative to its reference
+	constexpr float BeamMinAdjustment{ -2.0f };
+
+	// Beam structure to hold individual beam properties
+	struct FBeamData
+	{
+		float CurrentLength{ 0.0f };
+		float MinLength{ 0.0f };        // Absolute minimum length the beam can have
+		float MaxLength{ 0.0f };        // Absolute maximum length the beam can have
+		float Adjustment{ 0.0f };       // Output: how much to adjust this beam (+/- value)
+		int32 Joint{ INDEX_NONE };
+
+		FBeamData() = default;
+		FBeamData(float Current, float Min, float Max, int32 InJoint)
+			: CurrentLength(Current), MinLength(Min), MaxLength(Max), Adjustment(0.0f), Joint(InJoint) {}
+
+		float GetAdjustedLength() const { return CurrentLength + Adjustment; }
+	};
+
+	// Alternative algorithm: Equal distribution with overflow handling
+	void CalculateBeamAdjustmentsEqual(TArrayView<FBeamData> Beams, float TargetLength, float BaseBeamLength)
+	{
+		if (Beams.IsEmpty())
+			return;
+
+		const float RequiredAdjustment = TargetLength - BaseBeamLength;
+		const float AdjustmentPerBeam = RequiredAdjustment / Beams.Num();
+		float RemainingAdjustment = RequiredAdjustment;
+
+		// Reset all adjustments
+		for (FBeamData& Beam : Beams)
+		{
+			Beam.Adjustment = 0.0f;
+		}
+
+		if (FMath::IsNearlyZero(RequiredAdjustment))
+		{
+			return; // Already at target, no adjustments needed
+		}
+
+		// First pass: try to distribute equally
+		for (FBeamData& Beam : Beams)
+		{
+			const float ClampedAdjustment = FMath::Clamp(AdjustmentPerBeam, Beam.MinLength, Beam.MaxLength);
+
+			Beam.Adjustment = ClampedAdjustment;
+			RemainingAdjustment -= ClampedAdjustment;
+		}
+
+		constexpr float Thres{ 0.001f };
+
+		// Second pass: distribute remaining adjustment to beams that can still accommodate it
+		while (!FMath::IsNearlyZero(RemainingAdjustment) && FMath::Abs(RemainingAdjustment) > Thres)
+		{
+			int32 AvailableBeams = 0;
+
+			// Count beams that can still be adjusted
+			for (const FBeamData& Beam : Beams)
+			{
+				if (RemainingAdjustment > 0.0f && Beam.GetAdjustedLength() < Beam.MaxLength - Thres)
+				{
+					AvailableBeams++;
+				}
+				else if (RemainingAdjustment < 0.0f && Beam.GetAdjustedLength() > Beam.MinLength + Thres)
+				{
+					AvailableBeams++;
+				}
+			}
+
+			if (AvailableBeams == 0) break;
+
+			const float AdjustmentPerAvailableBeam = RemainingAdjustment / AvailableBeams;
+			const float OldRemainingAdjustment = RemainingAdjustment;
+
+			for (FBeamData& Beam : Beams)
+			{
+				const bool CanAdjust = RemainingAdjustment > 0.0f
+					&& (Beam.GetAdjustedLength() < Beam.MaxLength - Thres || Beam.GetAdjustedLength() > Beam.MinLength + Thres);
+
+				if (CanAdjust)
+				{
+					const float AdditionalAdjustment = FMath::Clamp(AdjustmentPerAvailableBeam, Beam.MinLength, Beam.MaxLength);
+
+					Beam.Adjustment += AdditionalAdjustment;
+					RemainingAdjustment -= AdditionalAdjustment;
+				}
+			}
+
+			// Prevent infinite loop
+			if (FMath::Abs(RemainingAdjustment - OldRemainingAdjustment) < 0.001f)
+			{
+				break;
+			}
+		}
+	}
+
+	// beams Beam2..Beam5 that have to reach a target length, BeamLengths are distances of beams from the component origin
+	void DistributeBeams(const FCraneRigGeometry& Geometry, const float(&BeamLengths)[TECHNOCRANE_EXTENSION_BEAMS_COUNT], const float TargetLength, FCraneRigSolution& OutSolution)
+	{
+		FBeamData BeamData[TECHNOCRANE_EXTENSION_BEAMS_COUNT];
+		int32 NumBeams = 0;
+
+		for (int32 i = Beam2Index; i <= Beam5Index; ++i)
+		{
+			if (!Geometry.bHasJoint[i])
+				continue;
+
+			BeamData[NumBeams++] = FBeamData(BeamLengths[i - Beam2Index], BeamMinAdjustment, Geometry.BeamMaxLength[i - Beam2Index], i);
+		}
+
+		CalculateBeamAdjustmentsEqual(MakeArrayView(BeamData, NumBeams), TargetLength - Geometry.GravityOffsetLen, Geometry.Beam1Length);
+
+		for (int32 i = 0; i < NumBeams; ++i)
+		{
+			OutSolution.BeamAdjustment[BeamData[i].Joint - Beam2Index] = BeamData[i].Adjustment;
+		}
+		OutSolution.bBeamsAdjusted = true;
+	}
+
+	float GetSignedAngle(const FVector& RefNormalX, const FVector& RefNormalY, const FVector& RefTangent)
+	{
+		const FVector CrossProduct = FVector::CrossProduct(RefNormalX, RefNormalY);
+		const float PositiveAngle = atan2(CrossProduct.Length(), FVector::DotProduct(RefNormalX, RefNormalY));
+		return (FVector::DotProduct(RefTangent, CrossProduct) < 0.0) ? -PositiveAngle : PositiveAngle;
+	}
+
+	// beams tilt to look at a target, not clamped by preset limits
+	float ComputeTiltAngle(const FCraneRigGeometry& Geometry, const FVector& Target, const FVector& BeamsPos, const FVector& ColumnForward)
+	{
+		FVector DirToCam = FVector(Target.X, Target.Y, Target.Z + Geometry.DistCamHeadAndNeck) - BeamsPos;
+		DirToCam.Normalize();
+
+		const FVector TargetNorm = (Target - BeamsPos).GetSafeNormal2D();
+
+		return FMath::RadiansToDegrees(GetSignedAngle(DirToCam, TargetNorm, ColumnForward));
+	}
+
+	FORCEINLINE FTransform GetParentTransform(const FCraneRigGeometry& Geometry, const int32 Joint, const FTransform* ComponentSpace)
+	{
+		const int32 ParentJoint = Geometry.ParentJoint[Joint];
+		return (ParentJoint != INDEX_NONE) ? Geometry.ParentOffset[Joint] * ComponentSpace[ParentJoint] : Geometry.ParentOffset[Joint];
+	}
+
+	// walk presented joints in a hierarchy order and compute component space transforms
+	//  when SolveForTarget is given, column yaw and beams tilt are solved on the way
+	//  bApplyFullSolution also applies beams extension, gravity counter rotation and neck/head
+	void EvaluateChain(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const float TrackPosition, const FVector* SolveForTarget,
+		FCraneRigSolution& Solution, const bool bApplyFullSolution, FTransform* ComponentSpace)
+	{
+		const int32 ColumnJoint = Geometry.ColumnRotationBone;
+
+		// head position is resolved before the neck gets its rotation
+		FTransform NeckInRefOrientation = FTransform::Identity;
+
+		for (int32 i = 0; i < Geometry.NumJoints; ++i)
+		{
+			const int32 Joint = Geometry.JointOrder[i];
+
+			FTransform ParentTM;
+			if (Joint == ECraneKinematicsJoint::Head && bApplyFullSolution && Geometry.ParentJoint[Joint] == ECraneKinematicsJoint::Neck)
+			{
+				ParentTM = Geometry.ParentOffset[Joint] * NeckInRefOrientation;
+			}
+			else
+			{
+				ParentTM = GetParentTransform(Geometry, Joint, ComponentSpace);
+			}
+
+			FTransform TM = Geometry.RefLocal[Joint] * ParentTM;
+
+			if (Joint == ECraneKinematicsJoint::Base)
+			{
+				// make it appear in the right place
+				TM.SetLocation(FVector(0.0f, TrackPosition, Preset.ZOffsetOnGround));
+			}
+
+			if (Joint == ColumnJoint)
+			{
+				//
+				// rotate around UP
+
+				if (SolveForTarget)
+				{
+					// signed angle between forward and a target direction in the horizontal plane
+					const FVector DirInPlane = SolveForTarget->GetSafeNormal2D();
+					const double AngleRad = FMath::Atan2(DirInPlane.Y, DirInPlane.X);
+					Solution.ColumnYaw = 90.0 + FMath::RadiansToDegrees(AngleRad);
+				}
+
+				FRotator ColumnRot = TM.Rotator();
+				ColumnRot.Yaw = Solution.ColumnYaw;
+				TM.SetRotation(ColumnRot.Quaternion());
+			}
+
+			if (Joint == ECraneKinematicsJoint::Beams)
+			{
+				//
+				// rotate beams up/down
+
+				if (SolveForTarget)
+				{
+					const FVector ColumnForward = ComponentSpace[ColumnJoint].GetRotation().GetForwardVector();
+					const float Angle = ComputeTiltAngle(Geometry, *SolveForTarget, TM.GetLocation(), ColumnForward);
+
+					Solution.TiltAngle = FMath::Clamp(Angle, -Preset.TiltMin, Preset.TiltMax);
+				}
+
+				FRotator BeamsRot = TM.Rotator();
+				BeamsRot.Roll = 90.0 + Solution.TiltAngle;
+				TM.SetRotation(BeamsRot.Quaternion());
+			}
+
+			if (bApplyFullSolution)
+			{
+				if (Joint >= Beam2Index && Joint <= Beam5Index)
+				{
+					if (Solution.bBeamsAdjusted)
+					{
+						// beams are sliding along the local Z axis
+						FTransform LocalTM = Geometry.RefLocal[Joint];
+						FVector Tr = LocalTM.GetLocation();
+						Tr.Z = -Solution.BeamAdjustment[Joint - Beam2Index];
+						LocalTM.SetLocation(Tr);
+
+						TM = LocalTM * ParentTM;
+					}
+				}
+				else if (Joint == ECraneKinematicsJoint::Gravity)
+				{
+					FTransform LocalTM = Geometry.RefLocal[Joint];
+					LocalTM.SetRotation(Solution.GravityRotation);
+
+					TM = LocalTM * ParentTM;
+				}
+				else if (Joint == ECraneKinematicsJoint::Neck)
+				{
+					NeckInRefOrientation = TM;
+					TM.SetRotation(Solution.NeckRotation);
+				}
+				else if (Joint == ECraneKinematicsJoint::Head)
+				{
+					TM.SetRotation(Solution.HeadRotation);
+				}
+			}
+
+			ComponentSpace[Joint] = TM;
+		}
+	}
+};
+
+/////////////////////////////////////////////////////////////////////////////////////
+// FCraneRigGeometry
+
+FCraneRigGeometry::FCraneRigGeometry()
+{
+	for (int32 i = 0; i < JointCount; ++i)
+	{
+		JointOrder[i] = INDEX_NONE;
+		RefBoneIndex[i] = INDEX_NONE;
+		ParentJoint[i] = INDEX_NONE;
+	}
+}
+
+bool FCraneRigGeometry::Build(TArrayView<const FTransform> RefPose, TArrayView<const int32> ParentIndices, const int32(&JointBoneIndices)[JointCount], const int32 InColumnRotationBone)
+{
+	*this = FCraneRigGeometry();
+
+	check(RefPose.Num() == ParentIndices.Num());
+
+	ColumnRotationBone = InColumnRotationBone;
+
+	for (int32 i = 0; i < JointCount; ++i)
+	{
+		const int32 JointRefIndex = JointBoneIndices[i];
+
+		if (RefPose.IsValidIndex(JointRefIndex))
+		{
+			RefBoneIndex[i] = JointRefIndex;
+			RefLocal[i] = RefPose[JointRefIndex];
+			bHasJoint[i] = true;
+
+			JointOrder[NumJoints++] = i;
+		}
+	}
+
+	// in a reference skeleton a parent bone always goes before its children
+	Algo::Sort(MakeArrayView(JointOrder, NumJoints), [this](const int32 A, const int32 B)
+	{
+		return RefBoneIndex[A] < RefBoneIndex[B];
+	});
+
+	auto FindJointByRefIndex = [this](const int32 InRefIndex) -> int32
+	{
+		for (int32 i = 0; i < JointCount; ++i)
+		{
+			if (bHasJoint[i] && RefBoneIndex[i] == InRefIndex)
+			{
+				return i;
+			}
+		}
+		return INDEX_NONE;
+	};
+
+	for (int32 i = 0; i < NumJoints; ++i)
+	{
+		const int32 Joint = JointOrder[i];
+
+		// accumulate bones that are not crane joints up to the closest crane joint
+		FTransform Offset = FTransform::Identity;
+		int32 ParentRefIndex = ParentIndices[RefBoneIndex[Joint]];
+
+		while (ParentRefIndex != INDEX_NONE)
+		{
+			const int32 Parent = FindJointByRefIndex(ParentRefIndex);
+			if (Parent != INDEX_NONE)
+			{
+				ParentJoint[Joint] = Parent;
+				break;
+			}
+
+			Offset = Offset * RefPose[ParentRefIndex];
+			ParentRefIndex = ParentIndices[ParentRefIndex];
+		}
+
+		ParentOffset[Joint] = Offset;
+	}
+
+	bIsValid = HasJoint(ECraneKinematicsJoint::Base) && HasJoint(ColumnRotationBone) && HasJoint(ECraneKinematicsJoint::Beams)
+		&& HasJoint(ECraneKinematicsJoint::Gravity) && HasJoint(ECraneKinematicsJoint::Neck) && HasJoint(ECraneKinematicsJoint::Head);
+
+	if (!bIsValid)
+	{
+		return false;
+	}
+
+	const FVector GravityLocal = RefLocal[ECraneKinematicsJoint::Gravity].GetLocation();
+	const float GravityPivotZ = GravityLocal.Y;
+	GravityOffsetLen = FMath::Sqrt(FMath::Square(GravityLocal.X) + FMath::Square(GravityLocal.Z)); // length in a horizontal plane
+	const float NeckPivotZ = RefLocal[ECraneKinematicsJoint::Neck].GetLocation().Length();
+	const float CameraPivotZ = RefLocal[ECraneKinematicsJoint::Head].GetLocation().Length();
+
+	DistCamHeadAndNeck = FMath::Abs(GravityPivotZ) + FMath::Abs(CameraPivotZ) + FMath::Abs(NeckPivotZ);
+
+	if (HasJoint(ECraneKinematicsJoint::Beam1))
+	{
+		Beam1Length = RefLocal[ECraneKinematicsJoint::Beam1].GetLocation().Length();
+	}
+
+	MinExtension = MaxExtension = Beam1Length + GravityOffsetLen;
+
+	for (int32 i = NTechnocraneRigSolverInternal::Beam2Index; i <= NTechnocraneRigSolverInternal::Beam5Index; ++i)
+	{
+		BeamMaxLength[i - NTechnocraneRigSolverInternal::Beam2Index] = (bHasJoint[i]) ? RefLocal[i].GetLocation().Length() : 0.0f;
+
+		if (bHasJoint[i])
+		{
+			MinExtension += NTechnocraneRigSolverInternal::BeamMinAdjustment;
+			MaxExtension += BeamMaxLength[i - NTechnocraneRigSolverInternal::Beam2Index];
+		}
+	}
+
+	return true;
+}
+
+FArchive& operator<<(FArchive& Ar, FCraneRigGeometry& Geometry)
+{
+	using namespace NTechnocraneRigSolverInternal;
+
+	int32 Version = ArchiveVersionLatest;
+	Ar << Version;
+
+	// a layout of a newer version can't be read, geometry has to be derived from the crane model again
+	if (Ar.IsLoading() && (Version < ArchiveVersionInitial || Version > ArchiveVersionLatest))
+	{
+		Ar.SetError();
+		Geometry = FCraneRigGeometry();
+		return Ar;
+	}
+
+	int32 JointCount = FCraneRigGeometry::JointCount;
+	Ar << JointCount;
+
+	if (Ar.IsLoading() && JointCount != FCraneRigGeometry::JointCount)
+	{
+		Ar.SetError();
+		Geometry = FCraneRigGeometry();
+		return Ar;
+	}
+
+	Ar << Geometry.bIsValid;
+	Ar << Geometry.NumJoints;
+
+	for (int32 i = 0; i < FCraneRigGeometry::JointCount; ++i)
+	{
+		Ar << Geometry.JointOrder[i];
+		Ar << Geometry.bHasJoint[i];
+		Ar << Geometry.RefBoneIndex[i];
+		Ar << Geometry.ParentJoint[i];
+		Ar << Geometry.ParentOffset[i];
+		Ar << Geometry.RefLocal[i];
+	}
+
+	Ar << Geometry.ColumnRotationBone;
+	Ar << Geometry.DistCamHeadAndNeck;
+	Ar << Geometry.GravityOffsetLen;
+	Ar << Geometry.Beam1Length;
+
+	for (float& BeamLength : Geometry.BeamMaxLength)
+	{
+		Ar << BeamLength;
+	}
+
+	Ar << Geometry.MinExtension;
+	Ar << Geometry.MaxExtension;
+
+	return Ar;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+// FCraneRigSolver
+
+void FCraneRigSolver::Solve(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const FCraneRigSolverInput& Input, FCraneRigSolution& OutSolution)
+{
+	using namespace NTechnocraneRigSolverInternal;
+
+	OutSolution = FCraneRigSolution();
+
+	if (!Geometry.IsValid())
+	{
+		return;
+	}
+
+	OutSolution.GroundHeight = Input.Target.Z;
+
+	// column and beams orientation
+	FTransform ComponentSpace[FCraneRigGeometry::JointCount];
+	EvaluateChain(Geometry, Preset, Input.TrackPosition, &Input.Target, OutSolution, false, ComponentSpace);
+
+	//
+	// beams length
+
+	const int32 BeamsJoint = ECraneKinematicsJoint::Beams;
+	const FVector HeadPos = ComponentSpace[ECraneKinematicsJoint::Head].GetLocation();
+	const FVector BeamsPos = ComponentSpace[BeamsJoint].GetLocation();
+
+	// we assume crane crane beams can't be placed almost vertically and crane preset has a defined tilt min/max angles setup
+	const float CurrentLength = FVector::Dist(HeadPos, BeamsPos);
+	const FVector ProjOnBeams = Input.Target + FVector(0.0f, 0.0f, Geometry.DistCamHeadAndNeck);
+	const float TargetLength = FVector::Dist(ProjOnBeams, BeamsPos);
+	OutSolution.ExtensionLength = TargetLength;
+
+	constexpr float Thres{ 0.1f };
+	if (FMath::Abs(CurrentLength - TargetLength) > Thres)
+	{
+		float BeamLengths[TECHNOCRANE_EXTENSION_BEAMS_COUNT];
+		for (int32 i = Beam2Index; i <= Beam5Index; ++i)
+		{
+			BeamLengths[i - Beam2Index] = ComponentSpace[i].GetLocation().Length();
+		}
+
+		DistributeBeams(Geometry, BeamLengths, TargetLength, OutSolution);
+	}
+
+	//
+	// rotate gravity point, counter rotation of beams local tilt
+
+	const FTransform BeamsLocal = ComponentSpace[BeamsJoint].GetRelativeTransform(GetParentTransform(Geometry, BeamsJoint, ComponentSpace));
+	OutSolution.GravityRotation = FQuat::MakeFromEuler(-BeamsLocal.GetRotation().Euler());
+
+	//
+	// crane head and neck
+
+	OutSolution.NeckRotation = Input.NeckQ;
+	OutSolution.HeadRotation = Input.NeckQ * FQuat::MakeFromEuler(FVector(Input.RawRotation.Y, 0.0f, 0.0f));
+}
+
+void FCraneRigSolver::BuildPose(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const float TrackPosition, const FCraneRigSolution& Solution, FCraneRigPose& OutPose)
+{
+	if (!Geometry.IsValid())
+	{
+		return;
+	}
+
+	FCraneRigSolution PoseSolution(Solution);
+	NTechnocraneRigSolverInternal::EvaluateChain(Geometry, Preset, TrackPosition, nullptr, PoseSolution, true, OutPose.ComponentSpace);
+}
+
+void FCraneRigSolver::ComputeReach(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const FVector& Target, const float TrackPosition, FCraneRigReach& OutReach)
+{
+	using namespace NTechnocraneRigSolverInternal;
+
+	OutReach = FCraneRigReach();
+
+	if (!Geometry.IsValid())
+	{
+		return;
+	}
+
+	FCraneRigSolution Solution;
+	FTransform ComponentSpace[FCraneRigGeometry::JointCount];
+	EvaluateChain(Geometry, Preset, TrackPosition, &Target, Solution, false, ComponentSpace);
+
+	OutReach.ColumnYaw = Solution.ColumnYaw;
+	OutReach.BeamsPivot = ComponentSpace[ECraneKinematicsJoint::Beams].GetLocation();
+
+	const FVector ColumnForward = ComponentSpace[Geometry.ColumnRotationBone].GetRotation().GetForwardVector();
+	OutReach.TiltAngle = ComputeTiltAngle(Geometry, Target, OutReach.BeamsPivot, ColumnForward);
+
+	const FVector ProjOnBeams = Target + FVector(0.0f, 0.0f, Geometry.DistCamHeadAndNeck);
+	OutReach.ExtensionLength = FVector::Dist(ProjOnBeams, OutReach.BeamsPivot);
+
+	// tilt limits are measured as an arc length at the current extension, so every margin is in cm
+	const float ArcScale = FMath::DegreesToRadians(OutReach.ExtensionLength);
+
+	OutReach.Margin = FMath::Min(
+		FMath::Min(OutReach.ExtensionLength - Geometry.MinExtension, Geometry.MaxExtension - OutReach.ExtensionLength),
+		FMath::Min((OutReach.TiltAngle + Preset.TiltMin) * ArcScale, (Preset.TiltMax - OutReach.TiltAngle) * ArcScale));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+// FCraneRigLaneGeometry
+
+void FCraneRigLaneGeometry::Build(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset)
+{
+	using namespace NTechnocraneRigSolverInternal;
+
+	*this = FCraneRigLaneGeometry();
+
+	if (!Geometry.IsValid())
+	{
+		return;
+	}
+
+	// a chain with zero yaw and tilt at a zero track position
+	FCraneRigSolution Solution;
+	FTransform ComponentSpace[FCraneRigGeometry::JointCount];
+	EvaluateChain(Geometry, Preset, 0.0f, nullptr, Solution, false, ComponentSpace);
+
+	const int32 BeamsJoint = ECraneKinematicsJoint::Beams;
+	const FTransform& ColumnTM = ComponentSpace[Geometry.ColumnRotationBone];
+	const FTransform& BeamsTM = ComponentSpace[BeamsJoint];
+
+	const FVector Column = ColumnTM.GetLocation();
+	const FVector Arm = BeamsTM.GetLocation() - Column;
+	const FVector Forward = ColumnTM.GetRotation().GetForwardVector();
+
+	ColumnX = Column.X;
+	ColumnY = Column.Y;
+	ColumnZ = Column.Z;
+	ArmX = Arm.X;
+	ArmY = Arm.Y;
+	ArmZ = Arm.Z;
+	ForwardX = Forward.X;
+	ForwardY = Forward.Y;
+
+	DistCamHeadAndNeck = Geometry.DistCamHeadAndNeck;
+	TiltMin = Preset.TiltMin;
+	TiltMax = Preset.TiltMax;
+	RefHeadDistance = FVector::Dist(ComponentSpace[ECraneKinematicsJoint::Head].GetLocation(), BeamsTM.GetLocation());
+
+	const FRotator BeamsRot = BeamsTM.Rotator();
+	BeamsPitch = BeamsRot.Pitch;
+	BeamsYaw = BeamsRot.Yaw;
+	BeamsParentInverse = GetParentTransform(Geometry, BeamsJoint, ComponentSpace).GetRotation().Inverse();
+
+	for (int32 i = Beam2Index; i <= Beam5Index; ++i)
+	{
+		BeamOffsets[i - Beam2Index] = (Geometry.bHasJoint[i])
+			? BeamsTM.GetScale3D() * BeamsTM.InverseTransformPosition(ComponentSpace[i].GetLocation())
+			: FVector::ZeroVector;
+	}
+
+	bIsValid = true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+// FCraneRigBatch
+
+namespace NTechnocraneRigBatchInternal
+{
+	constexpr int32 NumLanes = 4;
+
+	FORCEINLINE VectorRegister4Float LoadLanes(const TArray<float>& Values, const int32 First, const int32 Count)
+	{
+		if (Count == NumLanes)
+		{
+			return VectorLoad(Values.GetData() + First);
+		}
+
+		// the last group is padded with the last rig
+		alignas(16) float Padded[NumLanes];
+		for (int32 k = 0; k < NumLanes; ++k)
+		{
+			Padded[k] = Values[First + FMath::Min(k, Count - 1)];
+		}
+		return VectorLoadAligned(Padded);
+	}
+
+	FORCEINLINE void StoreLanes(const VectorRegister4Float& Lanes, TArray<float>& Values, const int32 First, const int32 Count)
+	{
+		if (Count == NumLanes)
+		{
+			VectorStore(Lanes, Values.GetData() + First);
+			return;
+		}
+
+		alignas(16) float Stored[NumLanes];
+		VectorStoreAligned(Lanes, Stored);
+		for (int32 k = 0; k < Count; ++k)
+		{
+			Values[First + k] = Stored[k];
+		}
+	}
+
+	// a batch with one preset solved both ways, the lane constants are used only when they match the solver
+	bool ValidateLanes(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const FCraneRigLaneGeometry& Lanes)
+	{
+		FCraneRigBatch Probe;
+		Probe.Geometries.Add(&Geometry);
+		Probe.Presets.Add(Preset);
+		Probe.LaneGeometries.Add(Lanes);
+
+		// targets around the crane at a few heights, distances and track positions
+		constexpr int32 NumProbes = 24;
+		Probe.SetNum(NumProbes);
+
+		FCraneRigSolverInput Input;
+		for (int32 i = 0; i < NumProbes; ++i)
+		{
+			const float Yaw = FMath::DegreesToRadians(15.0f + 37.0f * i);
+			const float Distance = 150.0f + 40.0f * (i % 5);
+			Input.Target = FVector(Distance * FMath::Cos(Yaw), Distance * FMath::Sin(Yaw), -100.0f + 30.0f * (i % 7));
+			Input.TrackPosition = 25.0f * (i % 3);
+			Input.RawRotation = FVector(0.0f, -20.0f + 3.0f * i, 0.0f);
+			Input.NeckQ = FQuat::MakeFromEuler(FVector(90.0f, 0.0f, 10.0f * i));
+			Probe.SetRig(i, 0, Input);
+		}
+
+		FCraneRigBatch Reference(Probe);
+		Probe.Solve();
+		Reference.SolveEachRig();
+
+		constexpr float AngleTolerance{ 0.01f };
+		constexpr float LengthTolerance{ 0.01f };
+		constexpr float QuatTolerance{ 1e-4f };
+
+		for (int32 i = 0; i < NumProbes; ++i)
+		{
+			FCraneRigSolution A, B;
+			Probe.GetSolution(i, A);
+			Reference.GetSolution(i, B);
+
+			bool bMatch = A.bBeamsAdjusted == B.bBeamsAdjusted
+				&& FMath::Abs(FRotator::NormalizeAxis(A.ColumnYaw - B.ColumnYaw)) < AngleTolerance
+				&& FMath::Abs(A.TiltAngle - B.TiltAngle) < AngleTolerance
+				&& FMath::Abs(A.ExtensionLength - B.ExtensionLength) < LengthTolerance
+				&& A.GravityRotation.AngularDistance(B.GravityRotation) < QuatTolerance
+				&& A.HeadRotation.AngularDistance(B.HeadRotation) < QuatTolerance;
+
+			for (int32 k = 0; k < TECHNOCRANE_EXTENSION_BEAMS_COUNT; ++k)
+			{
+				bMatch &= FMath::Abs(A.BeamAdjustment[k] - B.BeamAdjustment[k]) < LengthTolerance;
+			}
+
+			if (!bMatch)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+int32 FCraneRigBatch::AddPreset(const FCraneRigGeometry* InGeometry, const FCraneRigPreset& InPreset)
+{
+	check(InGeometry);
+
+	FCraneRigLaneGeometry Lanes;
+	Lanes.Build(*InGeometry, InPreset);
+	Lanes.bIsValid = Lanes.bIsValid && NTechnocraneRigBatchInternal::ValidateLanes(*InGeometry, InPreset, Lanes);
+
+	LaneGeometries.Add(Lanes);
+	Presets.Add(InPreset);
+	return Geometries.Add(InGeometry);
+}
+
+void FCraneRigBatch::SetNum(const int32 NumRigs)
+{
+	PresetIndex.SetNumZeroed(NumRigs);
+	TargetX.SetNumZeroed(NumRigs);
+	TargetY.SetNumZeroed(NumRigs);
+	TargetZ.SetNumZeroed(NumRigs);
+	TrackPosition.SetNumZeroed(NumRigs);
+	RawTilt.SetNumZeroed(NumRigs);
+	NeckQ.Init(FQuat::Identity, NumRigs);
+
+	GroundHeight.SetNumZeroed(NumRigs);
+	ColumnYaw.SetNumZeroed(NumRigs);
+	TiltAngle.SetNumZeroed(NumRigs);
+	ExtensionLength.SetNumZeroed(NumRigs);
+	BeamsAdjusted.SetNumZeroed(NumRigs);
+	for (TArray<float>& Adjustment : BeamAdjustment)
+	{
+		Adjustment.SetNumZeroed(NumRigs);
+	}
+	GravityRotation.Init(FQuat::Identity, NumRigs);
+	HeadRotation.Init(FQuat::Identity, NumRigs);
+}
+
+void FCraneRigBatch::SetRig(const int32 Index, const int32 InPresetIndex, const FCraneRigSolverInput& Input)
+{
+	check(Geometries.IsValidIndex(InPresetIndex));
+
+	PresetIndex[Index] = InPresetIndex;
+	TargetX[Index] = Input.Target.X;
+	TargetY[Index] = Input.Target.Y;
+	TargetZ[Index] = Input.Target.Z;
+	TrackPosition[Index] = Input.TrackPosition;
+	RawTilt[Index] = Input.RawRotation.Y;
+	NeckQ[Index] = Input.NeckQ;
+}
+
+void FCraneRigBatch::GetSolution(const int32 Index, FCraneRigSolution& OutSolution) const
+{
+	OutSolution.GroundHeight = GroundHeight[Index];
+	OutSolution.ColumnYaw = ColumnYaw[Index];
+	OutSolution.TiltAngle = TiltAngle[Index];
+	OutSolution.ExtensionLength = ExtensionLength[Index];
+	OutSolution.bBeamsAdjusted = BeamsAdjusted[Index] != 0;
+	for (int32 i = 0; i < TECHNOCRANE_EXTENSION_BEAMS_COUNT; ++i)
+	{
+		OutSolution.BeamAdjustment[i] = BeamAdjustment[i][Index];
+	}
+	OutSolution.GravityRotation = GravityRotation[Index];
+	OutSolution.NeckRotation = NeckQ[Index];
+	OutSolution.HeadRotation = HeadRotation[Index];
+}
+
+void FCraneRigBatch::Solve()
+{
+	using namespace NTechnocraneRigSolverInternal;
+	using namespace NTechnocraneRigBatchInternal;
+
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneRigBatch);
+
+	const int32 NumRigs = Num();
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumRigs, ChunkSize);
+
+	ParallelFor(NumChunks, [this, NumRigs](const int32 ChunkIndex)
+	{
+		const int32 First = ChunkIndex * ChunkSize;
+		const int32 Last = FMath::Min(First + ChunkSize, NumRigs);
+
+		const VectorRegister4Float Zero = GlobalVectorConstants::FloatZero;
+		const VectorRegister4Float One = GlobalVectorConstants::FloatOne;
+		const VectorRegister4Float Tolerance = VectorSetFloat1(UE_SMALL_NUMBER);
+		const VectorRegister4Float RadToDeg = VectorSetFloat1(180.0f / UE_PI);
+		const VectorRegister4Float QuarterTurn = VectorSetFloat1(90.0f);
+		const VectorRegister4Float AdjustThreshold = VectorSetFloat1(0.1f);
+
+		for (int32 Group = First; Group < Last; Group += NumLanes)
+		{
+			const int32 Count = FMath::Min(NumLanes, Last - Group);
+
+			// per lane constants, rigs of a group can use different presets
+			const FCraneRigLaneGeometry* Lanes[NumLanes];
+			for (int32 k = 0; k < NumLanes; ++k)
+			{
+				Lanes[k] = &LaneGeometries[PresetIndex[Group + FMath::Min(k, Count - 1)]];
+			}
+
+			auto Gather = [&Lanes](float FCraneRigLaneGeometry::* Member)
+			{
+				return MakeVectorRegisterFloat(Lanes[0]->*Member, Lanes[1]->*Member, Lanes[2]->*Member, Lanes[3]->*Member);
+			};
+
+			const VectorRegister4Float X = LoadLanes(TargetX, Group, Count);
+			const VectorRegister4Float Y = LoadLanes(TargetY, Group, Count);
+			const VectorRegister4Float Z = LoadLanes(TargetZ, Group, Count);
+			const VectorRegister4Float Track = LoadLanes(TrackPosition, Group, Count);
+
+			//
+			// column yaw, 90 degrees plus a target direction in the horizontal plane
+
+			const VectorRegister4Float TargetSq = VectorMultiplyAdd(X, X, VectorMultiply(Y, Y));
+			const VectorRegister4Float HasDirection = VectorCompareGT(TargetSq, Tolerance);
+			const VectorRegister4Float InvTargetLen = VectorDivide(One, VectorSqrt(VectorMax(TargetSq, Tolerance)));
+
+			const VectorRegister4Float Yaw = VectorAdd(QuarterTurn,
+				VectorSelect(HasDirection, VectorMultiply(VectorATan2(Y, X), RadToDeg), Zero));
+
+			// sin and cos of the yaw, a quarter turn from the target direction
+			const VectorRegister4Float SinYaw = VectorSelect(HasDirection, VectorMultiply(X, InvTargetLen), One);
+			const VectorRegister4Float CosYaw = VectorSelect(HasDirection, VectorNegate(VectorMultiply(Y, InvTargetLen)), Zero);
+
+			//
+			// beams pivot, the arm rotates with the column around up
+
+			const VectorRegister4Float ArmX = Gather(&FCraneRigLaneGeometry::ArmX);
+			const VectorRegister4Float ArmY = Gather(&FCraneRigLaneGeometry::ArmY);
+
+			const VectorRegister4Float PivotX = VectorAdd(Gather(&FCraneRigLaneGeometry::ColumnX),
+				VectorNegateMultiplyAdd(SinYaw, ArmY, VectorMultiply(CosYaw, ArmX)));
+			const VectorRegister4Float PivotY = VectorAdd(VectorAdd(Gather(&FCraneRigLaneGeometry::ColumnY), Track),
+				VectorMultiplyAdd(SinYaw, ArmX, VectorMultiply(CosYaw, ArmY)));
+			const VectorRegister4Float PivotZ = VectorAdd(Gather(&FCraneRigLaneGeometry::ColumnZ), Gather(&FCraneRigLaneGeometry::ArmZ));
+
+			//
+			// extension and tilt, the signed angle between a direction to the camera and its horizontal projection
+
+			const VectorRegister4Float DX = VectorSubtract(X, PivotX);
+			const VectorRegister4Float DY = VectorSubtract(Y, PivotY);
+			const VectorRegister4Float DZ = VectorSubtract(VectorAdd(Z, Gather(&FCraneRigLaneGeometry::DistCamHeadAndNeck)), PivotZ);
+
+			const VectorRegister4Float PlaneSq = VectorMultiplyAdd(DX, DX, VectorMultiply(DY, DY));
+			const VectorRegister4Float Extension = VectorSqrt(VectorMultiplyAdd(DZ, DZ, PlaneSq));
+
+			const VectorRegister4Float ForwardX0 = Gather(&FCraneRigLaneGeometry::ForwardX);
+			const VectorRegister4Float ForwardY0 = Gather(&FCraneRigLaneGeometry::ForwardY);
+			const VectorRegister4Float ForwardX = VectorNegateMultiplyAdd(SinYaw, ForwardY0, VectorMultiply(CosYaw, ForwardX0));
+			const VectorRegister4Float ForwardY = VectorMultiplyAdd(SinYaw, ForwardX0, VectorMultiply(CosYaw, ForwardY0));
+
+			const VectorRegister4Float Side = VectorMultiply(DZ, VectorNegateMultiplyAdd(ForwardX, DY, VectorMultiply(ForwardY, DX)));
+			const VectorRegister4Float Angle = VectorMultiply(VectorATan2(VectorAbs(DZ), VectorSqrt(PlaneSq)), RadToDeg);
+
+			VectorRegister4Float Tilt = VectorSelect(VectorCompareLT(Side, Zero), VectorNegate(Angle), Angle);
+			Tilt = VectorSelect(VectorCompareGT(PlaneSq, Tolerance), Tilt, Zero);
+			Tilt = VectorMin(VectorMax(Tilt, VectorNegate(Gather(&FCraneRigLaneGeometry::TiltMin))), Gather(&FCraneRigLaneGeometry::TiltMax));
+
+			const int32 AdjustedMask = VectorMaskBits(VectorCompareGT(
+				VectorAbs(VectorSubtract(Gather(&FCraneRigLaneGeometry::RefHeadDistance), Extension)), AdjustThreshold));
+
+			StoreLanes(Z, GroundHeight, Group, Count);
+			StoreLanes(Yaw, ColumnYaw, Group, Count);
+			StoreLanes(Tilt, TiltAngle, Group, Count);
+			StoreLanes(Extension, ExtensionLength, Group, Count);
+
+			alignas(16) float LaneTilt[NumLanes];
+			alignas(16) float LaneSin[NumLanes];
+			alignas(16) float LaneCos[NumLanes];
+			alignas(16) float LanePivot[3][NumLanes];
+			VectorStoreAligned(Tilt, LaneTilt);
+			VectorStoreAligned(SinYaw, LaneSin);
+			VectorStoreAligned(CosYaw, LaneCos);
+			VectorStoreAligned(PivotX, LanePivot[0]);
+			VectorStoreAligned(PivotY, LanePivot[1]);
+			VectorStoreAligned(PivotZ, LanePivot[2]);
+
+			//
+			// beams distribution and rotations of every rig, a tilt gives the beams orientation without the chain
+
+			for (int32 k = 0; k < Count; ++k)
+			{
+				const int32 i = Group + k;
+				const int32 Preset = PresetIndex[i];
+				const FCraneRigGeometry& Geometry = *Geometries[Preset];
+				const FCraneRigLaneGeometry& LaneGeometry = *Lanes[k];
+
+				FCraneRigSolution Solution;
+
+				if (!LaneGeometry.bIsValid)
+				{
+					FCraneRigSolverInput Input;
+					Input.Target = FVector(TargetX[i], TargetY[i], TargetZ[i]);
+					Input.TrackPosition = TrackPosition[i];
+					Input.RawRotation = FVector(0.0f, RawTilt[i], 0.0f);
+					Input.NeckQ = NeckQ[i];
+
+					FCraneRigSolver::Solve(Geometry, Presets[Preset], Input, Solution);
+
+					GroundHeight[i] = Solution.GroundHeight;
+					ColumnYaw[i] = Solution.ColumnYaw;
+					TiltAngle[i] = Solution.TiltAngle;
+					ExtensionLength[i] = Solution.ExtensionLength;
+				}
+				else
+				{
+					const FQuat BeamsQ = FRotator(LaneGeometry.BeamsPitch, LaneGeometry.BeamsYaw, 90.0f + LaneTilt[k]).Quaternion();
+
+					if (AdjustedMask & (1 << k))
+					{
+						float BeamLengths[TECHNOCRANE_EXTENSION_BEAMS_COUNT];
+						for (int32 Beam = 0; Beam < TECHNOCRANE_EXTENSION_BEAMS_COUNT; ++Beam)
+						{
+							const FVector Local = BeamsQ.RotateVector(LaneGeometry.BeamOffsets[Beam]);
+							const FVector Position(
+								LanePivot[0][k] + LaneCos[k] * Local.X - LaneSin[k] * Local.Y,
+								LanePivot[1][k] + LaneSin[k] * Local.X + LaneCos[k] * Local.Y,
+								LanePivot[2][k] + Local.Z);
+
+							BeamLengths[Beam] = Position.Length();
+						}
+
+						DistributeBeams(Geometry, BeamLengths, ExtensionLength[i], Solution);
+					}
+
+					Solution.GravityRotation = FQuat::MakeFromEuler(-(LaneGeometry.BeamsParentInverse * BeamsQ).Euler());
+					Solution.HeadRotation = NeckQ[i] * FQuat::MakeFromEuler(FVector(RawTilt[i], 0.0f, 0.0f));
+				}
+
+				BeamsAdjusted[i] = (Solution.bBeamsAdjusted) ? 1 : 0;
+				for (int32 Beam = 0; Beam < TECHNOCRANE_EXTENSION_BEAMS_COUNT; ++Beam)
+				{
+					BeamAdjustment[Beam][i] = Solution.BeamAdjustment[Beam];
+				}
+				GravityRotation[i] = Solution.GravityRotation;
+				HeadRotation[i] = Solution.HeadRotation;
+			}
+		}
+	}, (NumChunks > 1) ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void FCraneRigBatch::SolveEachRig()
+{
+	FCraneRigSolverInput Input;
+	FCraneRigSolution Solution;
+
+	for (int32 i = 0; i < Num(); ++i)
+	{
+		const int32 Preset = PresetIndex[i];
+
+		Input.Target = FVector(TargetX[i], TargetY[i], TargetZ[i]);
+		Input.TrackPosition = TrackPosition[i];
+		Input.RawRotation = FVector(0.0f, RawTilt[i], 0.0f);
+		Input.NeckQ = NeckQ[i];
+
+		FCraneRigSolver::Solve(*Geometries[Preset], Presets[Preset], Input, Solution);
+
+		GroundHeight[i] = Solution.GroundHeight;
+		ColumnYaw[i] = Solution.ColumnYaw;
+		TiltAngle[i] = Solution.TiltAngle;
+		ExtensionLength[i] = Solution.ExtensionLength;
+		BeamsAdjusted[i] = (Solution.bBeamsAdjusted) ? 1 : 0;
+		for (int32 k = 0; k < TECHNOCRANE_EXTENSION_BEAMS_COUNT; ++k)
+		{
+			BeamAdjustment[k][i] = Solution.BeamAdjustment[k];
+		}
+		GravityRotation[i] = Solution.GravityRotation;
+		HeadRotation[i] = Solution.HeadRotation;
+	}
+}
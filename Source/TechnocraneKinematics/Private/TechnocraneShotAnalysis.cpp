@@ -0,0 +1,102 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneShotAnalysis.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneShotAnalysis.h"
+#include "TechnocraneStats.h"
+
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Technocrane Shot Analysis"), STAT_TechnocraneShotAnalysis, STATGROUP_Technocrane);
+
+namespace NTechnocraneShotAnalysisInternal
+{
+	// position of a value in a [-Min; Max] range, 1 at either limit
+	FORCEINLINE float GetSignedRangeUsage(const float Value, const float Min, const float Max)
+	{
+		if (Value >= 0.0f)
+		{
+			return (Max > KINDA_SMALL_NUMBER) ? Value / Max : (Value > 0.0f) ? 2.0f : 0.0f;
+		}
+		return (Min > KINDA_SMALL_NUMBER) ? -Value / Min : 2.0f;
+	}
+};
+
+void FCraneShotAnalysis::Analyze(const FCraneRigGeometry& Geometry, const FCraneShotLimits& Limits,
+	TArrayView<const FVector> Targets, TArrayView<const float> TrackPositions, TArray<FCraneShotFrame>& OutFrames)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneShotAnalysis);
+	using namespace NTechnocraneShotAnalysisInternal;
+
+	const int32 NumFrames = Targets.Num();
+	OutFrames.SetNum(NumFrames);
+
+	if (!Geometry.IsValid() || NumFrames == 0)
+	{
+		return;
+	}
+
+	check(TrackPositions.Num() == NumFrames || TrackPositions.Num() == 1);
+
+	const FCraneRigPreset& Preset = Limits.Preset;
+	const float HalfExtensionRange = 0.5f * FMath::Max(Geometry.MaxExtension - Geometry.MinExtension, KINDA_SMALL_NUMBER);
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumFrames, ChunkSize);
+
+	// every frame is independent, pan is unwrapped in a sequential pass below
+	ParallelFor(NumChunks, [&](const int32 ChunkIndex)
+	{
+		const int32 First = ChunkIndex * ChunkSize;
+		const int32 Last = FMath::Min(First + ChunkSize, NumFrames);
+
+		FCraneRigReach Reach;
+
+		for (int32 i = First; i < Last; ++i)
+		{
+			const float TrackPosition = (TrackPositions.Num() == 1) ? TrackPositions[0] : TrackPositions[i];
+			FCraneRigSolver::ComputeReach(Geometry, Preset, Targets[i], TrackPosition, Reach);
+
+			FCraneShotFrame& Frame = OutFrames[i];
+			Frame.TiltAngle = Reach.TiltAngle;
+			Frame.ExtensionLength = Reach.ExtensionLength;
+			Frame.PanAngle = FRotator::NormalizeAxis(Reach.ColumnYaw - 90.0f);
+			Frame.Flags = ECraneLimitFlags::None;
+
+			if (Reach.TiltAngle < -Preset.TiltMin)
+				Frame.Flags |= ECraneLimitFlags::TiltMin;
+			else if (Reach.TiltAngle > Preset.TiltMax)
+				Frame.Flags |= ECraneLimitFlags::TiltMax;
+
+			if (Reach.ExtensionLength < Geometry.MinExtension)
+				Frame.Flags |= ECraneLimitFlags::ExtensionMin;
+			else if (Reach.ExtensionLength > Geometry.MaxExtension)
+				Frame.Flags |= ECraneLimitFlags::ExtensionMax;
+
+			Frame.TiltUsage = GetSignedRangeUsage(Reach.TiltAngle, Preset.TiltMin, Preset.TiltMax);
+
+			const float DistToLimit = FMath::Min(Reach.ExtensionLength - Geometry.MinExtension, Geometry.MaxExtension - Reach.ExtensionLength);
+			Frame.ExtensionUsage = 1.0f - DistToLimit / HalfExtensionRange;
+		}
+	}, (NumChunks > 1) ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+	// the column follows the camera continuously, so pan accumulates over the shot
+	float PrevWrapped = OutFrames[0].PanAngle;
+	float Unwrapped = PrevWrapped;
+
+	for (FCraneShotFrame& Frame : OutFrames)
+	{
+		const float Wrapped = Frame.PanAngle;
+		Unwrapped += FRotator::NormalizeAxis(Wrapped - PrevWrapped);
+		PrevWrapped = Wrapped;
+
+		Frame.PanAngle = Unwrapped;
+		Frame.PanUsage = GetSignedRangeUsage(Unwrapped, Limits.PanMin, Limits.PanMax);
+
+		if (Unwrapped < -Limits.PanMin)
+			Frame.Flags |= ECraneLimitFlags::PanMin;
+		else if (Unwrapped > Limits.PanMax)
+			Frame.Flags |= ECraneLimitFlags::PanMax;
+	}
+}
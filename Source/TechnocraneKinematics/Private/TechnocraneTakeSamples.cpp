@@ -0,0 +1,94 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneTakeSamples.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneTakeSamples.h"
+
+namespace NTechnocraneTakeSamplesInternal
+{
+	enum : int32
+	{
+		ArchiveVersionInitial = 1,
+		ArchiveVersionLatest = ArchiveVersionInitial
+	};
+
+	bool IsRotationChannel(const int32 Channel)
+	{
+		return Channel == static_cast<int32>(ECraneTakeChannel::Pitch)
+			|| Channel == static_cast<int32>(ECraneTakeChannel::Yaw)
+			|| Channel == static_cast<int32>(ECraneTakeChannel::Roll);
+	}
+};
+
+void FCraneTakeSamples::Reset(const FFrameRate InSampleRate, const FFrameNumber InStartFrame, const int32 NumSamplesToReserve)
+{
+	SampleRate = InSampleRate;
+	StartFrame = InStartFrame;
+
+	Values.Reset(NumSamplesToReserve * NumChannels);
+}
+
+void FCraneTakeSamples::AddSample(TArrayView<const float> Sample)
+{
+	check(Sample.Num() == NumChannels);
+	Values.Append(Sample.GetData(), NumChannels);
+}
+
+void FCraneTakeSamples::Evaluate(const FFrameTime SampleTime, TArrayView<float> OutSample) const
+{
+	check(OutSample.Num() == NumChannels);
+
+	const int32 NumSamples = Num();
+	if (NumSamples == 0)
+	{
+		FMemory::Memzero(OutSample.GetData(), NumChannels * sizeof(float));
+		return;
+	}
+
+	const double Position = FMath::Clamp((SampleTime - FFrameTime(StartFrame)).AsDecimal(), 0.0, static_cast<double>(NumSamples - 1));
+	const int32 Index = static_cast<int32>(Position);
+	const int32 NextIndex = FMath::Min(Index + 1, NumSamples - 1);
+	const float Alpha = static_cast<float>(Position - static_cast<double>(Index));
+
+	const float* Sample = Values.GetData() + Index * NumChannels;
+	const float* NextSample = Values.GetData() + NextIndex * NumChannels;
+
+	// angles turn the short way around, a take could be recorded with wrapped angles
+	for (int32 i = 0; i < NumChannels; ++i)
+	{
+		const float Delta = (NTechnocraneTakeSamplesInternal::IsRotationChannel(i)) ? FMath::FindDeltaAngleDegrees(Sample[i], NextSample[i]) : NextSample[i] - Sample[i];
+		OutSample[i] = Sample[i] + Alpha * Delta;
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FCraneTakeSamples& Samples)
+{
+	using namespace NTechnocraneTakeSamplesInternal;
+
+	int32 Version = ArchiveVersionLatest;
+	Ar << Version;
+
+	// samples of a newer version can't be read, the take has to be recorded again
+	if (Ar.IsLoading() && (Version < ArchiveVersionInitial || Version > ArchiveVersionLatest))
+	{
+		Ar.SetError();
+		Samples.Reset(FFrameRate(100, 1), FFrameNumber(0));
+		return Ar;
+	}
+
+	Ar << Samples.SampleRate;
+	Ar << Samples.StartFrame;
+	Samples.Values.BulkSerialize(Ar);
+
+	// a sample is never split
+	if (Ar.IsLoading() && (Samples.Values.Num() % FCraneTakeSamples::NumChannels) != 0)
+	{
+		Ar.SetError();
+		Samples.Values.Reset();
+	}
+
+	return Ar;
+}
@@ -0,0 +1,300 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneTrackLayout.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneTrackLayout.h"
+#include "TechnocraneReachField.h"
+#include "TechnocraneStats.h"
+
+#include "Algo/MaxElement.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Technocrane Track Layout"), STAT_TechnocraneTrackLayout, STATGROUP_Technocrane);
+
+namespace NTechnocraneTrackLayoutInternal
+{
+	struct FCandidate
+	{
+		FVector2D Base{ FVector2D::ZeroVector };
+		float Heading{ 0.0f };
+		float Score{ -MAX_flt };
+	};
+
+	/** frames of a shot to score against, every Stride frame */
+	struct FFrames
+	{
+		TArrayView<const FVector> Targets;
+		int32 Stride{ 1 };
+
+		int32 Num() const { return FMath::DivideAndRoundUp(Targets.Num(), Stride); }
+		const FVector& operator[](const int32 Index) const { return Targets[Index * Stride]; }
+	};
+
+	/** evenly spaced track positions along the run */
+	void MakeTrackStates(const FCraneTrackLayoutSettings& Settings, const int32 NumStates, TArray<float>& OutStates)
+	{
+		OutStates.SetNumUninitialized(NumStates);
+		for (int32 i = 0; i < NumStates; ++i)
+		{
+			OutStates[i] = Settings.TrackStart + ((NumStates > 1) ? Settings.TrackLength * i / (NumStates - 1) : 0.0f);
+		}
+	}
+
+	/**
+	 * how many states the track position can move between two scored frames
+	 * @param bAtLeastOneState states are further apart than the track step, a move to a neighbour state is still allowed
+	 */
+	int32 GetMaxStateStep(const FCraneTrackLayoutSettings& Settings, const int32 NumStates, const int32 Stride, const bool bAtLeastOneState)
+	{
+		if (NumStates <= 1)
+		{
+			return 0;
+		}
+		const float StateSpacing = Settings.TrackLength / (NumStates - 1);
+		const int32 MaxStateStep = FMath::Min(FMath::FloorToInt(Settings.MaxTrackStep * Stride / StateSpacing + KINDA_SMALL_NUMBER), NumStates - 1);
+
+		return (bAtLeastOneState) ? FMath::Max(MaxStateStep, 1) : FMath::Max(MaxStateStep, 0);
+	}
+
+	/**
+	 * the best min margin over frames, a track position moves by MaxStateStep states between frames at most
+	 * @param OutStates a track state for every frame, traced back when given
+	 */
+	float ScoreLayout(const FCraneReachField& Field, const FFrames& Frames, const FVector& Base, const float Heading,
+		TArrayView<const float> TrackStates, const int32 MaxStateStep, TArray<int32>* OutStates)
+	{
+		constexpr int32 MaxStates = FCraneTrackLayoutOptimizer::MaxTrackStates;
+
+		const int32 NumStates = TrackStates.Num();
+		const int32 NumFrames = Frames.Num();
+		check(NumStates > 0 && NumStates <= MaxStates);
+
+		float SinHeading, CosHeading;
+		FMath::SinCos(&SinHeading, &CosHeading, FMath::DegreesToRadians(Heading));
+
+		// a target in the crane space, the crane is only turned around up
+		auto GetLocalTarget = [&](const int32 Frame)
+		{
+			const FVector Delta = Frames[Frame] - Base;
+			return FVector(CosHeading * Delta.X + SinHeading * Delta.Y, CosHeading * Delta.Y - SinHeading * Delta.X, Delta.Z);
+		};
+
+		float Score[MaxStates];
+		float NextScore[MaxStates];
+
+		TArray<int16> Moves;
+		if (OutStates)
+		{
+			Moves.SetNumUninitialized(NumFrames * NumStates);
+		}
+
+		const FVector FirstTarget = GetLocalTarget(0);
+		for (int32 State = 0; State < NumStates; ++State)
+		{
+			Score[State] = Field.GetMargin(FirstTarget, TrackStates[State]);
+		}
+
+		for (int32 Frame = 1; Frame < NumFrames; ++Frame)
+		{
+			const FVector Target = GetLocalTarget(Frame);
+
+			for (int32 State = 0; State < NumStates; ++State)
+			{
+				const int32 First = FMath::Max(State - MaxStateStep, 0);
+				const int32 Last = FMath::Min(State + MaxStateStep, NumStates - 1);
+
+				int32 BestPrev = First;
+				for (int32 Prev = First + 1; Prev <= Last; ++Prev)
+				{
+					BestPrev = (Score[Prev] > Score[BestPrev]) ? Prev : BestPrev;
+				}
+
+				NextScore[State] = FMath::Min(Score[BestPrev], Field.GetMargin(Target, TrackStates[State]));
+
+				if (OutStates)
+				{
+					Moves[Frame * NumStates + State] = static_cast<int16>(State - BestPrev);
+				}
+			}
+
+			FMemory::Memcpy(Score, NextScore, NumStates * sizeof(float));
+		}
+
+		int32 BestState = 0;
+		for (int32 State = 1; State < NumStates; ++State)
+		{
+			BestState = (Score[State] > Score[BestState]) ? State : BestState;
+		}
+
+		if (OutStates)
+		{
+			OutStates->SetNumUninitialized(NumFrames);
+
+			int32 State = BestState;
+			for (int32 Frame = NumFrames - 1; Frame >= 0; --Frame)
+			{
+				(*OutStates)[Frame] = State;
+				if (Frame > 0)
+				{
+					State -= Moves[Frame * NumStates + State];
+				}
+			}
+		}
+		return Score[BestState];
+	}
+
+	void ScoreCandidates(const FCraneReachField& Field, const FFrames& Frames, const float BaseHeight, TArrayView<const float> TrackStates,
+		const int32 MaxStateStep, TArray<FCandidate>& InOutCandidates)
+	{
+		ParallelFor(InOutCandidates.Num(), [&](const int32 Index)
+		{
+			FCandidate& Candidate = InOutCandidates[Index];
+			Candidate.Score = ScoreLayout(Field, Frames, FVector(Candidate.Base, BaseHeight), Candidate.Heading, TrackStates, MaxStateStep, nullptr);
+		});
+	}
+
+	/** a grid of placements around a center for every heading */
+	void AddCandidates(const FVector2D& Center, const float Extent, const float Step, const float FirstHeading, const int32 NumHeadings, const float HeadingStep,
+		TArray<FCandidate>& OutCandidates)
+	{
+		const int32 NumSteps = FMath::FloorToInt(Extent / Step);
+
+		for (int32 HeadingIndex = 0; HeadingIndex < NumHeadings; ++HeadingIndex)
+		{
+			for (int32 Y = -NumSteps; Y <= NumSteps; ++Y)
+			{
+				for (int32 X = -NumSteps; X <= NumSteps; ++X)
+				{
+					FCandidate& Candidate = OutCandidates.AddDefaulted_GetRef();
+					Candidate.Base = Center + FVector2D(X * Step, Y * Step);
+					Candidate.Heading = FirstHeading + HeadingIndex * HeadingStep;
+				}
+			}
+		}
+	}
+};
+
+bool FCraneTrackLayoutOptimizer::Optimize(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const FCraneReachField& Field,
+	TArrayView<const FVector> Targets, const float BaseHeight, const FCraneTrackLayoutSettings& Settings, FCraneTrackLayout& OutLayout)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneTrackLayout);
+	using namespace NTechnocraneTrackLayoutInternal;
+
+	OutLayout = FCraneTrackLayout();
+
+	if (!Geometry.IsValid() || !Field.IsValid() || Targets.Num() == 0)
+	{
+		return false;
+	}
+
+	const bool bHasTracks = Settings.TrackLength > KINDA_SMALL_NUMBER;
+
+	// a crane without tracks pans freely, the heading doesn't change margins
+	// a heading and the opposite one cover the same run, the base placement takes care of the direction
+	const float HeadingStep = FMath::Max(Settings.HeadingStep, 1.0f);
+	const int32 NumHeadings = (bHasTracks) ? FMath::Max(FMath::FloorToInt(180.0f / HeadingStep), 1) : 1;
+	const int32 NumRefinedHeadings = (bHasTracks) ? 5 : 1;
+
+	// the base goes around the camera path, no further than the crane reaches
+	FBox2D PathBounds(ForceInit);
+	for (const FVector& Target : Targets)
+	{
+		PathBounds += FVector2D(Target);
+	}
+
+	const float SearchExtent = (Settings.SearchExtent > 0.0f) ? Settings.SearchExtent : Geometry.MaxExtension + 0.5f * Settings.TrackLength;
+	const float CoarseStep = FMath::Max(Settings.PlacementStep, 2.0f * SearchExtent / (MaxCoarsePlacements - 1));
+
+	// coarse grid on a subset of frames
+
+	FFrames CoarseFrames;
+	CoarseFrames.Targets = Targets;
+	CoarseFrames.Stride = FMath::DivideAndRoundUp(Targets.Num(), MaxCoarseFrames);
+
+	TArray<float> CoarseStates;
+	MakeTrackStates(Settings, (bHasTracks) ? NumCoarseTrackStates : 1, CoarseStates);
+
+	TArray<FCandidate> Candidates;
+	AddCandidates(PathBounds.GetCenter(), SearchExtent, CoarseStep, 0.0f, NumHeadings, HeadingStep, Candidates);
+	ScoreCandidates(Field, CoarseFrames, BaseHeight, CoarseStates, GetMaxStateStep(Settings, CoarseStates.Num(), CoarseFrames.Stride, true), Candidates);
+
+	OutLayout.NumCandidates = Candidates.Num();
+
+	// finer placements around the best coarse candidates on all frames
+
+	Algo::Sort(Candidates, [](const FCandidate& A, const FCandidate& B) { return A.Score > B.Score; });
+	Candidates.SetNum(FMath::Min(Candidates.Num(), NumRefinedCandidates));
+
+	FFrames AllFrames;
+	AllFrames.Targets = Targets;
+
+	TArray<FCandidate> RefinedCandidates;
+	for (const FCandidate& Candidate : Candidates)
+	{
+		const float FirstHeading = (bHasTracks) ? Candidate.Heading - 0.5f * HeadingStep : Candidate.Heading;
+		AddCandidates(Candidate.Base, CoarseStep, 0.25f * CoarseStep, FirstHeading, NumRefinedHeadings, 0.25f * HeadingStep, RefinedCandidates);
+	}
+	ScoreCandidates(Field, AllFrames, BaseHeight, CoarseStates, GetMaxStateStep(Settings, CoarseStates.Num(), 1, true), RefinedCandidates);
+
+	OutLayout.NumCandidates += RefinedCandidates.Num();
+
+	const FCandidate* Best = Algo::MaxElementBy(RefinedCandidates, [](const FCandidate& Candidate) { return Candidate.Score; });
+	check(Best);
+
+	// track states as fine as their max number allows with a whole number of states per track step, traced back for every frame
+	// a run too long for one state to be within the track step moves by a state and the layout is reported over the step
+
+	int32 NumTrackStates = 1;
+	if (bHasTracks)
+	{
+		const float FinestSpacing = Settings.TrackLength / (MaxTrackStates - 1);
+		const int32 StatesPerStep = FMath::FloorToInt(Settings.MaxTrackStep / FinestSpacing);
+
+		NumTrackStates = (StatesPerStep > 0)
+			? FMath::Clamp(FMath::CeilToInt(Settings.TrackLength * StatesPerStep / Settings.MaxTrackStep) + 1, 2, MaxTrackStates)
+			: MaxTrackStates;
+	}
+
+	TArray<float> TrackStates;
+	MakeTrackStates(Settings, NumTrackStates, TrackStates);
+
+	OutLayout.BaseLocation = FVector(Best->Base, BaseHeight);
+	OutLayout.Heading = FRotator::NormalizeAxis(Best->Heading);
+
+	TArray<int32> States;
+	ScoreLayout(Field, AllFrames, OutLayout.BaseLocation, Best->Heading, TrackStates, GetMaxStateStep(Settings, NumTrackStates, 1, true), &States);
+
+	OutLayout.TrackPositions.SetNumUninitialized(Targets.Num());
+	for (int32 Frame = 0; Frame < Targets.Num(); ++Frame)
+	{
+		OutLayout.TrackPositions[Frame] = TrackStates[States[Frame]];
+
+		if (Frame > 0)
+		{
+			OutLayout.LargestTrackStep = FMath::Max(OutLayout.LargestTrackStep, FMath::Abs(OutLayout.TrackPositions[Frame] - OutLayout.TrackPositions[Frame - 1]));
+		}
+	}
+
+	OutLayout.bWithinTrackStep = OutLayout.LargestTrackStep <= Settings.MaxTrackStep + KINDA_SMALL_NUMBER;
+
+	// the field is quantized, margins of the layout are measured by the solver
+
+	const FQuat InvRotation = FRotator(0.0f, OutLayout.Heading, 0.0f).Quaternion().Inverse();
+
+	TArray<float> Margins;
+	Margins.SetNumUninitialized(Targets.Num());
+
+	ParallelFor(Targets.Num(), [&](const int32 Frame)
+	{
+		FCraneRigReach Reach;
+		FCraneRigSolver::ComputeReach(Geometry, Preset, InvRotation.RotateVector(Targets[Frame] - OutLayout.BaseLocation), OutLayout.TrackPositions[Frame], Reach);
+		Margins[Frame] = Reach.Margin;
+	});
+
+	OutLayout.MinMargin = FMath::Min(Margins);
+	return true;
+}
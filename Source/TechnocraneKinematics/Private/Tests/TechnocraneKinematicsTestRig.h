@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneKinematicsTestRig.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TechnocraneRigSolver.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * A synthetic crane skeleton for tests, a chain of crane joints without extra bones and with identity rotations.
+ *  Beams extend along the local -Z, the gravity joint is offset from the last beam and the head hangs below the neck.
+ */
+namespace NTechnocraneKinematicsTests
+{
+	constexpr float ColumnHeight = 60.0f;
+	constexpr float BeamsHeight = 120.0f;
+	constexpr float Beam1Length = 150.0f;
+	constexpr float BeamLength = 100.0f;
+
+	inline bool MakeTestGeometry(FCraneRigGeometry& OutGeometry, const bool bWithHead = true)
+	{
+		const int32 Joints[] = {
+			ECraneKinematicsJoint::Base, ECraneKinematicsJoint::Columns, ECraneKinematicsJoint::Beams, ECraneKinematicsJoint::Beam1,
+			ECraneKinematicsJoint::Beam2, ECraneKinematicsJoint::Beam3, ECraneKinematicsJoint::Beam4, ECraneKinematicsJoint::Beam5,
+			ECraneKinematicsJoint::Gravity, ECraneKinematicsJoint::Neck, ECraneKinematicsJoint::Head
+		};
+		const FVector Locations[] = {
+			FVector::ZeroVector, FVector(0.0f, 0.0f, ColumnHeight), FVector(0.0f, 0.0f, BeamsHeight), FVector(0.0f, 0.0f, -Beam1Length),
+			FVector(0.0f, 0.0f, -BeamLength), FVector(0.0f, 0.0f, -BeamLength), FVector(0.0f, 0.0f, -BeamLength), FVector(0.0f, 0.0f, -BeamLength),
+			FVector(20.0f, -30.0f, 10.0f), FVector(0.0f, 0.0f, -25.0f), FVector(0.0f, 0.0f, -15.0f)
+		};
+
+		// every bone is a child of the previous one
+		const int32 NumBones = UE_ARRAY_COUNT(Joints) - ((bWithHead) ? 0 : 1);
+
+		TArray<FTransform> RefPose;
+		TArray<int32> ParentIndices;
+		int32 JointBoneIndices[FCraneRigGeometry::JointCount];
+
+		for (int32& Index : JointBoneIndices)
+		{
+			Index = INDEX_NONE;
+		}
+
+		for (int32 i = 0; i < NumBones; ++i)
+		{
+			RefPose.Add(FTransform(Locations[i]));
+			ParentIndices.Add(i - 1);
+			JointBoneIndices[Joints[i]] = i;
+		}
+
+		return OutGeometry.Build(RefPose, ParentIndices, JointBoneIndices, ECraneKinematicsJoint::Columns);
+	}
+
+	inline FCraneRigPreset MakeTestPreset()
+	{
+		FCraneRigPreset Preset;
+		Preset.ZOffsetOnGround = 36.0f;
+		Preset.TiltMin = 45.0f;
+		Preset.TiltMax = 55.0f;
+		return Preset;
+	}
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,124 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneReachFieldTests.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneKinematicsTestRig.h"
+#include "TechnocraneReachField.h"
+
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneReachFieldSourceTest, "Technocrane.Kinematics.ReachField.Source", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneReachFieldSourceTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneKinematicsTests;
+
+	FCraneRigGeometry Geometry;
+	if (!TestTrue(TEXT("Geometry is built"), MakeTestGeometry(Geometry)))
+	{
+		return false;
+	}
+
+	const FCraneRigPreset Preset = MakeTestPreset();
+
+	FCraneReachField Field;
+	Field.Build(Geometry, Preset, 20.0f);
+
+	TestTrue(TEXT("Field is built for its kinematics"), Field.IsBuiltFor(Geometry, Preset));
+
+	// another preset of the same skeleton
+	FCraneRigPreset OtherPreset = Preset;
+	OtherPreset.TiltMax += 10.0f;
+	TestFalse(TEXT("Field doesn't match another tilt range"), Field.IsBuiltFor(Geometry, OtherPreset));
+
+	// another crane, beams are shorter
+	FCraneRigGeometry OtherGeometry = Geometry;
+	OtherGeometry.MaxExtension -= 50.0f;
+	TestFalse(TEXT("Field doesn't match another crane"), Field.IsBuiltFor(OtherGeometry, Preset));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneReachFieldArchiveTest, "Technocrane.Kinematics.ReachField.Archive", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneReachFieldArchiveTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneKinematicsTests;
+
+	FCraneRigGeometry Geometry;
+	if (!TestTrue(TEXT("Geometry is built"), MakeTestGeometry(Geometry)))
+	{
+		return false;
+	}
+
+	const FCraneRigPreset Preset = MakeTestPreset();
+
+	FCraneReachField Field;
+	Field.Build(Geometry, Preset, 20.0f);
+
+	// the latest layout keeps the kinematics the field is built for
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		Writer << Field;
+
+		FCraneReachField Loaded;
+		FMemoryReader Reader(Bytes);
+		Reader << Loaded;
+
+		TestFalse(TEXT("Latest layout is read"), Reader.IsError());
+		TestTrue(TEXT("Loaded field matches its kinematics"), Loaded.IsBuiltFor(Geometry, Preset));
+		TestEqual(TEXT("Margins are loaded"), Loaded.Margins.Num(), Field.Margins.Num());
+	}
+
+	// the initial layout has no source hash, the field has to be built again
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+
+		int32 Version = 1;
+		Writer << Version;
+		Writer << Field.CellSize;
+		Writer << Field.MinHeight;
+		Writer << Field.NumRadial;
+		Writer << Field.NumHeight;
+		Writer << Field.MarginStep;
+		Writer << Field.Margins;
+
+		FCraneReachField Loaded;
+		FMemoryReader Reader(Bytes);
+		Reader << Loaded;
+
+		TestFalse(TEXT("Initial layout is read"), Reader.IsError());
+		TestTrue(TEXT("Initial layout has margins"), Loaded.IsValid());
+		TestFalse(TEXT("Initial layout is out of date"), Loaded.IsBuiltFor(Geometry, Preset));
+	}
+
+	// a layout of a newer version is rejected
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+
+		int32 Version = 100;
+		Writer << Version;
+		Writer << Field.CellSize;
+
+		FCraneReachField Loaded = Field;
+		FMemoryReader Reader(Bytes);
+		Reader << Loaded;
+
+		TestTrue(TEXT("Newer layout sets an archive error"), Reader.IsError());
+		TestFalse(TEXT("Newer layout leaves an empty field"), Loaded.IsValid());
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,371 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneRigSolverTests.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneKinematicsTestRig.h"
+#include "TechnocraneRigSolver.h"
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace NTechnocraneRigSolverTests
+{
+	using namespace NTechnocraneKinematicsTests;
+
+	FCraneRigSolverInput MakeInput(FRandomStream& RandomStream, const float Radius, const float MaxHeight)
+	{
+		FCraneRigSolverInput Input;
+		Input.Target = FVector(RandomStream.FRandRange(-Radius, Radius), RandomStream.FRandRange(-Radius, Radius), RandomStream.FRandRange(-100.0f, MaxHeight));
+		Input.TrackPosition = RandomStream.FRandRange(0.0f, 200.0f);
+		Input.RawRotation = FVector(RandomStream.FRandRange(-180.0f, 180.0f), RandomStream.FRandRange(-45.0f, 45.0f), 0.0f);
+		Input.NeckQ = FQuat::MakeFromEuler(FVector(90.0f, 0.0f, 180.0f + Input.RawRotation.X));
+		return Input;
+	}
+
+	float SumAdjustments(const FCraneRigSolution& Solution)
+	{
+		float Sum = 0.0f;
+		for (const float Adjustment : Solution.BeamAdjustment)
+		{
+			Sum += Adjustment;
+		}
+		return Sum;
+	}
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneRigGeometryTest, "Technocrane.Kinematics.Solver.Geometry", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneRigGeometryTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneKinematicsTests;
+
+	FCraneRigGeometry Geometry;
+	if (!TestTrue(TEXT("Test rig builds"), MakeTestGeometry(Geometry)))
+	{
+		return false;
+	}
+
+	const float GravityOffset = FMath::Sqrt(20.0f * 20.0f + 10.0f * 10.0f);
+
+	TestEqual(TEXT("Joints"), Geometry.NumJoints, 11);
+	TestEqual(TEXT("Beam1 length"), Geometry.Beam1Length, Beam1Length, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Gravity offset"), Geometry.GravityOffsetLen, GravityOffset, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Camera below the neck"), Geometry.DistCamHeadAndNeck, 30.0f + 25.0f + 15.0f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Min extension"), Geometry.MinExtension, Beam1Length + GravityOffset - 4 * 2.0f, KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Max extension"), Geometry.MaxExtension, Beam1Length + GravityOffset + 4 * BeamLength, KINDA_SMALL_NUMBER);
+
+	FCraneRigGeometry NoHead;
+	TestFalse(TEXT("A rig without a head is not valid"), MakeTestGeometry(NoHead, false) || NoHead.IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneRigGeometryArchiveTest, "Technocrane.Kinematics.Solver.GeometryArchive", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneRigGeometryArchiveTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneKinematicsTests;
+
+	FCraneRigGeometry Geometry;
+	if (!TestTrue(TEXT("Test rig builds"), MakeTestGeometry(Geometry)))
+	{
+		return false;
+	}
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << Geometry;
+
+	FCraneRigGeometry Loaded;
+	FMemoryReader Reader(Bytes);
+	Reader << Loaded;
+
+	TestFalse(TEXT("Geometry is read"), Reader.IsError());
+	TestTrue(TEXT("Loaded geometry is valid"), Loaded.IsValid());
+
+	// stored geometry solves the same as the derived one
+	const FCraneRigPreset Preset = MakeTestPreset();
+	FRandomStream RandomStream(7);
+
+	for (int32 i = 0; i < 16; ++i)
+	{
+		const FCraneRigSolverInput Input = NTechnocraneRigSolverTests::MakeInput(RandomStream, 400.0f, 300.0f);
+
+		FCraneRigSolution Expected;
+		FCraneRigSolution Actual;
+		FCraneRigSolver::Solve(Geometry, Preset, Input, Expected);
+		FCraneRigSolver::Solve(Loaded, Preset, Input, Actual);
+
+		TestEqual(TEXT("Column yaw"), Actual.ColumnYaw, Expected.ColumnYaw);
+		TestEqual(TEXT("Tilt"), Actual.TiltAngle, Expected.TiltAngle);
+		TestEqual(TEXT("Extension"), Actual.ExtensionLength, Expected.ExtensionLength);
+	}
+
+	// a layout of a newer version is rejected
+	TArray<uint8> NewerBytes;
+	FMemoryWriter NewerWriter(NewerBytes);
+	int32 Version = 100;
+	NewerWriter << Version;
+
+	FCraneRigGeometry Newer = Geometry;
+	FMemoryReader NewerReader(NewerBytes);
+	NewerReader << Newer;
+
+	TestTrue(TEXT("Newer layout sets an archive error"), NewerReader.IsError());
+	TestFalse(TEXT("Newer layout leaves empty geometry"), Newer.IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneRigRoundTripTest, "Technocrane.Kinematics.Solver.RoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneRigRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneKinematicsTests;
+	using namespace NTechnocraneRigSolverTests;
+
+	FCraneRigGeometry Geometry;
+	MakeTestGeometry(Geometry);
+	const FCraneRigPreset Preset = MakeTestPreset();
+
+	FRandomStream RandomStream(27);
+	int32 NumInReach = 0;
+
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		const FCraneRigSolverInput Input = MakeInput(RandomStream, 500.0f, 500.0f);
+
+		FCraneRigReach Reach;
+		FCraneRigSolver::ComputeReach(Geometry, Preset, Input.Target, Input.TrackPosition, Reach);
+
+		// only targets inside of both tilt and extension limits are reached exactly
+		if (Reach.Margin < 1.0f)
+		{
+			continue;
+		}
+		++NumInReach;
+
+		FCraneRigSolution Solution;
+		FCraneRigSolver::Solve(Geometry, Preset, Input, Solution);
+
+		FCraneRigPose Pose;
+		FCraneRigSolver::BuildPose(Geometry, Preset, Input.TrackPosition, Solution, Pose);
+
+		TestEqual(TEXT("Column yaw of reach and solve"), Solution.ColumnYaw, Reach.ColumnYaw, KINDA_SMALL_NUMBER);
+		TestEqual(TEXT("Tilt inside of limits is not clamped"), Solution.TiltAngle, Reach.TiltAngle, 1e-3f);
+		TestEqual(TEXT("Extension of reach and solve"), Solution.ExtensionLength, Reach.ExtensionLength, 1e-3f);
+
+		// beams cover the extension exactly
+		if (TestTrue(TEXT("Beams are adjusted"), Solution.bBeamsAdjusted))
+		{
+			const float Covered = Geometry.Beam1Length + SumAdjustments(Solution) + Geometry.GravityOffsetLen;
+			TestEqual(TEXT("Beams cover the extension"), Covered, Solution.ExtensionLength, 0.01f);
+
+			const float PoseBeamsLength = FVector::Dist(Pose.ComponentSpace[ECraneKinematicsJoint::Beams].GetLocation(), Pose.ComponentSpace[ECraneKinematicsJoint::Beam5].GetLocation());
+			TestEqual(TEXT("Pose beams length"), PoseBeamsLength, Geometry.Beam1Length + SumAdjustments(Solution), 0.01f);
+		}
+
+		TestTrue(TEXT("Pose base is on the track"), Pose.ComponentSpace[ECraneKinematicsJoint::Base].GetLocation().Equals(FVector(0.0f, Input.TrackPosition, Preset.ZOffsetOnGround), 0.01f));
+		TestEqual(TEXT("Pose column yaw"), FRotator::NormalizeAxis(Pose.ComponentSpace[ECraneKinematicsJoint::Columns].Rotator().Yaw - Solution.ColumnYaw), 0.0f, 0.01f);
+
+		// gravity counter rotation keeps the head level whatever the tilt is
+		const FQuat Level = FRotator(0.0f, Solution.ColumnYaw, 0.0f).Quaternion();
+		TestTrue(TEXT("Gravity joint is level"), Pose.ComponentSpace[ECraneKinematicsJoint::Gravity].GetRotation().AngularDistance(Level) < 1e-3f);
+	}
+
+	TestTrue(TEXT("Enough targets are in reach"), NumInReach > 100);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneRigLimitsTest, "Technocrane.Kinematics.Solver.Limits", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneRigLimitsTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneKinematicsTests;
+	using namespace NTechnocraneRigSolverTests;
+
+	FCraneRigGeometry Geometry;
+	MakeTestGeometry(Geometry);
+	const FCraneRigPreset Preset = MakeTestPreset();
+
+	FCraneRigSolverInput Input;
+	FCraneRigSolution Solution;
+	FCraneRigReach Reach;
+
+	// tilt is always clamped
+	FRandomStream RandomStream(28);
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		Input = MakeInput(RandomStream, 3000.0f, 3000.0f);
+		FCraneRigSolver::Solve(Geometry, Preset, Input, Solution);
+
+		TestTrue(TEXT("Tilt inside of limits"), Solution.TiltAngle >= -Preset.TiltMin - KINDA_SMALL_NUMBER && Solution.TiltAngle <= Preset.TiltMax + KINDA_SMALL_NUMBER);
+	}
+
+	// straight up and straight down hit the opposite tilt limits
+	Input = FCraneRigSolverInput();
+	Input.Target = FVector(100.0f, 0.0f, 5000.0f);
+	FCraneRigSolver::Solve(Geometry, Preset, Input, Solution);
+	const float UpTilt = Solution.TiltAngle;
+
+	Input.Target = FVector(100.0f, 0.0f, -5000.0f);
+	FCraneRigSolver::Solve(Geometry, Preset, Input, Solution);
+	const float DownTilt = Solution.TiltAngle;
+
+	TestTrue(TEXT("Up is at a limit"), FMath::IsNearlyEqual(UpTilt, Preset.TiltMax) || FMath::IsNearlyEqual(UpTilt, -Preset.TiltMin));
+	TestTrue(TEXT("Down is at a limit"), FMath::IsNearlyEqual(DownTilt, Preset.TiltMax) || FMath::IsNearlyEqual(DownTilt, -Preset.TiltMin));
+	TestFalse(TEXT("Up and down are at different limits"), FMath::IsNearlyEqual(UpTilt, DownTilt));
+
+	FCraneRigSolver::ComputeReach(Geometry, Preset, Input.Target, 0.0f, Reach);
+	TestTrue(TEXT("Straight down is out of reach"), Reach.Margin < 0.0f);
+
+	// a far target extends every beam to its max and no further
+	Input.Target = FVector(5000.0f, 0.0f, 200.0f);
+	FCraneRigSolver::Solve(Geometry, Preset, Input, Solution);
+	FCraneRigSolver::ComputeReach(Geometry, Preset, Input.Target, 0.0f, Reach);
+
+	TestTrue(TEXT("Far target is out of reach"), Reach.Margin < 0.0f);
+	for (int32 i = 0; i < TECHNOCRANE_EXTENSION_BEAMS_COUNT; ++i)
+	{
+		TestEqual(TEXT("Beam is at the max length"), Solution.BeamAdjustment[i], Geometry.BeamMaxLength[i], 0.01f);
+	}
+
+	// a target next to the column shrinks beams to the min
+	Input.Target = FVector(0.0f, 50.0f, 150.0f);
+	FCraneRigSolver::Solve(Geometry, Preset, Input, Solution);
+	for (int32 i = 0; i < TECHNOCRANE_EXTENSION_BEAMS_COUNT; ++i)
+	{
+		TestTrue(TEXT("Beam is not shorter than the min"), Solution.BeamAdjustment[i] >= -2.0f - KINDA_SMALL_NUMBER);
+	}
+
+	// an invalid rig is not solved
+	FCraneRigGeometry NoHead;
+	MakeTestGeometry(NoHead, false);
+	FCraneRigSolver::Solve(NoHead, Preset, Input, Solution);
+	TestFalse(TEXT("Invalid rig has no solution"), Solution.bBeamsAdjusted);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneRigBatchTest, "Technocrane.Kinematics.Solver.Batch", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneRigBatchTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneKinematicsTests;
+	using namespace NTechnocraneRigSolverTests;
+
+	FCraneRigGeometry Geometry;
+	FCraneRigGeometry NoHead;
+	MakeTestGeometry(Geometry);
+	MakeTestGeometry(NoHead, false);
+
+	FCraneRigPreset LowPreset = MakeTestPreset();
+	LowPreset.ZOffsetOnGround = 10.0f;
+	LowPreset.TiltMax = 30.0f;
+
+	// rigs of different presets are mixed inside of lanes, the count is not a multiple of lanes
+	FCraneRigBatch Batch;
+	const int32 Presets[] = { Batch.AddPreset(&Geometry, MakeTestPreset()), Batch.AddPreset(&Geometry, LowPreset), Batch.AddPreset(&NoHead, MakeTestPreset()) };
+
+	TestTrue(TEXT("Lanes are used for the test rig"), Batch.LaneGeometries[Presets[0]].bIsValid && Batch.LaneGeometries[Presets[1]].bIsValid);
+	TestFalse(TEXT("Lanes are not used for an invalid rig"), Batch.LaneGeometries[Presets[2]].bIsValid);
+
+	constexpr int32 NumRigs = 1003;
+	Batch.SetNum(NumRigs);
+
+	FRandomStream RandomStream(26);
+	for (int32 i = 0; i < NumRigs; ++i)
+	{
+		Batch.SetRig(i, Presets[RandomStream.RandHelper(UE_ARRAY_COUNT(Presets))], MakeInput(RandomStream, 800.0f, 600.0f));
+	}
+
+	FCraneRigBatch Reference(Batch);
+	Batch.Solve();
+	Reference.SolveEachRig();
+
+	int32 NumMismatches = 0;
+	for (int32 i = 0; i < NumRigs; ++i)
+	{
+		FCraneRigSolution A, B;
+		Batch.GetSolution(i, A);
+		Reference.GetSolution(i, B);
+
+		bool bMatch = A.bBeamsAdjusted == B.bBeamsAdjusted
+			&& FMath::IsNearlyEqual(A.GroundHeight, B.GroundHeight)
+			&& FMath::Abs(FRotator::NormalizeAxis(A.ColumnYaw - B.ColumnYaw)) < 0.01f
+			&& FMath::Abs(A.TiltAngle - B.TiltAngle) < 0.01f
+			&& FMath::Abs(A.ExtensionLength - B.ExtensionLength) < 0.01f
+			&& A.GravityRotation.AngularDistance(B.GravityRotation) < 1e-3f
+			&& A.HeadRotation.AngularDistance(B.HeadRotation) < 1e-3f;
+
+		for (int32 k = 0; k < TECHNOCRANE_EXTENSION_BEAMS_COUNT; ++k)
+		{
+			bMatch &= FMath::Abs(A.BeamAdjustment[k] - B.BeamAdjustment[k]) < 0.01f;
+		}
+
+		NumMismatches += (bMatch) ? 0 : 1;
+	}
+
+	TestEqual(TEXT("Batch and per rig solutions match"), NumMismatches, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneRigBatchBenchmark, "Technocrane.Kinematics.Benchmark.BatchSolve", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FTechnocraneRigBatchBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneKinematicsTests;
+	using namespace NTechnocraneRigSolverTests;
+
+	FCraneRigGeometry Geometry;
+	MakeTestGeometry(Geometry);
+
+	constexpr int32 NumIterations = 100;
+	const int32 NumRigsToTest[] = { 1, 16, 256, 4096 };
+
+	for (const int32 NumRigs : NumRigsToTest)
+	{
+		FCraneRigBatch Batch;
+		const int32 PresetIndex = Batch.AddPreset(&Geometry, MakeTestPreset());
+		Batch.SetNum(NumRigs);
+
+		FRandomStream RandomStream(NumRigs);
+		for (int32 i = 0; i < NumRigs; ++i)
+		{
+			Batch.SetRig(i, PresetIndex, MakeInput(RandomStream, 600.0f, 400.0f));
+		}
+
+		FCraneRigBatch Reference(Batch);
+
+		// warm up worker threads
+		Batch.Solve();
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumIterations; ++i)
+		{
+			Batch.Solve();
+		}
+		const double BatchMs = 1000.0 * (FPlatformTime::Seconds() - StartTime) / NumIterations;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumIterations; ++i)
+		{
+			Reference.SolveEachRig();
+		}
+		const double ReferenceMs = 1000.0 * (FPlatformTime::Seconds() - StartTime) / NumIterations;
+
+		AddInfo(FString::Printf(TEXT("%d rigs: batch %.4f ms, %.3f us per rig, per rig solver %.4f ms (x%.1f)"),
+			NumRigs, BatchMs, 1000.0 * BatchMs / NumRigs, ReferenceMs, ReferenceMs / FMath::Max(BatchMs, 1e-6)));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneTrackLayoutTests.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneKinematicsTestRig.h"
+#include "TechnocraneReachField.h"
+#include "TechnocraneTrackLayout.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace NTechnocraneTrackLayoutTests
+{
+	constexpr int32 NumFrames = 120;
+	constexpr float TrackLength = 300.0f;
+
+	// a target of the crane at zero track position with the largest margin to limits, in the crane space
+	FVector FindBestTarget(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, float& OutMargin)
+	{
+		FVector BestTarget(FVector::ZeroVector);
+		OutMargin = -MAX_flt;
+
+		for (float X = 50.0f; X <= 800.0f; X += 10.0f)
+		{
+			for (float Z = -200.0f; Z <= 800.0f; Z += 10.0f)
+			{
+				FCraneRigReach Reach;
+				FCraneRigSolver::ComputeReach(Geometry, Preset, FVector(X, 0.0f, Z), 0.0f, Reach);
+
+				if (Reach.Margin > OutMargin)
+				{
+					OutMargin = Reach.Margin;
+					BestTarget = FVector(X, 0.0f, Z);
+				}
+			}
+		}
+		return BestTarget;
+	}
+
+	// the camera moves along the tracks, a crane at the origin pushed along them keeps the same pose
+	void MakeTrackPath(const FVector& Target, TArray<FVector>& OutTargets)
+	{
+		OutTargets.SetNumUninitialized(NumFrames);
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			OutTargets[Frame] = Target + FVector(0.0f, TrackLength * Frame / (NumFrames - 1), 0.0f);
+		}
+	}
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneTrackLayoutOptimizeTest, "Technocrane.Kinematics.TrackLayout.Optimize", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneTrackLayoutOptimizeTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneKinematicsTests;
+	using namespace NTechnocraneTrackLayoutTests;
+
+	FCraneRigGeometry Geometry;
+	if (!TestTrue(TEXT("Geometry is built"), MakeTestGeometry(Geometry)))
+	{
+		return false;
+	}
+
+	const FCraneRigPreset Preset = MakeTestPreset();
+
+	FCraneReachField Field;
+	Field.Build(Geometry, Preset, 10.0f);
+
+	float BestMargin = 0.0f;
+	const FVector BestTarget = FindBestTarget(Geometry, Preset, BestMargin);
+
+	// the field is quantized, the path has to be well inside of limits to be reached for sure
+	if (!TestTrue(TEXT("Test crane has a target well inside of limits"), BestMargin > 2.0f * Field.CellSize))
+	{
+		return false;
+	}
+
+	FCraneTrackLayoutSettings Settings;
+	Settings.TrackStart = 0.0f;
+	Settings.TrackLength = TrackLength;
+	Settings.MaxTrackStep = 5.0f;
+
+	// reachable, a crane at the origin follows the path along tracks with a step of 2.5 cm per frame
+	{
+		TArray<FVector> Targets;
+		MakeTrackPath(BestTarget, Targets);
+
+		FCraneTrackLayout Layout;
+		TestTrue(TEXT("Reachable path is laid out"), FCraneTrackLayoutOptimizer::Optimize(Geometry, Preset, Field, Targets, 0.0f, Settings, Layout));
+		TestEqual(TEXT("Track position for every frame"), Layout.TrackPositions.Num(), NumFrames);
+		TestTrue(TEXT("Reachable path is in reach"), Layout.MinMargin >= 0.0f);
+		TestTrue(TEXT("Reachable path is within the track step"), Layout.bWithinTrackStep);
+		TestTrue(TEXT("Largest track step is not over the limit"), Layout.LargestTrackStep <= Settings.MaxTrackStep + KINDA_SMALL_NUMBER);
+	}
+
+	// unreachable, the path is longer than the crane reaches from any placement on the tracks
+	{
+		TArray<FVector> Targets;
+		MakeTrackPath(BestTarget, Targets);
+
+		const float PathLength = 4.0f * (Geometry.MaxExtension + TrackLength);
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Targets[Frame].X += PathLength * Frame / (NumFrames - 1);
+		}
+
+		FCraneTrackLayout Layout;
+		TestTrue(TEXT("Unreachable path is laid out"), FCraneTrackLayoutOptimizer::Optimize(Geometry, Preset, Field, Targets, 0.0f, Settings, Layout));
+		TestTrue(TEXT("Unreachable path is out of reach"), Layout.MinMargin < 0.0f);
+		TestTrue(TEXT("Unreachable path is within the track step"), Layout.bWithinTrackStep);
+	}
+
+	// the track step is finer than the finest track states, the track moves by one state and a move over the step is reported
+	{
+		TArray<FVector> Targets;
+		MakeTrackPath(BestTarget, Targets);
+
+		FCraneTrackLayoutSettings SlowSettings = Settings;
+		SlowSettings.MaxTrackStep = 0.5f;
+
+		const float FinestSpacing = TrackLength / (FCraneTrackLayoutOptimizer::MaxTrackStates - 1);
+
+		FCraneTrackLayout Layout;
+		TestTrue(TEXT("Slow path is laid out"), FCraneTrackLayoutOptimizer::Optimize(Geometry, Preset, Field, Targets, 0.0f, SlowSettings, Layout));
+		TestTrue(TEXT("Slow path moves by one track state at most"), Layout.LargestTrackStep <= FinestSpacing + KINDA_SMALL_NUMBER);
+		TestEqual(TEXT("Slow path over the track step is reported"), Layout.bWithinTrackStep, Layout.LargestTrackStep <= SlowSettings.MaxTrackStep + KINDA_SMALL_NUMBER);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
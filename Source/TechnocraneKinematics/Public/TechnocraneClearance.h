@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClearance.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TechnocraneRigSolver.h"
+
+/** a capsule around a part of the crane, segment ends are in the space of the given pose */
+struct FCraneClearanceCapsule
+{
+	FVector Start{ FVector::ZeroVector };
+	FVector End{ FVector::ZeroVector };
+	float Radius{ 0.0f };
+	/** crane joint at the start of the segment, names the crane part */
+	int32 Joint{ INDEX_NONE };
+
+	FVector GetCenter() const { return 0.5 * (Start + End); }
+	float GetHalfLength() const { return 0.5f * static_cast<float>((End - Start).Size()); }
+	/** rotation of an up aligned capsule shape to the segment direction */
+	FQuat GetRotation() const { return FQuat::FindBetweenNormals(FVector::UpVector, (End - Start).GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector)); }
+};
+
+/** radius of the crane body around column, beams and head segments, in cm */
+struct FCraneClearanceRadii
+{
+	float Column{ 30.0f };
+	float Beam{ 15.0f };
+	float Head{ 35.0f };
+};
+
+/**
+ * Crane body approximated by capsules along the column, the beams and the head, to check clearance against a set.
+ *  Segments connect neighbour crane joints presented in the geometry, short segments are skipped.
+ */
+class TECHNOCRANEKINEMATICS_API FCraneRigClearance
+{
+public:
+	static constexpr int32 MaxCapsules = 12;
+
+	static void MakeCapsules(const FCraneRigGeometry& Geometry, const FCraneRigPose& Pose, const FCraneClearanceRadii& Radii, TArray<FCraneClearanceCapsule, TFixedAllocator<MaxCapsules>>& OutCapsules);
+};
@@ -0,0 +1,50 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneLensTable.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Lens encoder calibration as a dense lookup table.
+ *  Calibration points (encoder, value) are resampled into equally spaced entries over the encoder range,
+ *  so a lookup is a multiply, a clamp and a lerp between two neighbour entries without a search.
+ */
+struct TECHNOCRANEKINEMATICS_API FCraneLensTable
+{
+	float EncoderMin{ 0.0f };
+	float EncoderMax{ 1.0f };
+	/** entries per encoder unit */
+	float InvStep{ 0.0f };
+	/** values for equally spaced encoder positions, the last one is repeated to skip a bounds check */
+	TArray<float> Values;
+
+	/**
+	 * resample calibration points into a table
+	 * @param Points encoder (X) to value (Y) pairs, sorted by the encoder on the way
+	 * @param NumEntries number of table entries over the encoder range
+	 * @return false if there are less than two points or values are not monotonic
+	 */
+	bool Build(TArrayView<const FVector2f> Points, const int32 NumEntries);
+
+	bool IsValid() const { return Values.Num() > 2; }
+	void Reset() { *this = FCraneLensTable(); }
+
+	/** an encoder value out of the calibrated range is clamped */
+	FORCEINLINE float Evaluate(const float Encoder) const
+	{
+		const float Position = FMath::Clamp((Encoder - EncoderMin) * InvStep, 0.0f, static_cast<float>(Values.Num() - 2));
+		const int32 Index = static_cast<int32>(Position);
+		const float Alpha = Position - static_cast<float>(Index);
+
+		const float* Data = Values.GetData() + Index;
+		return Data[0] + Alpha * (Data[1] - Data[0]);
+	}
+
+	/** evaluate many encoder values at once, four at a time with vector math */
+	void Evaluate(TArrayView<const float> Encoders, TArrayView<float> OutValues) const;
+};
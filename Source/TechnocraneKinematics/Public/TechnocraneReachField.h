@@ -0,0 +1,57 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneReachField.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TechnocraneRigSolver.h"
+
+/**
+ * Precomputed margin to crane limits around the crane column.
+ *  The column rotates freely, so the reachable volume is symmetric around the column axis
+ *  and is stored as a 2d grid of (distance to the column axis, height) with quantized margins.
+ *  Positions are in a crane component space, the column axis moves along the tracks with a track position.
+ */
+struct TECHNOCRANEKINEMATICS_API FCraneReachField
+{
+	/** grid step in cm */
+	float CellSize{ 10.0f };
+	/** height of the first grid row in a crane component space */
+	float MinHeight{ 0.0f };
+	int32 NumRadial{ 0 };
+	int32 NumHeight{ 0 };
+
+	/** cm per one quantized unit */
+	float MarginStep{ 0.1f };
+	/** NumRadial x NumHeight margins, rows go by height */
+	TArray<int16> Margins;
+
+	/** kinematics the field is built for, a hash of geometry and preset values that margins depend on */
+	uint32 SourceHash{ 0 };
+
+	/** sample the crane kinematics over the grid, work is split by rows with ParallelFor */
+	void Build(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const float InCellSize);
+
+	bool IsValid() const { return NumRadial > 1 && NumHeight > 1 && Margins.Num() == NumRadial * NumHeight; }
+
+	/** false when the field is built for another crane or for older preset data, or was loaded from an older layout */
+	bool IsBuiltFor(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset) const { return IsValid() && SourceHash == GetSourceHash(Geometry, Preset); }
+
+	static uint32 GetSourceHash(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset);
+
+	void Reset() { *this = FCraneReachField(); }
+
+	/** signed distance to the closest crane limit in cm, negative when a position is out of reach */
+	float GetMargin(const FVector& Position, const float TrackPosition) const;
+
+	void GetMargins(TArrayView<const FVector> Positions, const float TrackPosition, TArrayView<float> OutMargins) const;
+
+	friend TECHNOCRANEKINEMATICS_API FArchive& operator<<(FArchive& Ar, FCraneReachField& Field);
+
+private:
+	float Sample(const float Radius, const float Height) const;
+};
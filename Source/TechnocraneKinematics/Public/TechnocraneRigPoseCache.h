@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneRigPoseCache.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/FrameRate.h"
+#include "TechnocraneRigSolver.h"
+
+/**
+ * Crane joint transforms baked for every frame of a shot.
+ *  A pose at any time of the shot is an interpolation of two neighbour frames, the solver is not involved.
+ *  Joints are stored with single precision rotations and translations, all joints of a frame side by side.
+ */
+struct TECHNOCRANEKINEMATICS_API FCraneRigPoseCache
+{
+	static constexpr int32 JointCount = FCraneRigGeometry::JointCount;
+
+	/** simulation output that goes along with a frame pose */
+	struct FFrame
+	{
+		float GroundHeight{ 0.0f };
+		float TiltAngle{ 0.0f };
+		float ExtensionLength{ 0.0f };
+	};
+
+	FFrameRate FrameRate{ 24, 1 };
+	/** JointCount entries per frame */
+	TArray<FQuat4f> Rotations;
+	TArray<FVector3f> Translations;
+	TArray<FFrame> Frames;
+
+	/**
+	 * solve the crane for every frame in parallel on worker threads
+	 * @param Inputs solver inputs, one per frame starting from the shot start
+	 */
+	void Build(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, TArrayView<const FCraneRigSolverInput> Inputs, const FFrameRate InFrameRate);
+
+	int32 Num() const { return Frames.Num(); }
+	bool IsValid() const { return Frames.Num() > 0 && Rotations.Num() == Frames.Num() * JointCount; }
+	void Reset() { *this = FCraneRigPoseCache(); }
+
+	/** interpolated pose and simulation output, a time out of the shot is clamped */
+	void Evaluate(const double Seconds, FCraneRigPose& OutPose, FCraneRigSolution& OutSolution) const;
+
+	SIZE_T GetAllocatedSize() const { return Rotations.GetAllocatedSize() + Translations.GetAllocatedSize() + Frames.GetAllocatedSize(); }
+};
+
+using FCraneRigPoseCachePtr = TSharedPtr<const FCraneRigPoseCache, ESPMode::ThreadSafe>;
@@ -0,0 +1,263 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneRigSolver.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#define TECHNOCRANE_EXTENSION_BEAMS_COUNT	4
+
+/**
+ * Crane joints known by the kinematics, the order has to match ECraneJoints of the plugin runtime module
+ *  the module depends only on Core, so the reflected enum can't be used here
+ */
+namespace ECraneKinematicsJoint
+{
+	enum Type : int32
+	{
+		Base = 0,
+		Columns,
+		Column1,
+		Column2,
+		Column3,
+		Beams,
+		Beam1,
+		Beam2,
+		Beam3,
+		Beam4,
+		Beam5,
+		Gravity,
+		Neck,
+		Head,
+
+		WheelFR,
+		WheelFL,
+		WheelRR,
+		WheelRL,
+
+		Count
+	};
+};
+
+/** a subset of crane preset values that the rig solver depends on */
+struct FCraneRigPreset
+{
+	float ZOffsetOnGround{ 36.0f };
+	float TiltMin{ 55.0f };
+	float TiltMax{ 55.0f };
+};
+
+/**
+ * Crane geometry derived from a skeleton reference pose.
+ *  Every crane joint is stored relative to the closest crane joint up in the hierarchy,
+ *  that is enough to compute component space transforms of a crane without a skeleton or a pose.
+ */
+struct TECHNOCRANEKINEMATICS_API FCraneRigGeometry
+{
+	static constexpr int32 JointCount = ECraneKinematicsJoint::Count;
+
+	/** number of joints presented in the skeleton */
+	int32 NumJoints{ 0 };
+	/** presented joints sorted in a hierarchy order, parents go first */
+	int32 JointOrder[JointCount];
+
+	bool bHasJoint[JointCount]{ false };
+	/** index of the joint in a reference skeleton */
+	int32 RefBoneIndex[JointCount];
+	/** closest crane joint up in the hierarchy, INDEX_NONE when there is no crane joint above */
+	int32 ParentJoint[JointCount];
+	/** reference transform of a skeleton parent bone relative to the ParentJoint (or to the component when there is no parent joint) */
+	FTransform ParentOffset[JointCount];
+	/** reference local transform of the joint */
+	FTransform RefLocal[JointCount];
+
+	/** a joint that performs a horizontal rotation (column around up axis) */
+	int32 ColumnRotationBone{ ECraneKinematicsJoint::Columns };
+
+	float DistCamHeadAndNeck{ 0.0f };
+	float GravityOffsetLen{ 0.0f };
+	float Beam1Length{ 0.0f };
+	/** reference length of Beam2..Beam5, the max length a beam can reach */
+	float BeamMaxLength[TECHNOCRANE_EXTENSION_BEAMS_COUNT]{ 0.0f };
+	/** range of a distance between the beams pivot and the camera head that the beams extension can cover */
+	float MinExtension{ 0.0f };
+	float MaxExtension{ 0.0f };
+
+	FCraneRigGeometry();
+
+	/**
+	 * derive crane geometry from a reference pose, returns false if required crane joints are missing
+	 * @param RefPose reference local transforms of skeleton bones
+	 * @param ParentIndices a parent bone index for every bone, INDEX_NONE for a root bone
+	 * @param JointBoneIndices a bone index for every crane joint, INDEX_NONE when the joint is missing
+	 * @param InColumnRotationBone a joint that performs a horizontal rotation
+	 */
+	bool Build(TArrayView<const FTransform> RefPose, TArrayView<const int32> ParentIndices, const int32(&JointBoneIndices)[JointCount], const int32 InColumnRotationBone);
+
+	bool IsValid() const { return bIsValid; }
+	bool HasJoint(const int32 Joint) const { return bHasJoint[Joint]; }
+
+	/** derived geometry is stored with crane presets, so a simulation doesn't need to load a crane model */
+	friend TECHNOCRANEKINEMATICS_API FArchive& operator<<(FArchive& Ar, FCraneRigGeometry& Geometry);
+
+private:
+	bool bIsValid{ false };
+};
+
+/** per rig input, target is in a crane component space */
+struct FCraneRigSolverInput
+{
+	FVector Target{ FVector::ZeroVector };
+	float TrackPosition{ 0.0f };
+	FVector RawRotation{ FVector::ZeroVector };
+	FQuat NeckQ{ FQuat::Identity };
+};
+
+/** solved crane joint values */
+struct FCraneRigSolution
+{
+	float GroundHeight{ 0.0f };
+	/** column rotation around up, in degrees */
+	float ColumnYaw{ 0.0f };
+	/** beams tilt, clamped by preset limits, in degrees */
+	float TiltAngle{ 0.0f };
+	float ExtensionLength{ 0.0f };
+
+	/** beams Beam2..Beam5 have to be extended or shrinked to reach the target */
+	bool bBeamsAdjusted{ false };
+	float BeamAdjustment[TECHNOCRANE_EXTENSION_BEAMS_COUNT]{ 0.0f };
+
+	/** gravity joint counter rotation, in a local space */
+	FQuat GravityRotation{ FQuat::Identity };
+	/** neck and head rotations in a component space */
+	FQuat NeckRotation{ FQuat::Identity };
+	FQuat HeadRotation{ FQuat::Identity };
+};
+
+/** how far a target is from crane limits, limits are not applied */
+struct FCraneRigReach
+{
+	/** column rotation around up, in degrees */
+	float ColumnYaw{ 0.0f };
+	/** beams tilt required to reach the target, in degrees */
+	float TiltAngle{ 0.0f };
+	/** distance from the beams pivot required to reach the target */
+	float ExtensionLength{ 0.0f };
+	/** signed distance to the closest limit (tilt or extension) in cm, negative when the target is out of reach */
+	float Margin{ 0.0f };
+
+	FVector BeamsPivot{ FVector::ZeroVector };
+};
+
+/** component space transforms of crane joints */
+struct FCraneRigPose
+{
+	FTransform ComponentSpace[FCraneRigGeometry::JointCount];
+};
+
+/**
+ * Crane kinematics, column yaw, beams tilt, beams extension distribution, gravity counter rotation and neck/head
+ *  The solver doesn't depend on an animation graph, it's shared between the anim node and the batch API
+ */
+class TECHNOCRANEKINEMATICS_API FCraneRigSolver
+{
+public:
+	static void Solve(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const FCraneRigSolverInput& Input, FCraneRigSolution& OutSolution);
+
+	/** compute component space transforms of presented crane joints for a solution */
+	static void BuildPose(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const float TrackPosition, const FCraneRigSolution& Solution, FCraneRigPose& OutPose);
+
+	/** measure a margin to tilt and extension limits for a target in a crane component space */
+	static void ComputeReach(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const FVector& Target, const float TrackPosition, FCraneRigReach& OutReach);
+};
+
+/**
+ * Constants of a lane solve for one preset. Column yaw only rotates the beams pivot around up,
+ *  so the column and beams part of the chain reduces to a few numbers at zero yaw and tilt.
+ *  bIsValid is false when the reduced chain doesn't match the solver, rigs of such preset are solved one by one.
+ */
+struct TECHNOCRANEKINEMATICS_API FCraneRigLaneGeometry
+{
+	bool bIsValid{ false };
+
+	// column pivot at a zero track position
+	float ColumnX{ 0.0f };
+	float ColumnY{ 0.0f };
+	float ColumnZ{ 0.0f };
+	// beams pivot relative to the column pivot at a zero yaw
+	float ArmX{ 0.0f };
+	float ArmY{ 0.0f };
+	float ArmZ{ 0.0f };
+	// column forward at a zero yaw, in a horizontal plane
+	float ForwardX{ 0.0f };
+	float ForwardY{ 0.0f };
+
+	float DistCamHeadAndNeck{ 0.0f };
+	float TiltMin{ 0.0f };
+	float TiltMax{ 0.0f };
+	/** distance between the beams pivot and the head in a reference pose */
+	float RefHeadDistance{ 0.0f };
+
+	/** beams orientation at a zero yaw, the roll is a tilt */
+	float BeamsPitch{ 0.0f };
+	float BeamsYaw{ 0.0f };
+	FQuat BeamsParentInverse{ FQuat::Identity };
+	/** Beam2..Beam5 relative to the beams pivot, in a beams space with a scale applied */
+	FVector BeamOffsets[TECHNOCRANE_EXTENSION_BEAMS_COUNT];
+
+	void Build(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset);
+};
+
+/**
+ * Solve many crane rigs at once. Input and output are stored in a structure-of-arrays layout,
+ *  presets and geometry are shared between rigs and referred by index.
+ *  Column yaw, beams tilt and extension are solved for four rigs at a time on vector registers,
+ *  beams distribution and rotations are solved per rig without evaluating the joints chain.
+ */
+struct TECHNOCRANEKINEMATICS_API FCraneRigBatch
+{
+	// shared presets, the geometry has to be alive while the batch is solving
+	TArray<const FCraneRigGeometry*> Geometries;
+	TArray<FCraneRigPreset> Presets;
+	TArray<FCraneRigLaneGeometry> LaneGeometries;
+
+	// per rig input
+	TArray<int32> PresetIndex;
+	TArray<float> TargetX;
+	TArray<float> TargetY;
+	TArray<float> TargetZ;
+	TArray<float> TrackPosition;
+	TArray<float> RawTilt;
+	TArray<FQuat> NeckQ;
+
+	// per rig output
+	TArray<float> GroundHeight;
+	TArray<float> ColumnYaw;
+	TArray<float> TiltAngle;
+	TArray<float> ExtensionLength;
+	TArray<uint8> BeamsAdjusted;
+	TArray<float> BeamAdjustment[TECHNOCRANE_EXTENSION_BEAMS_COUNT];
+	TArray<FQuat> GravityRotation;
+	TArray<FQuat> HeadRotation;
+
+	int32 AddPreset(const FCraneRigGeometry* InGeometry, const FCraneRigPreset& InPreset);
+
+	void SetNum(const int32 NumRigs);
+	int32 Num() const { return PresetIndex.Num(); }
+
+	void SetRig(const int32 Index, const int32 InPresetIndex, const FCraneRigSolverInput& Input);
+	void GetSolution(const int32 Index, FCraneRigSolution& OutSolution) const;
+
+	/** solve all rigs, work is split into chunks with ParallelFor */
+	void Solve();
+
+	/** solve every rig with FCraneRigSolver, a reference for the lane solve */
+	void SolveEachRig();
+
+	/** rigs processed by one task */
+	static constexpr int32 ChunkSize = 64;
+};
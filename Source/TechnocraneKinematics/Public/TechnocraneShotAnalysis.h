@@ -0,0 +1,74 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneShotAnalysis.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TechnocraneRigSolver.h"
+
+/** crane limits that a shot frame goes beyond */
+namespace ECraneLimitFlags
+{
+	enum Type : uint8
+	{
+		None = 0,
+		TiltMin = 1 << 0,
+		TiltMax = 1 << 1,
+		ExtensionMin = 1 << 2,
+		ExtensionMax = 1 << 3,
+		PanMin = 1 << 4,
+		PanMax = 1 << 5,
+
+		Tilt = TiltMin | TiltMax,
+		Extension = ExtensionMin | ExtensionMax,
+		Pan = PanMin | PanMax
+	};
+};
+
+/** pan limits are not part of the rig solver, the column rotates freely there */
+struct FCraneShotLimits
+{
+	FCraneRigPreset Preset;
+
+	float PanMin{ 270.0f };
+	float PanMax{ 270.0f };
+};
+
+/** crane state required to follow a shot frame, limits are not applied */
+struct FCraneShotFrame
+{
+	float TiltAngle{ 0.0f };
+	float ExtensionLength{ 0.0f };
+	/** column rotation from the crane forward, unwrapped over the shot */
+	float PanAngle{ 0.0f };
+
+	/** how much of a limit range is used, 1 is at the limit, more than 1 is beyond the limit */
+	float TiltUsage{ 0.0f };
+	float ExtensionUsage{ 0.0f };
+	float PanUsage{ 0.0f };
+
+	/** ECraneLimitFlags */
+	uint8 Flags{ ECraneLimitFlags::None };
+};
+
+/**
+ * Run the crane kinematics for every frame of a shot and find frames where the crane can't follow the camera
+ */
+class TECHNOCRANEKINEMATICS_API FCraneShotAnalysis
+{
+public:
+
+	/**
+	 * @param Targets crane target for every frame in a crane component space
+	 * @param TrackPositions a track position for every frame, or a single value for the whole shot
+	 */
+	static void Analyze(const FCraneRigGeometry& Geometry, const FCraneShotLimits& Limits,
+		TArrayView<const FVector> Targets, TArrayView<const float> TrackPositions, TArray<FCraneShotFrame>& OutFrames);
+
+	/** frames processed by one task */
+	static constexpr int32 ChunkSize = 256;
+};
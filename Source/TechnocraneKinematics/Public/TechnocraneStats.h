@@ -0,0 +1,12 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneStats.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("Technocrane"), STATGROUP_Technocrane, STATCAT_Advanced);
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneTakeSamples.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/FrameRate.h"
+#include "Misc/FrameTime.h"
+
+/** channels of a recorded crane take, location in cm and rotation in degrees are already in the engine space */
+enum class ECraneTakeChannel : uint8
+{
+	LocationX,
+	LocationY,
+	LocationZ,
+	Pitch,
+	Yaw,
+	Roll,
+	Zoom,
+	Iris,
+	Focus,
+	TrackPosition,
+	Count
+};
+
+/**
+ * Crane take samples at a hardware rate, without keys and tangents.
+ *  Samples are stored in a single array one after another with all channels of a sample side by side,
+ *  so a sample time maps to an array index and an evaluation reads two neighbour samples.
+ */
+struct TECHNOCRANEKINEMATICS_API FCraneTakeSamples
+{
+	static constexpr int32 NumChannels = static_cast<int32>(ECraneTakeChannel::Count);
+
+	/** hardware rate the take is recorded with */
+	FFrameRate SampleRate{ 100, 1 };
+	/** timecode of the first sample as a frame number in the sample rate */
+	FFrameNumber StartFrame{ 0 };
+	/** NumChannels values per sample */
+	TArray<float> Values;
+
+	void Reset(const FFrameRate InSampleRate, const FFrameNumber InStartFrame, const int32 NumSamplesToReserve = 0);
+
+	void AddSample(TArrayView<const float> Sample);
+
+	int32 Num() const { return Values.Num() / NumChannels; }
+	bool IsEmpty() const { return Values.Num() < NumChannels; }
+
+	/** frame after the last sample, in the sample rate */
+	FFrameNumber GetEndFrame() const { return StartFrame + Num(); }
+
+	float GetValue(const int32 SampleIndex, const ECraneTakeChannel Channel) const
+	{
+		return Values[SampleIndex * NumChannels + static_cast<int32>(Channel)];
+	}
+
+	/**
+	 * linear interpolation between two neighbour samples, a time out of the take is clamped
+	 * @param SampleTime absolute time (timecode) in the sample rate
+	 */
+	void Evaluate(const FFrameTime SampleTime, TArrayView<float> OutSample) const;
+
+	SIZE_T GetAllocatedSize() const { return Values.GetAllocatedSize(); }
+
+	friend TECHNOCRANEKINEMATICS_API FArchive& operator<<(FArchive& Ar, FCraneTakeSamples& Samples);
+};
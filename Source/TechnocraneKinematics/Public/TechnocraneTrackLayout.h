@@ -0,0 +1,81 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneTrackLayout.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TechnocraneRigSolver.h"
+
+struct FCraneReachField;
+
+/** a search space of a crane layout */
+struct FCraneTrackLayoutSettings
+{
+	/** track positions where the run of tracks begins and its length in cm, zero length for a crane without tracks */
+	float TrackStart{ 0.0f };
+	float TrackLength{ 0.0f };
+	/** the largest track position change between neighbour frames, in cm */
+	float MaxTrackStep{ 10.0f };
+
+	/** half size of a square around the camera path to place the crane base in, zero to derive it from the crane reach */
+	float SearchExtent{ 0.0f };
+	/** coarse grid step of base placements, in cm */
+	float PlacementStep{ 25.0f };
+	/** coarse step of track headings, in degrees */
+	float HeadingStep{ 15.0f };
+};
+
+/** a crane base placement, a heading of the run of tracks and a track position for every frame */
+struct FCraneTrackLayout
+{
+	/** crane base location, on the base height */
+	FVector BaseLocation{ FVector::ZeroVector };
+	/** crane yaw in degrees, tracks run along the crane Y axis */
+	float Heading{ 0.0f };
+	TArray<float> TrackPositions;
+
+	/** the smallest margin to tilt and extension limits over the shot, checked by the rig solver, negative when a frame is out of reach */
+	float MinMargin{ 0.0f };
+	/** the largest track position change between neighbour frames of the layout, in cm */
+	float LargestTrackStep{ 0.0f };
+	/** false when the largest track step is over the max track step of the settings, the layout is not usable then */
+	bool bWithinTrackStep{ true };
+	/** layouts scored during the search */
+	int32 NumCandidates{ 0 };
+};
+
+/**
+ * Search a crane placement and track positions to follow a camera path with the largest margin to crane limits.
+ *  Candidates are scored with a reach field in parallel: a coarse grid over a subset of frames, then a finer search
+ *  around the best candidates over all frames. Track positions are a max-min path over quantized track states
+ *  with a limited step between frames. The best layout is checked frame by frame with the rig solver.
+ *  Final track states are as fine as MaxTrackStates allow with a whole number of states per max track step,
+ *  the track moves by several states per frame up to the step. A track run too long for one state to be within the step
+ *  moves by one state per frame, and such a layout is reported over the track step.
+ */
+class TECHNOCRANEKINEMATICS_API FCraneTrackLayoutOptimizer
+{
+public:
+
+	/**
+	 * @param Field reach margins of the crane preset
+	 * @param Targets crane target for every frame, Z is up
+	 * @param BaseHeight the crane base is placed at the height
+	 * @return false when there is nothing to place the crane for
+	 */
+	static bool Optimize(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const FCraneReachField& Field,
+		TArrayView<const FVector> Targets, const float BaseHeight, const FCraneTrackLayoutSettings& Settings, FCraneTrackLayout& OutLayout);
+
+	/** frames of the coarse search, the shot is subsampled evenly */
+	static constexpr int32 MaxCoarseFrames = 240;
+	/** placements along one axis of the coarse grid */
+	static constexpr int32 MaxCoarsePlacements = 81;
+	static constexpr int32 NumCoarseTrackStates = 9;
+	static constexpr int32 MaxTrackStates = 257;
+	/** best coarse candidates that are searched around on all frames */
+	static constexpr int32 NumRefinedCandidates = 8;
+};
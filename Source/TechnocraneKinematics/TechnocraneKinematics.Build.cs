@@ -0,0 +1,31 @@
+// Copyright (c) 2025 Technocrane s.r.o. 
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneKinematics.Build.cs
+// Sergei <Neill3d> Solokhin
+
+using Path = System.IO.Path;
+
+namespace UnrealBuildTool.Rules
+{
+	// crane kinematics without engine dependencies, can be used by offline tools, render nodes and headless builds
+	public class TechnocraneKinematics : ModuleRules
+	{
+        public TechnocraneKinematics(ReadOnlyTargetRules Target) : base(Target)
+		{
+            PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+            bLegacyPublicIncludePaths = false;
+
+            PublicIncludePaths.Add(Path.Combine(ModuleDirectory, "Public"));
+
+            PublicDependencyModuleNames.AddRange(
+				new string[]
+				{
+                    "Core"
+                }
+			);
+        }
+    }
+}
@@ -17,9 +17,12 @@
 #include <Runtime/CinematicCamera/Public/CineCameraComponent.h>
 #include <TechnocraneCameraComponent.h>
 #include "TechnocraneShared.h"
+#include "TechnocraneRigKinematics.h"
+#include "TechnocraneReachabilityField.h"
+#include "TechnocranePrivatePCH.h"
 
-#include "Features/IModularFeatures.h"
-#include "Interfaces/IPluginManager.h"
+#include "TechnocraneLiveLinkClient.h"
+#include "TechnocraneStats.h"
 
 #include "LiveLinkComponentController.h"
 #include "ILiveLinkClient.h"
@@ -31,126 +34,41 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AnimNode_TechnocraneRig)
 
-namespace NTechnocraneRigInternal
+DECLARE_CYCLE_STAT(TEXT("Technocrane Rig PreUpdate (game thread)"), STAT_TechnocraneRigPreUpdate, STATGROUP_Technocrane);
+DECLARE_CYCLE_STAT(TEXT("Technocrane Rig LiveLink (worker)"), STAT_TechnocraneRigLiveLink, STATGROUP_Technocrane);
+DECLARE_CYCLE_STAT(TEXT("Technocrane Rig Update"), STAT_TechnocraneRigUpdate, STATGROUP_Technocrane);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Technocrane Rig Updates on Workers"), STAT_TechnocraneRigWorkerUpdates, STATGROUP_Technocrane);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Technocrane Rig Updates on Game Thread"), STAT_TechnocraneRigGameThreadUpdates, STATGROUP_Technocrane);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Technocrane Rigs Updated"), STAT_TechnocraneRigsUpdated, STATGROUP_Technocrane);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Technocrane Rig Pose Cache Hits"), STAT_TechnocraneRigPoseCacheHits, STATGROUP_Technocrane);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Technocrane Rig Pose Cache Misses"), STAT_TechnocraneRigPoseCacheMisses, STATGROUP_Technocrane);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Technocrane Rig Pose Cache Time Saved (ms)"), STAT_TechnocraneRigPoseCacheTimeSaved, STATGROUP_Technocrane);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Technocrane Rig Baked Poses"), STAT_TechnocraneRigBakedPoses, STATGROUP_Technocrane);
+
+namespace NAnimNodeTechnocraneRig
 {
-	// Beam structure to hold individual beam properties
-	struct FBeamData
-	{
-		float CurrentLength;
-		float MinLength;        // Absolute minimum length the beam can have
-		float MaxLength;        // Absolute maximum length the beam can have
-		float Adjustment;       // Output: how much to adjust this beam (+/- value)
-		FCompactPoseBoneIndex BeamBone;
-		FCompactPoseBoneIndex ParentBone;
-		FName BeamBoneName;
-
-		FBeamData(float Current, float Min, float Max, FCompactPoseBoneIndex InBone, FCompactPoseBoneIndex InParent, const FName& BoneName)
-			: CurrentLength(Current), MinLength(Min), MaxLength(Max), Adjustment(0.0f), BeamBone(InBone), ParentBone(InParent), BeamBoneName(BoneName) {}
-
-		float GetAdjustedLength() const { return CurrentLength + Adjustment; }
-
-		// How much we can extend this beam (positive value)
-		float GetMaxPossibleExtension() const { return MaxLength - CurrentLength; }
-
-		// How much we can shrink this beam (negative value)  
-		float GetMaxPossibleShrinkage() const { return MinLength - CurrentLength; }
-
-		// Total adjustment range available for this beam
-		float GetTotalAdjustmentRange() const { return MaxLength - MinLength; }
-	};
-
-	// Alternative algorithm: Equal distribution with overflow handling
-	void CalculateBeamAdjustmentsEqual(TArray<FBeamData, TInlineAllocator<4>>& Beams, float CurrentTotalLength, float TargetLength, float BaseBeamLength)
-	{
-		if (Beams.IsEmpty())
-			return;
-
-		const float RequiredAdjustment = TargetLength - BaseBeamLength;
-		const float AdjustmentPerBeam = RequiredAdjustment / Beams.Num();
-		float RemainingAdjustment = RequiredAdjustment;
-
-		// Reset all adjustments
-		for (FBeamData& Beam : Beams)
-		{
-			Beam.Adjustment = 0.0f;
-		}
-
-		if (FMath::IsNearlyZero(RequiredAdjustment))
-		{
-			return; // Already at target, no adjustments needed
-		}
-
-		// First pass: try to distribute equally
-		for (FBeamData& Beam : Beams)
-		{
-			const float ClampedAdjustment = FMath::Clamp(AdjustmentPerBeam, Beam.MinLength, Beam.MaxLength);
-
-			Beam.Adjustment = ClampedAdjustment;
-			RemainingAdjustment -= ClampedAdjustment;
-		}
+	// when a target camera doesn't have a live link controller, look for it again from time to time
+	constexpr uint64 ComponentLookupInterval = 60;
 
-		constexpr float Thres{ 0.001f };
-
-		// Second pass: distribute remaining adjustment to beams that can still accommodate it
-		while (!FMath::IsNearlyZero(RemainingAdjustment) && FMath::Abs(RemainingAdjustment) > Thres)
-		{
-			int32 AvailableBeams = 0;
-
-			// Count beams that can still be adjusted
-			for (int32 i = 0; i < Beams.Num(); i++)
-			{
-				FBeamData& Beam = Beams[i];
-				if (RemainingAdjustment > 0.0f && Beam.GetAdjustedLength() < Beam.MaxLength - Thres)
-				{
-					AvailableBeams++;
-				}
-				else if (RemainingAdjustment < 0.0f && Beam.GetAdjustedLength() > Beam.MinLength + Thres)
-				{
-					AvailableBeams++;
-				}
-			}
-
-			if (AvailableBeams == 0) break;
-
-			float AdjustmentPerAvailableBeam = RemainingAdjustment / AvailableBeams;
-			float OldRemainingAdjustment = RemainingAdjustment;
-
-			for (int32 i = 0; i < Beams.Num(); i++)
-			{
-				FBeamData& Beam = Beams[i];
-				bool CanAdjust = false;
-
-				if (RemainingAdjustment > 0.0f
-					&& (Beam.GetAdjustedLength() < Beam.MaxLength - Thres || Beam.GetAdjustedLength() > Beam.MinLength + Thres))
-				{
-					CanAdjust = true;
-				}
-
-				if (CanAdjust)
-				{
-					const float AdditionalAdjustment = FMath::Clamp(AdjustmentPerAvailableBeam, Beam.MinLength, Beam.MaxLength);
-
-					Beam.Adjustment += AdditionalAdjustment;
-					RemainingAdjustment -= AdditionalAdjustment;
-				}
-			}
-
-			// Prevent infinite loop
-			if (FMath::Abs(RemainingAdjustment - OldRemainingAdjustment) < 0.001f)
-			{
-				break;
-			}
-		}
-	}
-
-	float GetSignedAngle(const FVector& RefNormalX, FVector& RefNormalY, const FVector& RefTangent)
-	{
-		const FVector CrossProduct = FVector::CrossProduct(RefNormalX, RefNormalY);
-		const float PositiveAngle = atan2(CrossProduct.Length(), FVector::DotProduct(RefNormalX, RefNormalY));
-		return (FVector::DotProduct(RefTangent, CrossProduct) < 0.0) ? -PositiveAngle : PositiveAngle;
-	}
+	// crane inputs closer than that are treated as unchanged
+	constexpr float PositionTolerance{ 0.01f };
+	constexpr float AngleTolerance{ 0.001f };
+	constexpr float QuatTolerance{ 1.e-6f };
 };
 
+bool FCraneRigInputSnapshot::Equals(const FCraneRigInputSnapshot& Other) const
+{
+	using namespace NAnimNodeTechnocraneRig;
+
+	return Target.Equals(Other.Target, PositionTolerance)
+		&& FMath::IsNearlyEqual(TrackPosition, Other.TrackPosition, PositionTolerance)
+		&& RawRotation.Equals(Other.RawRotation, AngleTolerance)
+		&& NeckQ.Equals(Other.NeckQ, QuatTolerance)
+		&& CameraPivotOffset.Equals(Other.CameraPivotOffset, PositionTolerance)
+		&& Preset.ZOffsetOnGround == Other.Preset.ZOffsetOnGround
+		&& Preset.TiltMin == Other.Preset.TiltMin
+		&& Preset.TiltMax == Other.Preset.TiltMax;
+}
 
 void FAnimNode_TechnocraneRig::Initialize_AnyThread(const FAnimationInitializeContext& Context)
 {
@@ -176,24 +94,20 @@ void FAnimNode_TechnocraneRig::CacheBones_AnyThread(const FAnimationCacheBonesCo
 	const USkeletalMesh* SkeletalMesh = RequiredBones.GetSkeletalMeshAsset();
 	const FReferenceSkeleton& MeshRefSkeleton = SkeletalMesh->GetRefSkeleton();
 
-	ColumnRotationBone = ECraneJoints::Columns;
+	Geometry = FTechnocranePresetRegistry::Get().FindOrBuildGeometry(SkeletalMesh, CraneData.ColumnRotationBone);
+	bPoseCacheValid = false;
+
+	if (!Geometry.IsValid())
+	{
+		return;
+	}
 
 	const int32 CraneJointsCount = static_cast<int32>(ECraneJoints::JointCount);
 	for (int32 i = 0; i < CraneJointsCount; ++i)
 	{
 		const ECraneJoints JointId = static_cast<ECraneJoints>(i);
-		const FName JointName(GetCraneJointName(JointId));
 
-		if (CraneData.ColumnRotationBone == JointName)
-		{
-			ColumnRotationBone = JointId;
-		}
-
-		int32 JointRefIndex = MeshRefSkeleton.FindBoneIndex(JointName);
-		if (JointRefIndex < 0 && JointId == ECraneJoints::Base)
-		{
-			JointRefIndex = 0; // make a default root bone as base in case the given joint name is not found
-		}
+		const int32 JointRefIndex = Geometry->RefBoneIndex[i];
 		const int32 ParentRefIndex = (JointRefIndex != INDEX_NONE) ? MeshRefSkeleton.GetParentIndex(JointRefIndex) : INDEX_NONE;
 
 		const FMeshPoseBoneIndex BoneIndex = FMeshPoseBoneIndex(JointRefIndex);
@@ -201,336 +115,329 @@ void FAnimNode_TechnocraneRig::CacheBones_AnyThread(const FAnimationCacheBonesCo
 
 		CraneJointToCompactBoneIndex.Emplace(JointId, MakeTuple(RequiredBones.MakeCompactPoseIndex(BoneIndex), RequiredBones.MakeCompactPoseIndex(ParentBoneIndex)));
 	}
-
-	const FName GravityBoneName(GetCraneJointName(ECraneJoints::Gravity));
-	const FName NeckBoneName(GetCraneJointName(ECraneJoints::Neck));
-	const FName HeadBoneName(GetCraneJointName(ECraneJoints::Head));
-
-	const auto& Transforms = MeshRefSkeleton.GetRefBonePose();
-	FVector GravityLocal = Transforms[MeshRefSkeleton.FindBoneIndex(GravityBoneName)].GetLocation();
-	const float GravityPivotZ = GravityLocal.Y;
-	GravityOffsetLen = FMath::Sqrt(FMath::Square(GravityLocal.X) + FMath::Square(GravityLocal.Z)); // GravityLocal.Size2D(); // length in a horizontal plane
-	const float NeckPivotZ = Transforms[MeshRefSkeleton.FindBoneIndex(NeckBoneName)].GetLocation().Length();
-	const float CameraPivotZ = Transforms[MeshRefSkeleton.FindBoneIndex(HeadBoneName)].GetLocation().Length();
-
-	DistCamHeadAndNeck = FMath::Abs(GravityPivotZ) + FMath::Abs(CameraPivotZ) + FMath::Abs(NeckPivotZ);
 }
 
 void FAnimNode_TechnocraneRig::Update_AnyThread(const FAnimationUpdateContext& Context)
 {
 	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(Update_AnyThread)
 
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneRigUpdate);
+
 	FAnimNode_Base::Update_AnyThread(Context);
 
-	// this introduces a frame of latency in setting the pin-driven source component,
-    // but we cannot do the work to extract transforms on a worker thread as it is not thread safe.
-    GetEvaluateGraphExposedInputs().Execute(Context);
-}
+	// with a multi threaded animation update the game thread only copies inputs in PreUpdate
+	if (IsInGameThread())
+	{
+		INC_DWORD_STAT(STAT_TechnocraneRigGameThreadUpdates);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_TechnocraneRigWorkerUpdates);
+	}
 
+	// a baked shot doesn't follow the camera, there is nothing to update
+	if (BakedPoseCache.IsValid())
+	{
+		return;
+	}
 
+	UpdateCameraInput_AnyThread();
+	EvaluateLiveLink_AnyThread();
+	UpdateReachMargin(Context.AnimInstanceProxy->GetActorName());
+}
 
-void FAnimNode_TechnocraneRig::Evaluate_AnyThread(FPoseContext& Output)
+void FAnimNode_TechnocraneRig::UpdateCameraInput_AnyThread()
 {
-	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(Evaluate_AnyThread)
-	SCOPE_CYCLE_COUNTER(STAT_TechnocraneRig);
-	
-	if (!TargetCameraActor.IsValid() || CraneJointToCompactBoneIndex.IsEmpty())
+	if (!GameThreadInputs.bHasTarget)
 	{
-		Output.ResetToRefPose();
 		return;
 	}
 
-	const FCompactPoseBoneIndex RootBone = CraneJointToCompactBoneIndex.FindChecked(ECraneJoints::Base).Key;
-	const FCompactPoseBoneIndex ColumnBone = CraneJointToCompactBoneIndex.FindChecked(ColumnRotationBone).Key;
-	const FCompactPoseBoneIndex BeamsBone = CraneJointToCompactBoneIndex.FindChecked(ECraneJoints::Beams).Key;
-	const FCompactPoseBoneIndex GravityBone = CraneJointToCompactBoneIndex.FindChecked(ECraneJoints::Gravity).Key;
-	const FCompactPoseBoneIndex NeckBone = CraneJointToCompactBoneIndex.FindChecked(ECraneJoints::Neck).Key;
-	const FCompactPoseBoneIndex HeadBone = CraneJointToCompactBoneIndex.FindChecked(ECraneJoints::Head).Key;
-
-	// convert pose to local space and apply to output
-	FCSPose<FCompactPose> ComponentPose;
-	ComponentPose.InitPose(Output.Pose);
-	
-	const float ZOffset = CraneData.ZOffsetOnGround;		// make it appear in the right place
-	const FVector NewLoc(0.0f, TrackPosition, ZOffset);
-
-	FVector vTarget3 = Target.GetLocation();
-	OutCraneData.GroundHeight = vTarget3.Z;
+	if (GameThreadInputs.bHasTrackPosition)
+	{
+		TrackPosition = GameThreadInputs.TrackPosition;
+	}
 
-	FTransform RootTM = ComponentPose.GetComponentSpaceTransform(RootBone);
-	RootTM.SetLocation(NewLoc);
-	ComponentPose.SetComponentSpaceTransform(RootBone, RootTM);
+	// camera pivot offset, target in the crane rig space, head and neck rotations
 
-	TArray<FCompactPoseBoneIndex> ModifiedBones;
-	ModifiedBones.Add(RootBone);
+	const FTransform OwnerTM(GameThreadInputs.OwnerRotation, GameThreadInputs.OwnerLocation, GameThreadInputs.OwnerScale);
 
-	FTransform ColumnTransform;
+	FCraneRigSolverInput CameraInput;
+	FTechnocraneRigKinematics::MakeCameraInput(FTransform(GameThreadInputs.CameraActorRotation), FTransform(GameThreadInputs.CameraLocation),
+		CameraPivotOffset, OwnerTM, CameraInput);
 
-	{
-		//
-		// rotate around UP
-		ColumnTransform = ComponentPose.GetComponentSpaceTransform(ColumnBone);
-		FVector ColumnPos = ColumnTransform.GetLocation();
+	Target = FTransform(CameraInput.Target);
+	RawRotation = CameraInput.RawRotation;
+	NeckQ = CameraInput.NeckQ;
 
-		FRotator ColumnRot = ColumnTransform.Rotator();
-		const FVector DirInPlane = vTarget3.GetSafeNormal2D();
+	DebugTargetLocation = OwnerTM.TransformPosition(CameraInput.Target);
+}
 
-		const double AngleRad = FMath::Atan2(FVector::DotProduct(FVector::CrossProduct(FVector::ForwardVector, DirInPlane), FVector::UpVector),
-			FVector::DotProduct(DirInPlane, FVector::ForwardVector));
-		const double Angle = FMath::RadiansToDegrees(AngleRad);
+void FAnimNode_TechnocraneRig::EvaluateLiveLink_AnyThread()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneRigLiveLink);
 
+	ILiveLinkClient* LiveLinkClient = FTechnocraneLiveLinkClient::Get();
+	if (!LiveLinkClient || !LiveLinkSubject.Role)
+	{
+		return;
+	}
 
-		ColumnRot.Yaw = 90.0 + Angle;
-		ColumnTransform.SetRotation(ColumnRot.Quaternion());
-		ComponentPose.SetComponentSpaceTransform(ColumnBone, ColumnTransform);
-		ModifiedBones.Add(ColumnBone);
+	FLiveLinkSubjectFrameData CurrentFrameData;
+	if (!LiveLinkClient->EvaluateFrame_AnyThread(LiveLinkSubject.Subject, LiveLinkSubject.Role, CurrentFrameData))
+	{
+		return;
 	}
 
+	const FLiveLinkCameraFrameData* FrameData = CurrentFrameData.FrameData.Cast<FLiveLinkCameraFrameData>();
+
+	if (FrameData && FrameData->PropertyValues.Num() > 8)
 	{
-		//
-		// rotate beams up/down
-		
-		FTransform BeamsTransform = ComponentPose.GetComponentSpaceTransform(BeamsBone);
-		FVector BeamsPos = BeamsTransform.GetLocation();
-
-		FVector DirToCam = FVector(vTarget3.X, vTarget3.Y, vTarget3.Z + DistCamHeadAndNeck) - BeamsPos;
-		DirToCam.Normalize();
-
-		FVector vTarget3Norm = (vTarget3 - BeamsPos).GetSafeNormal2D();
-		float Angle = NTechnocraneRigInternal::GetSignedAngle(DirToCam, vTarget3Norm, ColumnTransform.GetRotation().GetForwardVector());
-		Angle = FMath::RadiansToDegrees(Angle);
-		Angle = FMath::Clamp(Angle, -CraneData.TiltMin, CraneData.TiltMax);
-
-		// 
-		FRotator BeamsRot = BeamsTransform.Rotator();
-		BeamsRot.Roll = 90.0 + Angle;
-		BeamsTransform.SetRotation(BeamsRot.Quaternion());
-		ComponentPose.SetComponentSpaceTransform(BeamsBone, BeamsTransform);
-		ModifiedBones.Add(BeamsBone);
-
-		OutCraneData.TiltAngle = Angle;
+		TrackPosition = FrameData->PropertyValues[static_cast<int32>(EPacketProperties::TrackPosition)];
+		RawRotation = FVector(
+			FrameData->PropertyValues[static_cast<int32>(EPacketProperties::Pan)],
+			FrameData->PropertyValues[static_cast<int32>(EPacketProperties::Tilt)],
+			FrameData->PropertyValues[static_cast<int32>(EPacketProperties::Roll)]
+		);
+
+		NeckQ = FQuat::MakeFromEuler(FVector(90.0f, 0.0f, 180.0f + RawRotation.X));
 	}
+}
+
 
-	//
-	// beams length
 
-	FVector HeadPos = ComponentPose.GetComponentSpaceTransform(HeadBone).GetLocation();
-	FVector BeamsPos = ComponentPose.GetComponentSpaceTransform(BeamsBone).GetLocation();
+void FAnimNode_TechnocraneRig::Evaluate_AnyThread(FPoseContext& Output)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(Evaluate_AnyThread)
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneRig);
 	
-	// we assume crane crane beams can't be placed almost vertically and crane preset has a defined tilt min/max angles setup
-	const float CurrentLength = FVector::Dist(HeadPos, BeamsPos);
-	const FVector ProjOnBeams = vTarget3 + FVector(0.0f, 0.0f, DistCamHeadAndNeck);
-	//DrawDebugSphere(Output.AnimInstanceProxy->GetSkeleton()->GetWorld(), ProjOnBeams, 5.0f, 12, FColor::Red, false, 0.033f, SDPG_Foreground);
-	const float TargetLength = FVector::Dist(ProjOnBeams, BeamsPos);
-	OutCraneData.ExtensionLength = TargetLength;
-
-	using namespace NTechnocraneRigInternal;
-	const FReferenceSkeleton& RefSkeleton = Output.AnimInstanceProxy->GetSkeleton()->GetReferenceSkeleton();
-
-	constexpr float Thres{ 0.1f };
-	if (FMath::Abs(CurrentLength - TargetLength) > Thres)
+	// the target is checked on the game thread in PreUpdate, a weak pointer is not safe to resolve here
+	if (!GameThreadInputs.bHasTarget || CraneJointToCompactBoneIndex.IsEmpty() || !Geometry.IsValid() || !Geometry->IsValid())
 	{
-		TArray<FBeamData, TInlineAllocator<4>> BeamData;
+		bPoseCacheValid = false;
+		Output.ResetToRefPose();
+		return;
+	}
 
-		const int32 Beam1 = static_cast<int32>(ECraneJoints::Beam1);
-		const int32 Beam2 = static_cast<int32>(ECraneJoints::Beam2);
-		const int32 Beam5 = static_cast<int32>(ECraneJoints::Beam5);
+	// a baked shot, the pose is an interpolation of two cached frames
+	if (BakedPoseCache.IsValid())
+	{
+		INC_DWORD_STAT(STAT_TechnocraneRigBakedPoses);
 
-		for (int32 i = Beam2; i <= Beam5; ++i)
-		{
-			const FName BoneName(GetCraneJointName(static_cast<ECraneJoints>(i)));
-			const int32 BoneIndex = RefSkeleton.FindBoneIndex(BoneName);
-			
-			if (INDEX_NONE == BoneIndex)
-				continue;
+		FCraneRigPose CranePose;
+		FCraneRigSolution Solution;
+		BakedPoseCache->Evaluate(BakedPoseTime, CranePose, Solution);
 
-			auto& BoneInfo = CraneJointToCompactBoneIndex.FindChecked(static_cast<ECraneJoints>(i));
-			const FCompactPoseBoneIndex BeamBone = BoneInfo.Key;
+		FTechnocraneRigKinematics::ToSimulationData(Solution, OutCraneData);
+		ApplyCranePose(Output, *Geometry, CranePose);
 
-			const float BeamLength = ComponentPose.GetComponentSpaceTransform(BeamBone).GetLocation().Length(); // Z;
-			const float MaxLength = RefSkeleton.GetRefBonePose()[BoneIndex].GetLocation().Length(); // Z;
-			constexpr float MinLength{ -2.0f };
+		bPoseCacheValid = false;
+		return;
+	}
 
-			FBeamData Data(BeamLength, MinLength, MaxLength, BeamBone, BoneInfo.Value, BoneName);
-			BeamData.Add(MoveTemp(Data));
-		}
+	FCraneRigInputSnapshot Inputs;
+	Inputs.Target = Target.GetLocation();
+	Inputs.TrackPosition = TrackPosition;
+	Inputs.RawRotation = RawRotation;
+	Inputs.NeckQ = NeckQ;
+	Inputs.CameraPivotOffset = CameraPivotOffset;
+	Inputs.Preset = FTechnocraneRigKinematics::MakePreset(CraneData);
 
-		const int32 Beam1BoneIndex = RefSkeleton.FindBoneIndex(GetCraneJointName(ECraneJoints::Beam1));
-		const FVector Beam1Local = RefSkeleton.GetRefBonePose()[Beam1BoneIndex].GetLocation();
-		const float Beam1Length = Beam1Local.Length();
-		float TiltFactor = FMath::Sin(FMath::DegreesToRadians(90.0 - OutCraneData.TiltAngle));
+	OutCraneData.ReachMargin = ReachMargin;
+	OutCraneData.bNearReachLimit = bNearReachLimit;
 
-		CalculateBeamAdjustmentsEqual(BeamData, CurrentLength, TargetLength - GravityOffsetLen, Beam1Length);
+	// a parked camera, the last pose and simulation data are still valid
+	// a bone container is reinitialized in place on a LOD or required bones change, its serial number changes then
+	const FBoneContainer& BoneContainer = Output.Pose.GetBoneContainer();
+	const bool bSameBones = CachedBoneSerialNumber == BoneContainer.GetSerialNumber() && CachedPose.GetNumBones() == Output.Pose.GetNumBones();
 
-		for (const FBeamData& Data : BeamData)
-		{
-			const FName& BoneName = Data.BeamBoneName;
+	if (bEnablePoseCache && bPoseCacheValid && bSameBones && Inputs.Equals(CachedInputs))
+	{
+		INC_DWORD_STAT(STAT_TechnocraneRigPoseCacheHits);
+		INC_FLOAT_STAT_BY(STAT_TechnocraneRigPoseCacheTimeSaved, static_cast<float>(AverageEvaluateMs));
 
-			FTransform ParentTM = ComponentPose.GetComponentSpaceTransform(Data.ParentBone);
+		Output.Pose.CopyBonesFrom(CachedPose);
+		return;
+	}
 
-			FTransform TM = ComponentPose.GetComponentSpaceTransform(Data.BeamBone);
-			TM.SetToRelativeTransform(ParentTM);
+	INC_DWORD_STAT(STAT_TechnocraneRigPoseCacheMisses);
+	const uint64 StartCycles = FPlatformTime::Cycles64();
 
-			FVector tr = TM.GetLocation();
-			tr.Z = -Data.Adjustment;
+	const FCraneRigPreset& Preset = Inputs.Preset;
+	const FCraneRigGeometry& RigGeometry = *Geometry;
 
-			TM.SetLocation(tr);
-			TM = TM * ParentTM;
+	FCraneRigSolverInput Input;
+	Input.Target = Target.GetLocation();
+	Input.TrackPosition = TrackPosition;
+	Input.RawRotation = RawRotation;
+	Input.NeckQ = NeckQ;
 
-			ComponentPose.SetComponentSpaceTransform(Data.BeamBone, TM);
-			ModifiedBones.Add(Data.BeamBone);
-		}
-	}
-	
+	FCraneRigSolution Solution;
+	FCraneRigSolver::Solve(RigGeometry, Preset, Input, Solution);
+
+	FTechnocraneRigKinematics::ToSimulationData(Solution, OutCraneData);
+
+	FCraneRigPose CranePose;
+	FCraneRigSolver::BuildPose(RigGeometry, Preset, TrackPosition, Solution, CranePose);
+
+	ApplyCranePose(Output, RigGeometry, CranePose);
+
+	if (bEnablePoseCache)
 	{
-		//
-		// rotate gravity point
+		CachedPose.CopyBonesFrom(Output.Pose);
+		CachedBoneSerialNumber = BoneContainer.GetSerialNumber();
+		CachedInputs = Inputs;
+		bPoseCacheValid = true;
 
-		FTransform TM, ParentTM;
-		FVector angles;
+		const double EvaluateMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		AverageEvaluateMs = (AverageEvaluateMs > 0.0) ? FMath::Lerp(AverageEvaluateMs, EvaluateMs, 0.1) : EvaluateMs;
+	}
+}
 
-		auto& BeamsBoneInfo = CraneJointToCompactBoneIndex.FindChecked(ECraneJoints::Beams);
-		auto& GravityBoneInfo = CraneJointToCompactBoneIndex.FindChecked(ECraneJoints::Gravity);
+void FAnimNode_TechnocraneRig::ApplyCranePose(FPoseContext& Output, const FCraneRigGeometry& RigGeometry, const FCraneRigPose& CranePose) const
+{
+	// reset to ref pose before setting the pose to ensure if we don't have any missing bones
+	Output.ResetToRefPose();
 
-		// convert to local space
-		FCompactPose CompactPose(Output.Pose);
-		FCSPose<FCompactPose>::ConvertComponentPosesToLocalPosesSafe(ComponentPose, CompactPose);
-		
-		// reset to ref pose before setting the pose to ensure if we don't have any missing bones
-		Output.ResetToRefPose();
+	FCSPose<FCompactPose> ComponentPose;
+	ComponentPose.InitPose(Output.Pose);
 
-		for (const FCompactPoseBoneIndex& ModifiedBone : ModifiedBones)
-		{
-			Output.Pose[ModifiedBone] = CompactPose[ModifiedBone];
-		}
-		
-		ComponentPose.InitPose(Output.Pose);
+	// joints are stored in a hierarchy order, so parents are always set before children
+	for (int32 i = 0; i < RigGeometry.NumJoints; ++i)
+	{
+		const int32 Joint = RigGeometry.JointOrder[i];
+		const FCompactPoseBoneIndex BoneIndex = CraneJointToCompactBoneIndex.FindChecked(static_cast<ECraneJoints>(Joint)).Key;
 
-		TM = ComponentPose.GetComponentSpaceTransform(BeamsBoneInfo.Key);
-		ParentTM = ComponentPose.GetComponentSpaceTransform(BeamsBoneInfo.Value);
+		if (!BoneIndex.IsValid())
+			continue;
 
-		TM.SetToRelativeTransform(ParentTM);
-		angles = TM.GetRotation().Euler();
+		// make sure the bone parent chain is resolved in component space before overriding the bone
+		ComponentPose.GetComponentSpaceTransform(BoneIndex);
+		ComponentPose.SetComponentSpaceTransform(BoneIndex, CranePose.ComponentSpace[Joint]);
+	}
+
+	// convert to local space
+	FCSPose<FCompactPose>::ConvertComponentPosesToLocalPoses(ComponentPose, Output.Pose);
+}
 
-		TM = ComponentPose.GetComponentSpaceTransform(GravityBoneInfo.Key);
-		ParentTM = ComponentPose.GetComponentSpaceTransform(GravityBoneInfo.Value);
+void FAnimNode_TechnocraneRig::ResolveTargetComponents()
+{
+	ACineCameraActor* CameraActor = TargetCameraActor.Get();
 
-		TM.SetToRelativeTransform(ParentTM);
-		TM.SetRotation(FQuat::MakeFromEuler(-angles));
+	const bool bTargetChanged = ResolvedCameraActor.Get() != CameraActor;
+	const bool bComponentsStale = CineCameraComponent.IsStale() || LiveLinkComponent.IsStale();
+	const bool bLookForLiveLink = !LiveLinkComponent.IsValid() && GFrameCounter >= NextComponentLookupFrame;
 
-		TM = TM * ParentTM;
-		ComponentPose.SetComponentSpaceTransform(GravityBoneInfo.Key, TM);
+	if (!bTargetChanged && !bComponentsStale && !bLookForLiveLink)
+	{
+		return;
 	}
-	
-	//
-	// crane head and neck
 
-	FTransform HeadTM = ComponentPose.GetComponentSpaceTransform(HeadBone);
-	HeadTM.SetRotation(NeckQ * FQuat::MakeFromEuler(FVector(RawRotation.Y, 0.0f, 0.0f)));
-	ComponentPose.SetComponentSpaceTransform(HeadBone, HeadTM);
+	ResolvedCameraActor = CameraActor;
 
-	FTransform NeckTM = ComponentPose.GetComponentSpaceTransform(NeckBone);
-	NeckTM.SetRotation(NeckQ);
-	ComponentPose.SetComponentSpaceTransform(NeckBone, NeckTM);
+	UCineCameraComponent* CameraComp = CameraActor->GetCineCameraComponent();
+	CineCameraComponent = CameraComp;
+	TechnocraneCameraComponent = Cast<UTechnocraneCameraComponent>(CameraComp);
+	LiveLinkComponent = CameraActor->FindComponentByClass<ULiveLinkComponentController>();
 
-	// convert to local space
-	FCSPose<FCompactPose>::ConvertComponentPosesToLocalPoses(ComponentPose, Output.Pose);
+	NextComponentLookupFrame = GFrameCounter + NAnimNodeTechnocraneRig::ComponentLookupInterval;
 }
 
 void FAnimNode_TechnocraneRig::PreUpdate(const UAnimInstance* InAnimInstance)
 {
 	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(PreUpdate)
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneRigPreUpdate);
+	INC_DWORD_STAT(STAT_TechnocraneRigsUpdated);
+
+	LiveLinkSubject = FLiveLinkSubjectRepresentation();
+	GameThreadInputs = FCraneRigGameThreadInputs();
 
 	if (!TargetCameraActor.IsValid())
 	{
 		return;
 	}
 
-	// get transform and track position / raw rotation if live link is presented
+	GameThreadInputs.bHasTarget = true;
+
+	// a baked shot, the pose is picked by the pose cache time
+	if (BakedPoseCache.IsValid())
+	{
+		return;
+	}
+
+	ResolveTargetComponents();
+
+	// copy transforms and the track position, crane inputs are computed on a worker thread
 
-	FTransform CameraTransform = TargetCameraActor->GetTransform();
+	const FTransform& CameraActorTM = TargetCameraActor->GetTransform();
+	const FTransform& OwnerTM = InAnimInstance->GetOwningActor()->GetTransform();
 
-	if (UCineCameraComponent* CameraComp = Cast<UCineCameraComponent>(TargetCameraActor->GetCameraComponent()))
+	GameThreadInputs.CameraActorRotation = CameraActorTM.GetRotation();
+	GameThreadInputs.CameraLocation = CameraActorTM.GetLocation();
+	GameThreadInputs.OwnerLocation = OwnerTM.GetLocation();
+	GameThreadInputs.OwnerRotation = OwnerTM.GetRotation();
+	GameThreadInputs.OwnerScale = OwnerTM.GetScale3D();
+
+	if (const UCineCameraComponent* CameraComp = CineCameraComponent.Get())
 	{
-		CameraTransform = CameraComp->GetRelativeTransform() * CameraTransform;
+		GameThreadInputs.CameraLocation = CameraActorTM.TransformPosition(CameraComp->GetRelativeLocation());
 	}
-	if (UTechnocraneCameraComponent* CameraComp = Cast<UTechnocraneCameraComponent>(TargetCameraActor->GetCameraComponent()))
+	if (const UTechnocraneCameraComponent* CameraComp = TechnocraneCameraComponent.Get())
 	{
-		TrackPosition = CameraComp->TrackPos;
+		GameThreadInputs.TrackPosition = CameraComp->TrackPos;
+		GameThreadInputs.bHasTrackPosition = true;
 	}
 
-	// add some camera pivot offset
-
-	FVector AdjOffset = FVector::ZeroVector;
-	AdjOffset = TargetCameraActor->GetActorForwardVector() * CameraPivotOffset.X;
-	AdjOffset += -TargetCameraActor->GetActorRightVector() * CameraPivotOffset.Y;
-	AdjOffset += TargetCameraActor->GetActorUpVector() * CameraPivotOffset.Z;
+	// the subject is evaluated in Update_AnyThread, only a camera role carries crane properties
+	if (const ULiveLinkComponentController* LiveLinkController = LiveLinkComponent.Get())
+	{
+		const FLiveLinkSubjectRepresentation& Representation = LiveLinkController->SubjectRepresentation;
 
-	Target = CameraTransform;
-	Target.AddToTranslation(AdjOffset);
+		if (Representation.Role && Representation.Role->IsChildOf(ULiveLinkCameraRole::StaticClass()))
+		{
+			LiveLinkSubject = Representation;
+		}
+	}
 
+	// the target and the reach margin are updated on a worker thread, the debug sphere is one frame behind
 	if (bShowDebug)
 	{
-		DrawDebugSphere(InAnimInstance->GetWorld(), Target.GetLocation(), 5.0f, 12, FColor::White, false, 0.033f, SDPG_Foreground);
+		const FColor DebugColor = (ReachMargin < 0.0f) ? FColor::Red : (bNearReachLimit) ? FColor::Orange : FColor::White;
+		DrawDebugSphere(InAnimInstance->GetWorld(), DebugTargetLocation, 5.0f, 12, DebugColor, false, 0.033f, SDPG_Foreground);
 	}
-	
-	RawRotation = TargetCameraActor->GetActorRotation().Euler();
-	NeckQ = FQuat::MakeFromEuler(FVector(90.0, 0.0, 180.0 + RawRotation.X));
+}
 
-	if (!CameraPivotOffset.IsNearlyZero(0.0001))
+void FAnimNode_TechnocraneRig::UpdateReachMargin(const FString& OwnerName)
+{
+	if (!ReachabilityField || !ReachabilityField->IsBuilt())
 	{
-		FVector DirToCam = (CameraTransform.GetLocation() - Target.GetLocation()).GetSafeNormal();
-		FVector DirInPlane = DirToCam.GetSafeNormal2D();
+		ReachMargin = 0.0f;
+		bNearReachLimit = false;
+		return;
+	}
 
-		double AngleRad = FMath::Atan2(FVector::DotProduct(FVector::CrossProduct(FVector::ForwardVector, DirInPlane), FVector::UpVector),
-			FVector::DotProduct(DirInPlane, FVector::ForwardVector));
+	// a lookup in the precomputed field, the solver clamps tilt and extension silently
+	ReachMargin = ReachabilityField->GetReachMargin(Target.GetLocation(), TrackPosition);
 
-		const double Angle = FMath::RadiansToDegrees(AngleRad);
+	const bool bWasNearReachLimit = bNearReachLimit;
+	bNearReachLimit = ReachMargin < ReachWarningMargin;
 
-		NeckQ = FQuat::MakeFromEuler(FVector(90.0, 0.0, 90.0 + Angle));
+	if (bNearReachLimit && !bWasNearReachLimit)
+	{
+		UE_LOG(LogTechnocrane, Warning, TEXT("%s: crane target is %.1f cm from %s limits"),
+			*OwnerName, FMath::Abs(ReachMargin), (ReachMargin < 0.0f) ? TEXT("outside of") : TEXT("reaching"));
 	}
+}
 
-	const FTransform OwnerTM = InAnimInstance->GetOwningActor()->GetTransform();
-	Target = Target.GetRelativeTransform(OwnerTM);
-
-	// TODO: live link stuff, track position / raw rotation
-	
-	ULiveLinkComponentController* LiveLinkComponent = Cast<ULiveLinkComponentController>(TargetCameraActor->GetComponentByClass(ULiveLinkComponentController::StaticClass()));
-	if (LiveLinkComponent && LiveLinkComponent->SubjectRepresentation.Role)
-	{
-		//if Subjects role direct controller is us, set the component to control to what we had
+void FAnimNode_TechnocraneRig::SetPoseCache(FCraneRigPoseCachePtr InPoseCache, const float InTime)
+{
+	BakedPoseCache = MoveTemp(InPoseCache);
+	BakedPoseTime = InTime;
+}
 
-		if (ULiveLinkCameraRole* LiveLinkRole = Cast<ULiveLinkCameraRole>(LiveLinkComponent->SubjectRepresentation.Role->GetDefaultObject()))
-		{
-			//Create the struct holder and make it point to the output data
-
-			IModularFeatures& ModularFeatures = IModularFeatures::Get();
-			if (ModularFeatures.IsModularFeatureAvailable(ILiveLinkClient::ModularFeatureName))
-			{
-				ILiveLinkClient& LiveLinkClient = ModularFeatures.GetModularFeature<ILiveLinkClient>(ILiveLinkClient::ModularFeatureName);
-
-				FLiveLinkSubjectFrameData CurrentFrameData;
-				bool bSuccess = LiveLinkClient.EvaluateFrame_AnyThread(LiveLinkComponent->SubjectRepresentation.Subject, LiveLinkComponent->SubjectRepresentation.Role, CurrentFrameData);
-
-				if (bSuccess)
-				{
-					FLiveLinkCameraFrameData* FrameData = CurrentFrameData.FrameData.Cast<FLiveLinkCameraFrameData>();
-
-					if (FrameData->PropertyValues.Num() > 8)
-					{
-						TrackPosition = FrameData->PropertyValues[static_cast<int32>(EPacketProperties::TrackPosition)];
-						RawRotation = FVector(
-							FrameData->PropertyValues[static_cast<int32>(EPacketProperties::Pan)],
-							FrameData->PropertyValues[static_cast<int32>(EPacketProperties::Tilt)],
-							FrameData->PropertyValues[static_cast<int32>(EPacketProperties::Roll)]
-						);
-
-						NeckQ = FQuat::MakeFromEuler(FVector(90.0f, 0.0f, 180.0f + RawRotation.X));
-					}
-				}
-			}
-		}
-	}
+void FAnimNode_TechnocraneRig::SetPoseCacheTime(const float InTime)
+{
+	BakedPoseTime = InTime;
 }
 
 bool FAnimNode_TechnocraneRig::Serialize(FArchive& Ar)
@@ -0,0 +1,302 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// LiveLinkTechnocraneMulticastSource.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "LiveLinkTechnocraneMulticastSource.h"
+#include "TechnocranePrivatePCH.h"
+
+#include "ILiveLinkClient.h"
+#include "LiveLinkTypes.h"
+#include "Roles/LiveLinkCameraRole.h"
+#include "Roles/LiveLinkCameraTypes.h"
+
+#include "Common/UdpSocketBuilder.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+#include "TechnocraneRuntimeSettings.h"
+#include "TechnocraneFreeD.h"
+#include "TechnocraneLensProfile.h"
+#include "LiveLinkTechnocraneTypes.h"
+
+#include <technocrane_hardware.h>
+
+#define LOCTEXT_NAMESPACE "TechnocraneLiveLinkSource"
+
+FLiveLinkTechnocraneMulticastSource::FLiveLinkTechnocraneMulticastSource(const FIPv4Endpoint& InEndpoint, const ECraneSampleFormat InFormat)
+	: m_Endpoint(InEndpoint)
+	, m_Format(InFormat)
+{
+	m_SourceType = (m_Format == ECraneSampleFormat::FreeD) ? LOCTEXT("TechnocraneFreeDSourceType", "Technocrane FreeD") : LOCTEXT("TechnocraneMulticastSourceType", "Technocrane Multicast");
+	m_SourceMachineName = m_Endpoint.ToText();
+	m_SourceStatus = LOCTEXT("SourceStatus_Waiting", "Waiting");
+
+	// FreeD encoder counts are calibrated here the same way the hardware source does it
+	if (m_Format == ECraneSampleFormat::FreeD)
+	{
+		const UTechnocraneRuntimeSettings* settings = GetDefault<UTechnocraneRuntimeSettings>();
+		m_LensEncoding = NTechnocraneFreeD::MakeLensEncoding(*settings);
+
+		if (const UTechnocraneLensProfile* lens_profile = settings->LensProfile.LoadSynchronous())
+		{
+			m_FocalLengthTable = lens_profile->GetFocalLengthTable();
+			m_FocusDistanceTable = lens_profile->GetFocusDistanceTable();
+		}
+	}
+
+	// a unicast endpoint, like a loopback address, is received without joining a group
+	FUdpSocketBuilder builder = FUdpSocketBuilder(TEXT("Technocrane Multicast Receiver"))
+		.AsNonBlocking()
+		.AsReusable()
+		.BoundToPort(m_Endpoint.Port)
+		.WithReceiveBufferSize(64 * 1024);
+
+	if (m_Endpoint.Address.IsMulticastAddress())
+	{
+		builder.BoundToAddress(FIPv4Address::Any).JoinedToGroup(m_Endpoint.Address).WithMulticastLoopback();
+	}
+	else
+	{
+		builder.BoundToAddress(m_Endpoint.Address);
+	}
+
+	m_Socket = builder.Build();
+
+	if (!m_Socket)
+	{
+		UE_LOG(LogTechnocrane, Warning, TEXT("Failed to open a socket to receive crane samples on %s"), *m_Endpoint.ToString());
+		m_SourceStatus = LOCTEXT("SourceStatus_Failed", "Failed to Connect");
+		return;
+	}
+
+	if (GetDefault<UTechnocraneRuntimeSettings>()->bPublishSharedSamples)
+	{
+		const TCHAR* prefix = (m_Format == ECraneSampleFormat::FreeD) ? TEXT("FreeD") : TEXT("Multicast");
+		m_SharedPublisher.Open(FString::Printf(TEXT("%s%d"), prefix, m_Endpoint.Port));
+	}
+
+	m_Receiver = new FUdpSocketReceiver(m_Socket, FTimespan::FromMilliseconds(100), TEXT("Technocrane Multicast Receiver"));
+	m_Receiver->OnDataReceived().BindRaw(this, &FLiveLinkTechnocraneMulticastSource::OnDataReceived);
+	m_Receiver->Start();
+}
+
+FLiveLinkTechnocraneMulticastSource::~FLiveLinkTechnocraneMulticastSource()
+{
+	Shutdown();
+}
+
+void FLiveLinkTechnocraneMulticastSource::ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid)
+{
+	m_Client = InClient;
+	m_SourceGuid = InSourceGuid;
+}
+
+bool FLiveLinkTechnocraneMulticastSource::RequestSourceShutdown()
+{
+	Shutdown();
+	return true;
+}
+
+void FLiveLinkTechnocraneMulticastSource::Shutdown()
+{
+	// the receiver thread is stopped before the socket goes
+	if (m_Receiver)
+	{
+		delete m_Receiver;
+		m_Receiver = nullptr;
+	}
+
+	if (m_Socket)
+	{
+		m_Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(m_Socket);
+		m_Socket = nullptr;
+	}
+}
+
+void FLiveLinkTechnocraneMulticastSource::OnDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender)
+{
+	NTechnocraneShared::SSample sample;
+	FCraneRawValues raw;
+	uint32 sequence = 0;
+
+	if (!m_Client || !DecodeDatagram(Data, sample, raw, sequence))
+	{
+		return;
+	}
+
+	UpdateStatus(sequence);
+
+	if (m_SharedPublisher.IsOpen())
+	{
+		m_SharedPublisher.Publish(sample);
+	}
+	PushSample(sample, raw);
+}
+
+bool FLiveLinkTechnocraneMulticastSource::DecodeDatagram(const FArrayReaderPtr& Data, NTechnocraneShared::SSample& sample, FCraneRawValues& raw, uint32& sequence) const
+{
+	if (m_Format == ECraneSampleFormat::FreeD)
+	{
+		uint8 camera_id = 0;
+		if (!NTechnocraneFreeD::Decode(Data->GetData(), Data->Num(), m_LensEncoding, sample, raw, camera_id))
+		{
+			return false;
+		}
+
+		const UTechnocraneRuntimeSettings* settings = GetDefault<UTechnocraneRuntimeSettings>();
+		const float space_scale = settings->SpaceScaleByDefault;
+
+		if (!m_LensEncoding.bCalibrated)
+		{
+			CalibrateLens(raw, *settings, sample);
+		}
+
+		// FreeD has no packet number, messages are numbered in order of arrival
+		sequence = m_NumReceived;
+		sample.PacketNumber = static_cast<int32>(m_NumReceived);
+		sample.WorldTime = FPlatformTime::Seconds();
+
+		// FreeD has no raw crane values, the decoded sample is taken back into the crane space with the local space scale
+		const float inv_scale = (FMath::Abs(space_scale) > SMALL_NUMBER) ? 1.0f / space_scale : 1.0f;
+
+		raw.Position[0] = inv_scale * sample.Location[0];
+		raw.Position[1] = inv_scale * sample.Location[2];
+		raw.Position[2] = inv_scale * sample.Location[1];
+		raw.Pan = sample.Rotation[1] - 90.0f;
+		raw.Tilt = sample.Rotation[0];
+		raw.Roll = sample.Rotation[2];
+		return true;
+	}
+
+	if (!NTechnocraneSampleDatagram::Decode(Data->GetData(), Data->Num(), sample, raw, sequence))
+	{
+		return false;
+	}
+
+	sample.WorldTime = FPlatformTime::Seconds();
+	return true;
+}
+
+void FLiveLinkTechnocraneMulticastSource::CalibrateLens(const FCraneRawValues& raw, const UTechnocraneRuntimeSettings& settings, NTechnocraneShared::SSample& sample) const
+{
+	float zoom = 1.0f;
+	bool is_zoom_calibrated = true;
+
+	if (m_FocalLengthTable.IsValid())
+	{
+		zoom = m_FocalLengthTable.Evaluate(raw.Zoom);
+	}
+	else
+	{
+		is_zoom_calibrated = NTechnocrane::ComputeZoomf(zoom, raw.Zoom, settings.ZoomRange.Min, settings.ZoomRange.Max);
+	}
+
+	float focus = 1.0f;
+	const bool is_focus_calibrated = UTechnocraneLensProfile::ComputeFocusDistance(m_FocusDistanceTable, raw.Focus,
+		FVector2D(settings.FocusRange.Min, settings.FocusRange.Max), settings.SpaceScaleByDefault, focus);
+
+	sample.FocalLength = zoom;
+	sample.FocusDistance = focus;
+	sample.Flags |= ((is_zoom_calibrated) ? NTechnocraneShared::ZoomCalibrated : 0)
+		| ((is_focus_calibrated) ? NTechnocraneShared::FocusCalibrated : 0);
+}
+
+void FLiveLinkTechnocraneMulticastSource::UpdateStatus(const uint32 sequence)
+{
+	// a restarted sender begins from zero, an older datagram is not counted as a loss
+	if (m_HasSequence && sequence > m_LastSequence)
+	{
+		m_NumLost += sequence - m_LastSequence - 1;
+	}
+
+	m_HasSequence = true;
+	m_LastSequence = sequence;
+	++m_NumReceived;
+
+	const double curr_time = FPlatformTime::Seconds();
+	if (curr_time - m_LastStatusTime > 1.0)
+	{
+		m_SourceStatus = FText::FromString(FString::Printf(TEXT("Receiving [%u received, %u lost]"), m_NumReceived, m_NumLost));
+		m_LastStatusTime = curr_time;
+	}
+}
+
+void FLiveLinkTechnocraneMulticastSource::PushSample(const NTechnocraneShared::SSample& sample, const FCraneRawValues& raw)
+{
+	const FName subject_name("CameraSubject");
+
+	if (m_CreateStaticSubject)
+	{
+		FLiveLinkStaticDataStruct StaticDataStruct = FLiveLinkStaticDataStruct(FLiveLinkCameraStaticData::StaticStruct());
+		FLiveLinkCameraStaticData& StaticData = *StaticDataStruct.Cast<FLiveLinkCameraStaticData>();
+
+		StaticData.bIsFieldOfViewSupported = false;
+		StaticData.bIsFocalLengthSupported = true;
+		StaticData.bIsFocusDistanceSupported = true;
+		StaticData.bIsApertureSupported = true;
+
+		for (const char* name : PacketPropertyNames)
+		{
+			StaticData.PropertyNames.Add(name);
+		}
+
+		m_Client->PushSubjectStaticData_AnyThread({ m_SourceGuid, subject_name }, ULiveLinkCameraRole::StaticClass(), MoveTemp(StaticDataStruct));
+		m_CreateStaticSubject = false;
+	}
+
+	FLiveLinkFrameDataStruct FrameDataStruct = FLiveLinkFrameDataStruct(FLiveLinkCameraFrameData::StaticStruct());
+	FLiveLinkCameraFrameData& FrameData = *FrameDataStruct.Cast<FLiveLinkCameraFrameData>();
+
+	FrameData.FocalLength = sample.FocalLength;
+	FrameData.FocusDistance = sample.FocusDistance;
+	FrameData.Aperture = sample.Aperture;
+
+	FrameData.Transform.SetTranslation(FVector(sample.Location[0], sample.Location[1], sample.Location[2]));
+	FrameData.Transform.SetRotation(FRotator(sample.Rotation[0], sample.Rotation[1], sample.Rotation[2]).Quaternion());
+
+	const bool has_timecode = (sample.Flags & NTechnocraneShared::HasTimeCode) != 0;
+	if (has_timecode)
+	{
+		const FFrameRate FrameRate(GetDefault<UTechnocraneRuntimeSettings>()->CameraFrameRate);
+		const FTimecode TimeCode((sample.Timecode >> 24) & 0xFF, (sample.Timecode >> 16) & 0xFF, (sample.Timecode >> 8) & 0xFF, sample.Timecode & 0xFF, false);
+
+		FrameData.MetaData.SceneTime = FQualifiedFrameTime(TimeCode.ToFrameNumber(FrameRate), FrameRate);
+		FrameData.MetaData.StringMetaData.Add("RawTimeCode", TimeCode.ToString());
+	}
+
+	FrameData.MetaData.StringMetaData.Add("CameraOn", (sample.Flags & NTechnocraneShared::CameraOn) ? "1" : "0");
+	FrameData.MetaData.StringMetaData.Add("Running", (sample.Flags & NTechnocraneShared::Running) ? "1" : "0");
+	FrameData.MetaData.StringMetaData.Add("IsZoomCalibrated", (sample.Flags & NTechnocraneShared::ZoomCalibrated) ? "1" : "0");
+	FrameData.MetaData.StringMetaData.Add("IsFocusCalibrated", (sample.Flags & NTechnocraneShared::FocusCalibrated) ? "1" : "0");
+	FrameData.MetaData.StringMetaData.Add("IsIrisCalibrated", (sample.Flags & NTechnocraneShared::IrisCalibrated) ? "1" : "0");
+	FrameData.MetaData.StringMetaData.Add("PacketNumber", FString::FromInt(sample.PacketNumber));
+	FrameData.MetaData.StringMetaData.Add("HasTimeCode", (has_timecode) ? "1" : "0");
+
+	// the same properties as the hardware source, raw crane position and angles, lens encoder values come with FreeD only
+	const float property_values[static_cast<int32>(EPacketProperties::Total)] = {
+		sample.TrackPosition,
+		static_cast<float>(sample.PacketNumber),
+		raw.Position[0],
+		raw.Position[1],
+		raw.Position[2],
+		raw.Pan,
+		raw.Tilt,
+		raw.Roll,
+		(sample.Flags & NTechnocraneShared::CameraOn) ? 1.0f : 0.0f,
+		(sample.Flags & NTechnocraneShared::Running) ? 1.0f : 0.0f,
+		raw.Zoom,
+		raw.Iris,
+		raw.Focus
+	};
+
+	FrameData.PropertyValues.Append(property_values, static_cast<int32>(EPacketProperties::Total));
+
+	FrameData.WorldTime = sample.WorldTime;
+	m_Client->PushSubjectFrameData_AnyThread({ m_SourceGuid, subject_name }, MoveTemp(FrameDataStruct));
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,81 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// LiveLinkTechnocraneMulticastSource.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "ILiveLinkSource.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Common/UdpSocketReceiver.h"
+#include "TechnocraneFreeD.h"
+#include "TechnocraneLensTable.h"
+#include "TechnocraneSharedSamples.h"
+#include "TechnocraneSharedSamplePublisher.h"
+#include "TechnocraneSampleMulticast.h"
+
+class FSocket;
+class ILiveLinkClient;
+class UTechnocraneRuntimeSettings;
+
+/**
+ * Receive only LiveLink source of decoded crane samples that another instance re-sends to a multicast group,
+ *  or of FreeD D1 messages of any tracker. No crane hardware is opened, datagrams are pushed into LiveLink
+ *  and the shared memory ring on the socket receiver thread.
+ */
+class TECHNOCRANEPLUGIN_API FLiveLinkTechnocraneMulticastSource : public ILiveLinkSource
+{
+public:
+	FLiveLinkTechnocraneMulticastSource(const FIPv4Endpoint& InEndpoint, const ECraneSampleFormat InFormat = ECraneSampleFormat::Technocrane);
+	virtual ~FLiveLinkTechnocraneMulticastSource();
+
+	// ILiveLinkSource interface
+
+	void ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid) override;
+
+	bool IsSourceStillValid() const override { return m_Receiver != nullptr; }
+	bool RequestSourceShutdown() override;
+
+	FText GetSourceType() const override { return m_SourceType; }
+	FText GetSourceMachineName() const override { return m_SourceMachineName; }
+	FText GetSourceStatus() const override { return m_SourceStatus; }
+
+private:
+
+	ILiveLinkClient*		m_Client{ nullptr };
+	FGuid					m_SourceGuid;
+
+	FText					m_SourceType;
+	FText					m_SourceMachineName;
+	FText					m_SourceStatus;
+
+	FIPv4Endpoint			m_Endpoint;
+	ECraneSampleFormat		m_Format;
+	FSocket*				m_Socket{ nullptr };
+	FUdpSocketReceiver*		m_Receiver{ nullptr };
+
+	bool					m_CreateStaticSubject{ true };
+
+	// FreeD zoom and focus, encoder counts are calibrated with the lens profile tables
+	NTechnocraneFreeD::FLensEncoding	m_LensEncoding;
+	FCraneLensTable			m_FocalLengthTable;
+	FCraneLensTable			m_FocusDistanceTable;
+
+	// datagram sequence to count lost datagrams
+	bool					m_HasSequence{ false };
+	uint32					m_LastSequence{ 0 };
+	uint32					m_NumReceived{ 0 };
+	uint32					m_NumLost{ 0 };
+	double					m_LastStatusTime{ 0.0 };
+
+	FCraneSharedSamplePublisher	m_SharedPublisher;
+
+	void OnDataReceived(const FArrayReaderPtr& Data, const FIPv4Endpoint& Sender);
+	void PushSample(const NTechnocraneShared::SSample& sample, const FCraneRawValues& raw);
+	bool DecodeDatagram(const FArrayReaderPtr& Data, NTechnocraneShared::SSample& sample, FCraneRawValues& raw, uint32& sequence) const;
+	void CalibrateLens(const FCraneRawValues& raw, const UTechnocraneRuntimeSettings& settings, NTechnocraneShared::SSample& sample) const;
+	void UpdateStatus(const uint32 sequence);
+	void Shutdown();
+};
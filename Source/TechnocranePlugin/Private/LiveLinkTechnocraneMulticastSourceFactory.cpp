@@ -0,0 +1,104 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// LiveLinkTechnocraneMulticastSourceFactory.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "LiveLinkTechnocraneMulticastSourceFactory.h"
+
+#include "LiveLinkTechnocraneMulticastSource.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneRuntimeSettings.h"
+
+#include "SocketSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(LiveLinkTechnocraneMulticastSourceFactory)
+
+#define LOCTEXT_NAMESPACE "LiveLinkTechnocraneSourceFactory"
+
+namespace NTechnocraneFreeDSourceFactory
+{
+	// the FreeD output of this instance is sent to a local endpoint the source would receive on
+	bool IsFreeDOutputEndpoint(const FIPv4Endpoint& InputEndpoint)
+	{
+		const UTechnocraneRuntimeSettings* Settings = GetDefault<UTechnocraneRuntimeSettings>();
+
+		FIPv4Endpoint OutputEndpoint;
+		if (!Settings->bFreeDOutput || !FIPv4Endpoint::Parse(Settings->FreeDOutputEndpoint, OutputEndpoint) || OutputEndpoint.Port != InputEndpoint.Port)
+		{
+			return false;
+		}
+
+		if (InputEndpoint.Address != FIPv4Address::Any && InputEndpoint.Address != OutputEndpoint.Address)
+		{
+			return false;
+		}
+
+		if (OutputEndpoint.Address.IsLoopbackAddress())
+		{
+			return true;
+		}
+
+		bool bCanBindAll = false;
+		const TSharedRef<FInternetAddr> LocalAddress = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLocalHostAddr(*GLog, bCanBindAll);
+		return FIPv4Endpoint(LocalAddress).Address == OutputEndpoint.Address;
+	}
+};
+
+FText ULiveLinkTechnocraneMulticastSourceFactory::GetSourceDisplayName() const
+{
+	return LOCTEXT("MulticastSourceDisplayName", "Technocrane Multicast");
+}
+
+FText ULiveLinkTechnocraneMulticastSourceFactory::GetSourceTooltip() const
+{
+	return LOCTEXT("MulticastSourceTooltip", "Receives decoded crane samples that another instance re-sends to the multicast endpoint of Technocrane settings");
+}
+
+TSharedPtr<ILiveLinkSource> ULiveLinkTechnocraneMulticastSourceFactory::CreateSource(const FString& InConnectionString) const
+{
+	// a source created from the menu takes the endpoint from settings
+	const FString ConnectionString = (InConnectionString.IsEmpty()) ? GetDefault<UTechnocraneRuntimeSettings>()->MulticastEndpoint : InConnectionString;
+
+	FIPv4Endpoint Endpoint;
+	if (!FIPv4Endpoint::Parse(ConnectionString, Endpoint))
+	{
+		return TSharedPtr<ILiveLinkSource>();
+	}
+
+	return MakeShared<FLiveLinkTechnocraneMulticastSource>(Endpoint);
+}
+
+FText ULiveLinkTechnocraneFreeDSourceFactory::GetSourceDisplayName() const
+{
+	return LOCTEXT("FreeDSourceDisplayName", "Technocrane FreeD");
+}
+
+FText ULiveLinkTechnocraneFreeDSourceFactory::GetSourceTooltip() const
+{
+	return LOCTEXT("FreeDSourceTooltip", "Receives FreeD D1 messages on the FreeD input endpoint of Technocrane settings");
+}
+
+TSharedPtr<ILiveLinkSource> ULiveLinkTechnocraneFreeDSourceFactory::CreateSource(const FString& InConnectionString) const
+{
+	const FString ConnectionString = (InConnectionString.IsEmpty()) ? GetDefault<UTechnocraneRuntimeSettings>()->FreeDInputEndpoint : InConnectionString;
+
+	FIPv4Endpoint Endpoint;
+	if (!FIPv4Endpoint::Parse(ConnectionString, Endpoint))
+	{
+		return TSharedPtr<ILiveLinkSource>();
+	}
+
+	// the crane source would come back as a second subject
+	if (NTechnocraneFreeDSourceFactory::IsFreeDOutputEndpoint(Endpoint))
+	{
+		UE_LOG(LogTechnocrane, Warning, TEXT("FreeD source is not started on %s, the FreeD output %s is sent there"),
+			*Endpoint.ToString(), *GetDefault<UTechnocraneRuntimeSettings>()->FreeDOutputEndpoint);
+		return TSharedPtr<ILiveLinkSource>();
+	}
+
+	return MakeShared<FLiveLinkTechnocraneMulticastSource>(Endpoint, ECraneSampleFormat::FreeD);
+}
+
+#undef LOCTEXT_NAMESPACE
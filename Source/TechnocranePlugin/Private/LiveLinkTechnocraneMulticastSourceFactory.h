@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// LiveLinkTechnocraneMulticastSourceFactory.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "LiveLinkSourceFactory.h"
+#include "LiveLinkTechnocraneMulticastSourceFactory.generated.h"
+
+/** receive only source of crane samples re-sent by another instance, the endpoint is taken from runtime settings */
+UCLASS()
+class ULiveLinkTechnocraneMulticastSourceFactory : public ULiveLinkSourceFactory
+{
+public:
+	GENERATED_BODY()
+
+	virtual FText GetSourceDisplayName() const override;
+	virtual FText GetSourceTooltip() const override;
+
+	virtual EMenuType GetMenuType() const override { return EMenuType::MenuEntry; }
+	virtual TSharedPtr<ILiveLinkSource> CreateSource(const FString& ConnectionString) const override;
+};
+
+/** receive only source of FreeD D1 messages, the endpoint is taken from runtime settings */
+UCLASS()
+class ULiveLinkTechnocraneFreeDSourceFactory : public ULiveLinkSourceFactory
+{
+public:
+	GENERATED_BODY()
+
+	virtual FText GetSourceDisplayName() const override;
+	virtual FText GetSourceTooltip() const override;
+
+	virtual EMenuType GetMenuType() const override { return EMenuType::MenuEntry; }
+	virtual TSharedPtr<ILiveLinkSource> CreateSource(const FString& ConnectionString) const override;
+};
@@ -20,6 +20,7 @@
 #include "Json.h"
 
 #include "TechnocraneRuntimeSettings.h"
+#include "TechnocraneLensProfile.h"
 #include "LiveLinkTechnocraneTypes.h"
 
 #include "Windows/WindowsPlatformTime.h"
@@ -54,14 +55,49 @@ FLiveLinkTechnocraneSource::FLiveLinkTechnocraneSource(bool use_network, int ser
 		m_SourceMachineName = FText::FromString(TEXT("COM ") + FString::FromInt(serial_port));
 	}
 	
+	if (const UTechnocraneRuntimeSettings* settings = GetDefault<UTechnocraneRuntimeSettings>())
+	{
+		if (const UTechnocraneLensProfile* lens_profile = settings->LensProfile.LoadSynchronous())
+		{
+			m_FocalLengthTable = lens_profile->GetFocalLengthTable();
+			m_FocusDistanceTable = lens_profile->GetFocusDistanceTable();
+			m_TStopTable = lens_profile->GetTStopTable();
+		}
+	}
+
 	m_Hardware = new NTechnocrane::CTechnocrane_Hardware();
 	m_Hardware->Init(false, false, false);
 
+	FTechnocraneClusterSamples::RegisterSource(this);
+
+	if (const UTechnocraneRuntimeSettings* settings = GetDefault<UTechnocraneRuntimeSettings>())
+	{
+		if (settings->bPublishSharedSamples)
+		{
+			m_SharedPublisher.Open(GetClusterSourceId());
+		}
+
+		FIPv4Endpoint multicast_endpoint;
+		if (settings->bMulticastSamples && FIPv4Endpoint::Parse(settings->MulticastEndpoint, multicast_endpoint))
+		{
+			m_MulticastSender.Start(multicast_endpoint, settings->MulticastTtl);
+		}
+
+		FIPv4Endpoint freed_endpoint;
+		if (settings->bFreeDOutput && FIPv4Endpoint::Parse(settings->FreeDOutputEndpoint, freed_endpoint))
+		{
+			m_FreeDSender.Start(freed_endpoint, settings->MulticastTtl, ECraneSampleFormat::FreeD, static_cast<uint8>(settings->FreeDCameraId),
+				NTechnocraneFreeD::MakeLensEncoding(*settings));
+		}
+	}
+
 	Start();
 }
 
 FLiveLinkTechnocraneSource::~FLiveLinkTechnocraneSource()
 {
+	FTechnocraneClusterSamples::UnregisterSource(this);
+
 	Stop();
 	if (m_Thread != nullptr)
 	{
@@ -70,6 +106,9 @@ FLiveLinkTechnocraneSource::~FLiveLinkTechnocraneSource()
 		m_Thread = nullptr;
 	}
 
+	// the receiver thread updates the health until it exits
+	FTechnocraneReceptionStats::Remove(GetClusterSourceId());
+
 	if (m_Hardware)
 	{
 		delete m_Hardware;
@@ -142,6 +181,10 @@ uint32 FLiveLinkTechnocraneSource::Run()
 	float last_timestamp = FPlatformTime::Seconds();
 	constexpr float reset_time{ 3.0f };
 
+	double last_packet_time = FPlatformTime::Seconds();
+	m_LastHealthTime = last_packet_time;
+	m_LastReception = m_Hardware->GetDataReceptionStatus();
+
 	while (!m_Stopping)
 	{
 		if (!m_Hardware)
@@ -167,12 +210,59 @@ uint32 FLiveLinkTechnocraneSource::Run()
 			{
 				const float rate = m_Hardware->GetTimeCodeRate();
 				UpdateStatus(packet, first_enter, rate);
-				AsyncTask(ENamedThreads::GameThread, [this, packet]() { HandleReceivedData(packet); });
+
+				// fan out of decoded samples, the multicast sender only queues a sample here
+				if (m_SharedPublisher.IsOpen() || m_MulticastSender.IsStarted() || m_FreeDSender.IsStarted())
+				{
+					NTechnocraneShared::SSample sample;
+					DecodePacket(packet, *GetDefault<UTechnocraneRuntimeSettings>(), sample);
+
+					// receivers publish the same LiveLink properties as this source
+					FCraneRawValues raw;
+					memcpy(raw.Position, packet.Position, sizeof(raw.Position));
+					raw.Pan = packet.Pan;
+					raw.Tilt = packet.Tilt;
+					raw.Roll = packet.Roll;
+					raw.Zoom = packet.Zoom;
+					raw.Iris = packet.Iris;
+					raw.Focus = packet.Focus;
+
+					if (m_SharedPublisher.IsOpen())
+					{
+						m_SharedPublisher.Publish(sample);
+					}
+					if (m_MulticastSender.IsStarted())
+					{
+						m_MulticastSender.Enqueue(sample, raw);
+					}
+					if (m_FreeDSender.IsStarted())
+					{
+						m_FreeDSender.Enqueue(sample, raw);
+					}
+				}
+
+				// in a render cluster every node keeps packets and pushes the one chosen by the primary node for a frame
+				if (FTechnocraneClusterSamples::IsEnabled())
+				{
+					m_SampleRing.Add(packet);
+				}
+				else
+				{
+					++m_QueueDepth;
+					AsyncTask(ENamedThreads::GameThread, [this, packet]() { --m_QueueDepth; HandleReceivedData(packet); });
+				}
 				
 				last_timestamp = curr_time;
+				last_packet_time = FPlatformTime::Seconds();
 			}
 		}
 
+		const double health_time = FPlatformTime::Seconds();
+		if (health_time - m_LastHealthTime >= FTechnocraneReceptionStats::SampleInterval)
+		{
+			SampleReceptionHealth(health_time, last_packet_time);
+		}
+
 		first_enter = ((curr_time - last_timestamp) > reset_time);
 	}
 
@@ -186,41 +276,146 @@ uint32 FLiveLinkTechnocraneSource::Run()
 }
 
 
-void FLiveLinkTechnocraneSource::HandleReceivedData(const NTechnocrane::STechnocrane_Packet& packet)
+void FLiveLinkTechnocraneSource::SampleReceptionHealth(const double curr_time, const double last_packet_time)
 {
-	if (m_Stopping)
-		return;
+	const NTechnocrane::dataReceptionStatus& reception = m_Hardware->GetDataReceptionStatus();
+	const double elapsed = curr_time - m_LastHealthTime;
+
+	// counters start over when the connection is reopened
+	auto delta = [](const int curr, const int prev) { return (curr >= prev) ? curr - prev : curr; };
+
+	const int new_packets = delta(reception.completePackets, m_LastReception.completePackets);
+	const int new_errors = delta(reception.totalCheckSumErrors, m_LastReception.totalCheckSumErrors)
+		+ delta(reception.totalMissedSyncs, m_LastReception.totalMissedSyncs);
+
+	FCraneReceptionHealth health;
+	health.SourceId = GetClusterSourceId();
+	health.bConnected = m_Hardware->IsReady();
+	health.TotalBytesRead = reception.totalCharsRead;
+	health.CompletePackets = reception.completePackets;
+	health.CheckSumErrors = reception.totalCheckSumErrors;
+	health.MissedSyncs = reception.totalMissedSyncs;
+	health.PacketRate = static_cast<float>(new_packets / elapsed);
+	health.ErrorRate = static_cast<float>(new_errors / elapsed);
+	health.QueueDepth = m_QueueDepth.load();
+	health.SecondsSinceLastPacket = static_cast<float>(curr_time - last_packet_time);
+
+	FTechnocraneReceptionStats::Update(health);
+
+	m_LastReception = reception;
+	m_LastHealthTime = curr_time;
+}
 
-	const UTechnocraneRuntimeSettings* settings = GetDefault<UTechnocraneRuntimeSettings>();
+FString FLiveLinkTechnocraneSource::GetClusterSourceId() const
+{
+	return (m_UseNetwork) ? FString::Printf(TEXT("Udp%d"), m_NetworkAddress.Port) : FString::Printf(TEXT("Com%d"), m_SerialPort);
+}
 
-	if (!settings)
-		return;
+FCraneSampleKey FLiveLinkTechnocraneSource::GetLatestSample(const int32 Delay) const
+{
+	return m_SampleRing.GetLatest(Delay);
+}
 
+bool FLiveLinkTechnocraneSource::PushSample(const FCraneSampleKey& Key, const double WaitSeconds)
+{
+	check(IsInGameThread());
+
+	// the crane is parked, the same sample is chosen again
+	if (Key == m_LastPushedSample)
+	{
+		return true;
+	}
+
+	NTechnocrane::STechnocrane_Packet packet;
+	if (!m_SampleRing.WaitFor(Key, WaitSeconds, packet))
+	{
+		return false;
+	}
+
+	HandleReceivedData(packet);
+	m_LastPushedSample = Key;
+	return true;
+}
+
+void FLiveLinkTechnocraneSource::DecodePacket(const NTechnocrane::STechnocrane_Packet& packet, const UTechnocraneRuntimeSettings& settings, NTechnocraneShared::SSample& sample) const
+{
 	const float x = packet.Position[2];
 	const float y = packet.Position[0];
 	const float z = packet.Position[1];
 
-	const float space_scale = settings->SpaceScaleByDefault;
+	const float space_scale = settings.SpaceScaleByDefault;
+
+	sample.WorldTime = FPlatformTime::Seconds();
+	sample.PacketNumber = static_cast<int32>(packet.PacketNumber);
+	sample.Timecode = FCraneSampleRing::MakeKey(packet).Timecode;
 
-	FVector		v(space_scale * y, space_scale * x, space_scale * z);
-	FRotator	rot(packet.Tilt, 90.0f + packet.Pan, packet.Roll);
+	sample.Location[0] = space_scale * y;
+	sample.Location[1] = space_scale * x;
+	sample.Location[2] = space_scale * z;
 
-	const float track_position = space_scale * packet.TrackPos;
+	sample.Rotation[0] = packet.Tilt;
+	sample.Rotation[1] = 90.0f + packet.Pan;
+	sample.Rotation[2] = packet.Roll;
+
+	sample.TrackPosition = space_scale * packet.TrackPos;
 
 	float zoom = 1.0;
-	bool IsZoomCalibrated = NTechnocrane::ComputeZoomf(zoom, packet.Zoom, settings->ZoomRange.Min, settings->ZoomRange.Max);
+	bool IsZoomCalibrated = true;
+	if (m_FocalLengthTable.IsValid())
+	{
+		zoom = m_FocalLengthTable.Evaluate(packet.Zoom);
+	}
+	else
+	{
+		IsZoomCalibrated = NTechnocrane::ComputeZoomf(zoom, packet.Zoom, settings.ZoomRange.Min, settings.ZoomRange.Max);
+	}
 	
 	float iris = 1.0;
 	bool IsIrisCalibrated = false;
 	
-	const bool packed_data = settings->bPacketContainsRawAndCalibratedData;
-	if (!packed_data)
+	const bool packed_data = settings.bPacketContainsRawAndCalibratedData;
+	if (!packed_data && m_TStopTable.IsValid())
 	{
-		IsIrisCalibrated = NTechnocrane::ComputeIrisf(iris, packet.Iris, settings->IrisRange.Min, settings->IrisRange.Max);
+		iris = m_TStopTable.Evaluate(packet.Iris);
+		IsIrisCalibrated = true;
+	}
+	else if (!packed_data)
+	{
+		IsIrisCalibrated = NTechnocrane::ComputeIrisf(iris, packet.Iris, settings.IrisRange.Min, settings.IrisRange.Max);
 	}
 
 	float focus = 1.0;
-	bool IsFocusCalibrated = NTechnocrane::ComputeFocusf(focus, packet.Focus, settings->FocusRange.Min, settings->FocusRange.Max);
+	const bool IsFocusCalibrated = UTechnocraneLensProfile::ComputeFocusDistance(m_FocusDistanceTable, packet.Focus,
+		FVector2D(settings.FocusRange.Min, settings.FocusRange.Max), space_scale, focus);
+
+	sample.FocalLength = zoom;
+	sample.FocusDistance = focus;
+	sample.Aperture = iris;
+
+	sample.Flags = ((packet.HasTimeCode()) ? NTechnocraneShared::HasTimeCode : 0)
+		| ((packet.CameraOn) ? NTechnocraneShared::CameraOn : 0)
+		| ((packet.Running) ? NTechnocraneShared::Running : 0)
+		| ((IsZoomCalibrated) ? NTechnocraneShared::ZoomCalibrated : 0)
+		| ((IsFocusCalibrated) ? NTechnocraneShared::FocusCalibrated : 0)
+		| ((IsIrisCalibrated) ? NTechnocraneShared::IrisCalibrated : 0);
+}
+
+void FLiveLinkTechnocraneSource::HandleReceivedData(const NTechnocrane::STechnocrane_Packet& packet)
+{
+	if (m_Stopping)
+		return;
+
+	const UTechnocraneRuntimeSettings* settings = GetDefault<UTechnocraneRuntimeSettings>();
+
+	if (!settings)
+		return;
+
+	NTechnocraneShared::SSample sample;
+	DecodePacket(packet, *settings, sample);
+
+	const FVector v(sample.Location[0], sample.Location[1], sample.Location[2]);
+	const FRotator rot(sample.Rotation[0], sample.Rotation[1], sample.Rotation[2]);
+	const float track_position = sample.TrackPosition;
 
 	//
 	// static data
@@ -239,20 +434,7 @@ void FLiveLinkTechnocraneSource::HandleReceivedData(const NTechnocrane::STechnoc
 		
 		StaticData.PropertyNames.Reset(static_cast<int32>(EPacketProperties::Total));
 
-		const char* property_names[static_cast<int32>(EPacketProperties::Total)] = {
-			"TrackPosition",
-			"PacketNumber",
-			"X",
-			"Y",
-			"Z",
-			"Pan",
-			"Tilt",
-			"Roll",
-			"CameraOn",
-			"Running"
-		};
-
-		for (const char* name : property_names)
+		for (const char* name : PacketPropertyNames)
 		{
 			StaticData.PropertyNames.Add(name);
 		}
@@ -269,9 +451,9 @@ void FLiveLinkTechnocraneSource::HandleReceivedData(const NTechnocrane::STechnoc
 	FLiveLinkFrameDataStruct FrameDataStruct = FLiveLinkFrameDataStruct(FLiveLinkCameraFrameData::StaticStruct());
 	FLiveLinkCameraFrameData& FrameData = *FrameDataStruct.Cast<FLiveLinkCameraFrameData>();
 
-	FrameData.FocalLength = zoom;
-	FrameData.FocusDistance = space_scale * focus;
-	FrameData.Aperture = iris;
+	FrameData.FocalLength = sample.FocalLength;
+	FrameData.FocusDistance = sample.FocusDistance;
+	FrameData.Aperture = sample.Aperture;
 
 	const bool has_timecode = packet.HasTimeCode();
 	const int32 packet_number = packet.PacketNumber;
@@ -294,14 +476,14 @@ void FLiveLinkTechnocraneSource::HandleReceivedData(const NTechnocrane::STechnoc
 
 	FrameData.Transform.SetTranslation(v);
 	FrameData.Transform.SetRotation(rot.Quaternion());
-	FrameData.MetaData.SceneTime.Time = TimeCode.ToFrameNumber(FrameRate);
+	FrameData.MetaData.SceneTime = FQualifiedFrameTime(TimeCode.ToFrameNumber(FrameRate), FrameRate);
 	
 	FrameData.MetaData.StringMetaData.Add("CameraOn", (packet.CameraOn) ? "1" : "0");
 	FrameData.MetaData.StringMetaData.Add("Running", (packet.Running) ? "1" : "0");
 
-	FrameData.MetaData.StringMetaData.Add("IsZoomCalibrated", (IsZoomCalibrated) ? "1" : "0");
-	FrameData.MetaData.StringMetaData.Add("IsFocusCalibrated", (IsFocusCalibrated) ? "1" : "0");
-	FrameData.MetaData.StringMetaData.Add("IsIrisCalibrated", (IsIrisCalibrated) ? "1" : "0");
+	FrameData.MetaData.StringMetaData.Add("IsZoomCalibrated", (sample.Flags & NTechnocraneShared::ZoomCalibrated) ? "1" : "0");
+	FrameData.MetaData.StringMetaData.Add("IsFocusCalibrated", (sample.Flags & NTechnocraneShared::FocusCalibrated) ? "1" : "0");
+	FrameData.MetaData.StringMetaData.Add("IsIrisCalibrated", (sample.Flags & NTechnocraneShared::IrisCalibrated) ? "1" : "0");
 	
 	FrameData.MetaData.StringMetaData.Add("PacketNumber", FString::FromInt(packet_number));
 
@@ -320,7 +502,10 @@ void FLiveLinkTechnocraneSource::HandleReceivedData(const NTechnocrane::STechnoc
 		packet.Tilt,
 		packet.Roll,
 		static_cast<float>(packet.CameraOn),
-		static_cast<float>(packet.Running)
+		static_cast<float>(packet.Running),
+		packet.Zoom,
+		packet.Iris,
+		packet.Focus
 	};
 
 	FrameData.PropertyValues.Reserve(static_cast<int32>(EPacketProperties::Total));
@@ -329,7 +514,7 @@ void FLiveLinkTechnocraneSource::HandleReceivedData(const NTechnocrane::STechnoc
 		FrameData.PropertyValues.Add(prop);
 	}
 
-	FrameData.WorldTime = FPlatformTime::Seconds();
+	FrameData.WorldTime = sample.WorldTime;
 	m_Client->PushSubjectFrameData_AnyThread({ m_SourceGuid, subject_name }, MoveTemp(FrameDataStruct));
 }
 
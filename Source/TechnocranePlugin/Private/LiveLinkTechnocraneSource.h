@@ -14,13 +14,22 @@
 #include "Interfaces/IPv4/IPv4Endpoint.h"
 
 #include <technocrane_hardware.h>
+#include "TechnocraneLensTable.h"
+#include "TechnocraneClusterSamples.h"
+#include "TechnocraneSampleRing.h"
+#include "TechnocraneSharedSamplePublisher.h"
+#include "TechnocraneSampleMulticast.h"
+#include "TechnocraneReceptionHealth.h"
+
+#include <atomic>
 
 class FRunnableThread;
 class FSocket;
 class ILiveLinkClient;
 class ISocketSubsystem;
+class UTechnocraneRuntimeSettings;
 
-class TECHNOCRANEPLUGIN_API FLiveLinkTechnocraneSource : public ILiveLinkSource, public FRunnable
+class TECHNOCRANEPLUGIN_API FLiveLinkTechnocraneSource : public ILiveLinkSource, public FRunnable, public ICraneClusterSampleSource
 {
 public:
 	//! a constructor
@@ -49,6 +58,12 @@ public:
 
 	// End FRunnable Interface
 
+	// ICraneClusterSampleSource interface
+
+	FString GetClusterSourceId() const override;
+	FCraneSampleKey GetLatestSample(const int32 Delay) const override;
+	bool PushSample(const FCraneSampleKey& Key, const double WaitSeconds) override;
+
 	void HandleReceivedData(const NTechnocrane::STechnocrane_Packet& packet);
 
 private:
@@ -88,9 +103,32 @@ private:
 
 	NTechnocrane::CTechnocrane_Hardware*	m_Hardware{ nullptr };
 
+	// lens profile tables, copied on the game thread and read by the receiver thread
+	FCraneLensTable			m_FocalLengthTable;
+	FCraneLensTable			m_FocusDistanceTable;
+	FCraneLensTable			m_TStopTable;
+
+	// received packets in a cluster mode, only a sample chosen for a frame is pushed into LiveLink
+	FCraneSampleRing		m_SampleRing;
+	FCraneSampleKey			m_LastPushedSample;
+
+	// decoded samples for other processes on the machine, written by the receiver thread
+	FCraneSharedSamplePublisher	m_SharedPublisher;
+	// decoded samples for other machines, sent from its own thread
+	FCraneSampleMulticastSender	m_MulticastSender;
+	FCraneSampleMulticastSender	m_FreeDSender;
+
+	// reception counters at the previous health sample, rates are derived from the difference
+	NTechnocrane::dataReceptionStatus	m_LastReception{};
+	double					m_LastHealthTime{ 0.0 };
+	// packets handed to the game thread and not handled yet
+	std::atomic<int32>		m_QueueDepth{ 0 };
+
 	void PrepareOptions(NTechnocrane::SOptions& options);
 	bool CompareOptions(const NTechnocrane::SOptions& a, const NTechnocrane::SOptions& b);
 
 	bool KeepLive(const bool compare_options=false);
+	void DecodePacket(const NTechnocrane::STechnocrane_Packet& packet, const UTechnocraneRuntimeSettings& settings, NTechnocraneShared::SSample& sample) const;
 	void UpdateStatus(const NTechnocrane::STechnocrane_Packet& packet, const bool force_update, const float rate);
+	void SampleReceptionHealth(const double curr_time, const double last_packet_time);
 };
\ No newline at end of file
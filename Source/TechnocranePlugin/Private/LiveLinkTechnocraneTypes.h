@@ -13,5 +13,39 @@ enum class EPacketProperties : uint8
 	Roll,
 	CameraOn,
 	Running,
+	/** lens encoder values */
+	Zoom,
+	Iris,
+	Focus,
 	Total
-};
\ No newline at end of file
+};
+
+// LiveLink property names in order of packet properties
+constexpr const char* PacketPropertyNames[static_cast<int32>(EPacketProperties::Total)] = {
+	"TrackPosition",
+	"PacketNumber",
+	"X",
+	"Y",
+	"Z",
+	"Pan",
+	"Tilt",
+	"Roll",
+	"CameraOn",
+	"Running",
+	"Zoom",
+	"Iris",
+	"Focus"
+};
+
+/** crane values as the hardware sends them, before the axis swap and the space scale of a decoded sample */
+struct FCraneRawValues
+{
+	float Position[3]{ 0.0f, 0.0f, 0.0f };
+	float Pan{ 0.0f };
+	float Tilt{ 0.0f };
+	float Roll{ 0.0f };
+	/** lens encoder values, the sample datagram doesn't carry them */
+	float Zoom{ 0.0f };
+	float Iris{ 0.0f };
+	float Focus{ 0.0f };
+};
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// MovieSceneTechnocraneSection.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "MovieSceneTechnocraneSection.h"
+#include "TechnocranePrivatePCH.h"
+#include "MovieScene.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(MovieSceneTechnocraneSection)
+
+UMovieSceneTechnocraneSection::UMovieSceneTechnocraneSection(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	EvalOptions.EnableAndSetCompletionMode(EMovieSceneCompletionMode::RestoreState);
+}
+
+void UMovieSceneTechnocraneSection::SetSamples(FCraneTakeSamples&& InSamples)
+{
+	Modify();
+	Samples = MoveTemp(InSamples);
+	TimecodeSource = FMovieSceneTimecodeSource(FTimecode::FromFrameNumber(Samples.StartFrame, Samples.SampleRate));
+
+	const UMovieScene* MovieScene = GetTypedOuter<UMovieScene>();
+	if (!MovieScene || Samples.IsEmpty())
+	{
+		return;
+	}
+
+	// the last sample is held for one sample period
+	const FFrameNumber StartFrame = (HasStartFrame()) ? GetInclusiveStartFrame() : FFrameNumber(0);
+	const FFrameNumber Duration = FFrameRate::TransformTime(FFrameTime(Samples.Num()), Samples.SampleRate, MovieScene->GetTickResolution()).CeilToFrame();
+
+	SetRange(TRange<FFrameNumber>(StartFrame, StartFrame + Duration));
+}
+
+FFrameTime UMovieSceneTechnocraneSection::GetTakeTime(const FFrameTime Time, const FFrameRate TickResolution) const
+{
+	const FFrameNumber SectionStart = (HasStartFrame()) ? GetInclusiveStartFrame() : FFrameNumber(0);
+	const FFrameTime LocalTime = FFrameRate::TransformTime(Time - FFrameTime(SectionStart), TickResolution, Samples.SampleRate);
+
+	return FFrameTime(TimecodeSource.Timecode.ToFrameNumber(Samples.SampleRate)) + LocalTime;
+}
+
+void UMovieSceneTechnocraneSection::EvaluateSamples(const FFrameTime Time, const FFrameRate TickResolution, TArrayView<float> OutSample) const
+{
+	Samples.Evaluate(GetTakeTime(Time, TickResolution), OutSample);
+}
+
+void UMovieSceneTechnocraneSection::TrimSection(FQualifiedFrameTime TrimTime, bool bTrimLeft, bool bDeleteKeys)
+{
+	const FFrameNumber SectionStart = (HasStartFrame()) ? GetInclusiveStartFrame() : FFrameNumber(0);
+
+	Super::TrimSection(TrimTime, bTrimLeft, bDeleteKeys);
+
+	// a new section start keeps the take timecode it had
+	if (bTrimLeft && HasStartFrame())
+	{
+		OffsetTimecodeSource(GetInclusiveStartFrame() - SectionStart);
+	}
+}
+
+UMovieSceneSection* UMovieSceneTechnocraneSection::SplitSection(FQualifiedFrameTime SplitTime, bool bDeleteKeys)
+{
+	const FFrameNumber SectionStart = (HasStartFrame()) ? GetInclusiveStartFrame() : FFrameNumber(0);
+
+	UMovieSceneTechnocraneSection* NewSection = Cast<UMovieSceneTechnocraneSection>(Super::SplitSection(SplitTime, bDeleteKeys));
+
+	// the right part is a copy of the section, it starts later in the take
+	if (NewSection && NewSection->HasStartFrame())
+	{
+		NewSection->OffsetTimecodeSource(NewSection->GetInclusiveStartFrame() - SectionStart);
+	}
+	return NewSection;
+}
+
+void UMovieSceneTechnocraneSection::OffsetTimecodeSource(const FFrameNumber Offset)
+{
+	const UMovieScene* MovieScene = GetTypedOuter<UMovieScene>();
+	if (!MovieScene || Offset == 0)
+	{
+		return;
+	}
+
+	const FFrameNumber TakeStart = TimecodeSource.Timecode.ToFrameNumber(Samples.SampleRate);
+	const FFrameNumber TakeOffset = FFrameRate::TransformTime(FFrameTime(Offset), MovieScene->GetTickResolution(), Samples.SampleRate).RoundToFrame();
+
+	TimecodeSource = FMovieSceneTimecodeSource(FTimecode::FromFrameNumber(TakeStart + TakeOffset, Samples.SampleRate));
+}
+
+void UMovieSceneTechnocraneSection::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	Ar << Samples;
+}
+
+void UMovieSceneTechnocraneSection::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Samples.GetAllocatedSize());
+}
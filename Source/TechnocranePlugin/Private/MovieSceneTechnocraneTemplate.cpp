@@ -0,0 +1,144 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// MovieSceneTechnocraneTemplate.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "MovieSceneTechnocraneTemplate.h"
+#include "TechnocranePrivatePCH.h"
+#include "MovieSceneTechnocraneSection.h"
+#include "TechnocraneCameraComponent.h"
+#include "TechnocraneStats.h"
+
+#include "Evaluation/MovieSceneEvaluation.h"
+#include "Evaluation/MovieSceneExecutionTokens.h"
+#include "Evaluation/MovieScenePreAnimatedState.h"
+#include "IMovieScenePlayer.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(MovieSceneTechnocraneTemplate)
+
+DECLARE_CYCLE_STAT(TEXT("Technocrane Take Evaluate"), STAT_TechnocraneTakeEvaluate, STATGROUP_Technocrane);
+
+namespace NMovieSceneTechnocrane
+{
+	UTechnocraneCameraComponent* FindCameraComponent(UObject* Object)
+	{
+		if (UTechnocraneCameraComponent* CameraComponent = Cast<UTechnocraneCameraComponent>(Object))
+		{
+			return CameraComponent;
+		}
+
+		const AActor* Actor = Cast<AActor>(Object);
+		return (Actor) ? Actor->FindComponentByClass<UTechnocraneCameraComponent>() : nullptr;
+	}
+
+	/** the take moves the whole camera actor */
+	USceneComponent* FindRootComponent(const UTechnocraneCameraComponent& CameraComponent)
+	{
+		const AActor* Owner = CameraComponent.GetOwner();
+		return (Owner) ? Owner->GetRootComponent() : nullptr;
+	}
+
+	struct FPreAnimatedToken : IMovieScenePreAnimatedToken
+	{
+		FTransform RelativeTransform{ FTransform::Identity };
+		float Zoom{ 0.0f };
+		float Iris{ 0.0f };
+		float Focus{ 0.0f };
+		float TrackPos{ 0.0f };
+
+		virtual void RestoreState(UObject& Object, const UE::MovieScene::FRestoreStateParams& Params) override
+		{
+			UTechnocraneCameraComponent* CameraComponent = CastChecked<UTechnocraneCameraComponent>(&Object);
+
+			if (USceneComponent* RootComponent = FindRootComponent(*CameraComponent))
+			{
+				RootComponent->SetRelativeTransform(RelativeTransform);
+			}
+
+			CameraComponent->TrackPos = TrackPos;
+			CameraComponent->SetRawLensValues(Zoom, Iris, Focus);
+		}
+	};
+
+	struct FPreAnimatedTokenProducer : IMovieScenePreAnimatedTokenProducer
+	{
+		virtual IMovieScenePreAnimatedTokenPtr CacheExistingState(UObject& Object) const override
+		{
+			const UTechnocraneCameraComponent* CameraComponent = CastChecked<UTechnocraneCameraComponent>(&Object);
+
+			FPreAnimatedToken Token;
+			if (const USceneComponent* RootComponent = FindRootComponent(*CameraComponent))
+			{
+				Token.RelativeTransform = RootComponent->GetRelativeTransform();
+			}
+
+			Token.Zoom = CameraComponent->Zoom;
+			Token.Iris = CameraComponent->Iris;
+			Token.Focus = CameraComponent->Focus;
+			Token.TrackPos = CameraComponent->TrackPos;
+			return MoveTemp(Token);
+		}
+	};
+
+	struct FExecutionToken : IMovieSceneExecutionToken
+	{
+		float Sample[FCraneTakeSamples::NumChannels]{ 0.0f };
+
+		static FMovieSceneAnimTypeID GetAnimTypeID()
+		{
+			return TMovieSceneAnimTypeID<FExecutionToken>();
+		}
+
+		float GetValue(const ECraneTakeChannel Channel) const
+		{
+			return Sample[static_cast<int32>(Channel)];
+		}
+
+		virtual void Execute(const FMovieSceneContext& Context, const FMovieSceneEvaluationOperand& Operand, FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) override
+		{
+			const FVector Location(GetValue(ECraneTakeChannel::LocationX), GetValue(ECraneTakeChannel::LocationY), GetValue(ECraneTakeChannel::LocationZ));
+			const FRotator Rotation(GetValue(ECraneTakeChannel::Pitch), GetValue(ECraneTakeChannel::Yaw), GetValue(ECraneTakeChannel::Roll));
+
+			for (TWeakObjectPtr<> WeakObject : Player.FindBoundObjects(Operand))
+			{
+				UTechnocraneCameraComponent* CameraComponent = FindCameraComponent(WeakObject.Get());
+				if (!CameraComponent)
+				{
+					continue;
+				}
+
+				Player.SavePreAnimatedState(*CameraComponent, GetAnimTypeID(), FPreAnimatedTokenProducer());
+
+				if (USceneComponent* RootComponent = FindRootComponent(*CameraComponent))
+				{
+					RootComponent->SetRelativeLocationAndRotation(Location, Rotation);
+				}
+
+				CameraComponent->TrackPos = GetValue(ECraneTakeChannel::TrackPosition);
+				CameraComponent->SetRawLensValues(GetValue(ECraneTakeChannel::Zoom), GetValue(ECraneTakeChannel::Iris), GetValue(ECraneTakeChannel::Focus));
+			}
+		}
+	};
+};
+
+FMovieSceneTechnocraneSectionTemplate::FMovieSceneTechnocraneSectionTemplate(const UMovieSceneTechnocraneSection& InSection)
+	: Section(&InSection)
+{
+}
+
+void FMovieSceneTechnocraneSectionTemplate::Evaluate(const FMovieSceneEvaluationOperand& Operand, const FMovieSceneContext& Context, const FPersistentEvaluationData& PersistentData, FMovieSceneExecutionTokens& ExecutionTokens) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneTakeEvaluate);
+
+	if (!Section)
+	{
+		return;
+	}
+
+	NMovieSceneTechnocrane::FExecutionToken Token;
+	Section->EvaluateSamples(Context.GetTime(), Context.GetFrameRate(), MakeArrayView(Token.Sample));
+
+	ExecutionTokens.Add(MoveTemp(Token));
+}
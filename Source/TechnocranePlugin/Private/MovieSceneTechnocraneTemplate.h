@@ -0,0 +1,32 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// MovieSceneTechnocraneTemplate.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Evaluation/MovieSceneEvalTemplate.h"
+#include "MovieSceneTechnocraneTemplate.generated.h"
+
+class UMovieSceneTechnocraneSection;
+
+/** evaluates take samples of a section, samples are not copied into the template */
+USTRUCT()
+struct FMovieSceneTechnocraneSectionTemplate : public FMovieSceneEvalTemplate
+{
+	GENERATED_BODY()
+
+	FMovieSceneTechnocraneSectionTemplate() {}
+	FMovieSceneTechnocraneSectionTemplate(const UMovieSceneTechnocraneSection& InSection);
+
+	UPROPERTY()
+	TObjectPtr<const UMovieSceneTechnocraneSection> Section{ nullptr };
+
+private:
+
+	virtual UScriptStruct& GetScriptStructImpl() const override { return *StaticStruct(); }
+	virtual void Evaluate(const FMovieSceneEvaluationOperand& Operand, const FMovieSceneContext& Context, const FPersistentEvaluationData& PersistentData, FMovieSceneExecutionTokens& ExecutionTokens) const override;
+};
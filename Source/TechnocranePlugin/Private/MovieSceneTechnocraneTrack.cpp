@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// MovieSceneTechnocraneTrack.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "MovieSceneTechnocraneTrack.h"
+#include "TechnocranePrivatePCH.h"
+#include "MovieSceneTechnocraneSection.h"
+#include "MovieSceneTechnocraneTemplate.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(MovieSceneTechnocraneTrack)
+
+#define LOCTEXT_NAMESPACE "MovieSceneTechnocraneTrack"
+
+UMovieSceneTechnocraneSection* UMovieSceneTechnocraneTrack::AddTake(FCraneTakeSamples&& Samples, const FFrameNumber StartFrame)
+{
+	Modify();
+
+	UMovieSceneTechnocraneSection* Section = CastChecked<UMovieSceneTechnocraneSection>(CreateNewSection());
+	Section->SetRowIndex(Sections.Num());
+	Section->SetRange(TRange<FFrameNumber>(StartFrame, StartFrame + 1));
+	Section->SetSamples(MoveTemp(Samples));
+
+	Sections.Add(Section);
+	return Section;
+}
+
+bool UMovieSceneTechnocraneTrack::SupportsType(TSubclassOf<UMovieSceneSection> SectionClass) const
+{
+	return SectionClass == UMovieSceneTechnocraneSection::StaticClass();
+}
+
+UMovieSceneSection* UMovieSceneTechnocraneTrack::CreateNewSection()
+{
+	return NewObject<UMovieSceneTechnocraneSection>(this, NAME_None, RF_Transactional);
+}
+
+const TArray<UMovieSceneSection*>& UMovieSceneTechnocraneTrack::GetAllSections() const
+{
+	return Sections;
+}
+
+bool UMovieSceneTechnocraneTrack::HasSection(const UMovieSceneSection& Section) const
+{
+	return Sections.Contains(&Section);
+}
+
+void UMovieSceneTechnocraneTrack::AddSection(UMovieSceneSection& Section)
+{
+	Sections.Add(&Section);
+}
+
+void UMovieSceneTechnocraneTrack::RemoveSection(UMovieSceneSection& Section)
+{
+	Sections.Remove(&Section);
+}
+
+void UMovieSceneTechnocraneTrack::RemoveSectionAt(int32 SectionIndex)
+{
+	Sections.RemoveAt(SectionIndex);
+}
+
+bool UMovieSceneTechnocraneTrack::IsEmpty() const
+{
+	return Sections.Num() == 0;
+}
+
+void UMovieSceneTechnocraneTrack::RemoveAllAnimationData()
+{
+	Sections.Empty();
+}
+
+#if WITH_EDITORONLY_DATA
+FText UMovieSceneTechnocraneTrack::GetDefaultDisplayName() const
+{
+	return LOCTEXT("DisplayName", "Technocrane Take");
+}
+#endif
+
+FMovieSceneEvalTemplatePtr UMovieSceneTechnocraneTrack::CreateTemplateForSection(const UMovieSceneSection& InSection) const
+{
+	return FMovieSceneTechnocraneSectionTemplate(*CastChecked<const UMovieSceneTechnocraneSection>(&InSection));
+}
+
+#undef LOCTEXT_NAMESPACE
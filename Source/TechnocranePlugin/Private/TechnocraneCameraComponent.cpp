@@ -8,9 +8,20 @@
 #include "TechnocraneCameraComponent.h"
 #include "TechnocranePrivatePCH.h"
 #include "TechnocraneRuntimeSettings.h"
+#include "TechnocraneLensProfile.h"
 #include "ITechnocranePlugin.h"
+#include "TechnocraneStats.h"
 #include <technocrane_hardware.h>
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Technocrane Camera Calibrations"), STAT_TechnocraneCameraCalibrations, STATGROUP_Technocrane);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Technocrane Camera Calibration Skips"), STAT_TechnocraneCameraCalibrationSkips, STATGROUP_Technocrane);
+
+namespace NTechnocraneCameraComponent
+{
+	// ticks without lens changes before a component goes to sleep
+	constexpr int32 IdleTicksToSleep{ 30 };
+};
+
 // Sets default values
 UTechnocraneCameraComponent::UTechnocraneCameraComponent()
 	: Super()
@@ -39,17 +50,185 @@ UTechnocraneCameraComponent::~UTechnocraneCameraComponent()
 // Called every frame
 void UTechnocraneCameraComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
-	IsZoomCalibrated = NTechnocrane::ComputeZoomf(CalibratedZoom, Zoom, ZoomRange.X, ZoomRange.Y);
-	IsIrisCalibrated = NTechnocrane::ComputeIrisf(CalibratedIris, Iris, IrisRange.X, IrisRange.Y);
-	IsFocusCalibrated = NTechnocrane::ComputeFocusf(CalibratedFocus, Focus, FocusRange.X, FocusRange.Y);
+	// raw values could be written directly, by live link or by blueprints
+	if (UpdateCalibration())
+	{
+		IdleTicks = 0;
+	}
+	else
+	{
+		++IdleTicks;
+	}
+	
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (IdleTicks >= NTechnocraneCameraComponent::IdleTicksToSleep && CanSleep())
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UTechnocraneCameraComponent::OnRegister()
+{
+	Super::OnRegister();
+	UpdateCalibration(true);
+}
+
+#if WITH_EDITOR
+void UTechnocraneCameraComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	UpdateCalibration(true);
+	WakeUp();
+}
+#endif
+
+UTechnocraneCameraComponent::FCalibrationInputs UTechnocraneCameraComponent::MakeCalibrationInputs() const
+{
+	FCalibrationInputs Inputs;
+	Inputs.Zoom = Zoom;
+	Inputs.Iris = Iris;
+	Inputs.Focus = Focus;
+	Inputs.ZoomRange = ZoomRange;
+	Inputs.IrisRange = IrisRange;
+	Inputs.FocusRange = FocusRange;
+	Inputs.SpaceScale = SpaceScale;
+	Inputs.bApply = ApplyCalibratedValues;
+	Inputs.LensProfile = LensProfile;
+	Inputs.LensRevision = (LensProfile) ? LensProfile->GetRevision() : 0;
+	return Inputs;
+}
+
+bool UTechnocraneCameraComponent::UpdateCalibration(bool bForce)
+{
+	const FCalibrationInputs Inputs = MakeCalibrationInputs();
+
+	if (!bForce && bCalibrationValid && Inputs == LastCalibrationInputs)
+	{
+		INC_DWORD_STAT(STAT_TechnocraneCameraCalibrationSkips);
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_TechnocraneCameraCalibrations);
+
+	if (LensProfile && LensProfile->HasFocalLength())
+	{
+		CalibratedZoom = LensProfile->GetFocalLength(Zoom);
+		IsZoomCalibrated = true;
+	}
+	else
+	{
+		IsZoomCalibrated = NTechnocrane::ComputeZoomf(CalibratedZoom, Zoom, ZoomRange.X, ZoomRange.Y);
+	}
+
+	if (LensProfile && LensProfile->HasTStop())
+	{
+		CalibratedIris = LensProfile->GetTStop(Iris);
+		IsIrisCalibrated = true;
+	}
+	else
+	{
+		IsIrisCalibrated = NTechnocrane::ComputeIrisf(CalibratedIris, Iris, IrisRange.X, IrisRange.Y);
+	}
+
+	const FCraneLensTable NoFocusTable;
+	IsFocusCalibrated = UTechnocraneLensProfile::ComputeFocusDistance((LensProfile) ? LensProfile->GetFocusDistanceTable() : NoFocusTable, Focus, FocusRange, SpaceScale, CalibratedFocus);
 
 	if (ApplyCalibratedValues)
 	{
 		CurrentFocalLength = CalibratedZoom;
 		CurrentAperture = CalibratedIris;
-		FocusSettings.ManualFocusDistance = SpaceScale * CalibratedFocus;
+		FocusSettings.ManualFocusDistance = CalibratedFocus;
+	}
+
+	LastCalibrationInputs = Inputs;
+	bCalibrationValid = true;
+	return true;
+}
+
+bool UTechnocraneCameraComponent::CanSleep() const
+{
+	// tracking focus and smooth focus changes are updated by the cine camera tick
+	return bSleepWhenIdle
+		&& FocusSettings.FocusMethod != ECameraFocusMethod::Tracking
+		&& !FocusSettings.bSmoothFocusChanges;
+}
+
+void UTechnocraneCameraComponent::WakeUp()
+{
+	IdleTicks = 0;
+
+	if (!IsComponentTickEnabled() && PrimaryComponentTick.bCanEverTick)
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UTechnocraneCameraComponent::SetRawLensValues(float InZoom, float InIris, float InFocus)
+{
+	Zoom = InZoom;
+	Iris = InIris;
+	Focus = InFocus;
+
+	if (UpdateCalibration())
+	{
+		WakeUp();
+	}
+}
+
+void UTechnocraneCameraComponent::SetZoom(float InZoom)
+{
+	SetRawLensValues(InZoom, Iris, Focus);
+}
+
+void UTechnocraneCameraComponent::SetIris(float InIris)
+{
+	SetRawLensValues(Zoom, InIris, Focus);
+}
+
+void UTechnocraneCameraComponent::SetFocus(float InFocus)
+{
+	SetRawLensValues(Zoom, Iris, InFocus);
+}
+
+void UTechnocraneCameraComponent::SetZoomRange(FVector2D InZoomRange)
+{
+	ZoomRange = InZoomRange;
+
+	if (UpdateCalibration())
+	{
+		WakeUp();
+	}
+}
+
+void UTechnocraneCameraComponent::SetIrisRange(FVector2D InIrisRange)
+{
+	IrisRange = InIrisRange;
+
+	if (UpdateCalibration())
+	{
+		WakeUp();
+	}
+}
+
+void UTechnocraneCameraComponent::SetFocusRange(FVector2D InFocusRange)
+{
+	FocusRange = InFocusRange;
+
+	if (UpdateCalibration())
+	{
+		WakeUp();
+	}
+}
+
+void UTechnocraneCameraComponent::SetSpaceScale(float InSpaceScale)
+{
+	SpaceScale = InSpaceScale;
+
+	if (UpdateCalibration())
+	{
+		WakeUp();
 	}
-	
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 }
 
@@ -0,0 +1,115 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClearanceQuery.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneClearanceQuery.h"
+#include "TechnocranePrivatePCH.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+void FCraneClearanceQuery::Issue(UWorld& World, const FCapsules& InCapsules, const ECollisionChannel Channel, const float InSearchDistance, const FCollisionQueryParams& Params)
+{
+	Reset();
+
+	Capsules = InCapsules;
+	SearchDistance = InSearchDistance;
+
+	for (const FCraneClearanceCapsule& Capsule : Capsules)
+	{
+		Handles.Add(World.AsyncOverlapByChannel(Capsule.GetCenter(), Capsule.GetRotation(), Channel, MakeShape(Capsule, SearchDistance), Params));
+	}
+}
+
+bool FCraneClearanceQuery::Collect(UWorld& World, FCraneClearanceResult& OutResult)
+{
+	if (Handles.Num() == 0)
+	{
+		return false;
+	}
+
+	FCraneClearanceResult Result;
+	Result.MinClearance = SearchDistance;
+
+	bool bResolved = true;
+
+	for (int32 i = 0; i < Handles.Num(); ++i)
+	{
+		FOverlapDatum Datum;
+		if (!World.QueryOverlapData(Handles[i], Datum))
+		{
+			bResolved = false;
+			break;
+		}
+
+		const FCraneClearanceCapsule& Capsule = Capsules[i];
+		const AActor* Actor = nullptr;
+		const float Clearance = ComputeClearance(Capsule, Datum.OutOverlaps, SearchDistance, Actor);
+
+		Result.MinClearance = FMath::Min(Result.MinClearance, Clearance);
+
+		// parts go from the column to the head, the first one in collision is reported
+		if (Clearance <= 0.0f && !Result.bCollision)
+		{
+			Result.bCollision = true;
+			Result.CollisionJoint = Capsule.Joint;
+			Result.CollisionActor = (Actor) ? Actor->GetFName() : NAME_None;
+		}
+	}
+
+	Handles.Reset();
+
+	if (bResolved)
+	{
+		OutResult = Result;
+	}
+	return bResolved;
+}
+
+void FCraneClearanceQuery::Reset()
+{
+	Handles.Reset();
+	Capsules.Reset();
+}
+
+FCollisionShape FCraneClearanceQuery::MakeShape(const FCraneClearanceCapsule& Capsule, const float InSearchDistance)
+{
+	const float Radius = Capsule.Radius + InSearchDistance;
+	return FCollisionShape::MakeCapsule(Radius, Capsule.GetHalfLength() + Radius);
+}
+
+float FCraneClearanceQuery::ComputeClearance(const FCraneClearanceCapsule& Capsule, TArrayView<const FOverlapResult> Overlaps, const float InSearchDistance, const AActor*& OutActor)
+{
+	float Clearance = InSearchDistance;
+	OutActor = nullptr;
+
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		const UPrimitiveComponent* Component = Overlap.GetComponent();
+		if (!Component)
+		{
+			continue;
+		}
+
+		// closest body point to the middle of the part, then to the closest point of the part
+		FVector PointOnBody;
+		float Distance = Component->GetDistanceToCollision(Capsule.GetCenter(), PointOnBody);
+		if (Distance >= 0.0f)
+		{
+			const FVector PointOnSegment = FMath::ClosestPointOnSegment(PointOnBody, Capsule.Start, Capsule.End);
+			Distance = Component->GetDistanceToCollision(PointOnSegment, PointOnBody);
+		}
+
+		// zero distance for a point inside the body, complex only collision has no distance and the overlap is a collision
+		const float ComponentClearance = (Distance >= 0.0f) ? Distance - Capsule.Radius : 0.0f;
+		if (ComponentClearance < Clearance || (!OutActor && ComponentClearance <= Clearance))
+		{
+			Clearance = ComponentClearance;
+			OutActor = Component->GetOwner();
+		}
+	}
+	return Clearance;
+}
@@ -0,0 +1,153 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClusterSamples.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneClusterSamples.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneRuntimeSettings.h"
+
+#include "HAL/IConsoleManager.h"
+
+std::atomic<ECraneClusterMode> FTechnocraneClusterSamples::Mode{ ECraneClusterMode::Disabled };
+TArray<ICraneClusterSampleSource*> FTechnocraneClusterSamples::Sources;
+
+FString FTechnocraneClusterSamples::LastSelection;
+uint32 FTechnocraneClusterSamples::NumSelections{ 0 };
+uint32 FTechnocraneClusterSamples::NumMissedSamples{ 0 };
+
+namespace NTechnocraneClusterSamples
+{
+	// a selection is a list of "SourceId=PacketNumber,Timecode" entries separated with ';'
+	constexpr TCHAR EntrySeparator = TEXT(';');
+	constexpr TCHAR KeySeparator = TEXT('=');
+	constexpr TCHAR ValueSeparator = TEXT(',');
+
+	double GetWaitSeconds()
+	{
+		const UTechnocraneRuntimeSettings* Settings = GetDefault<UTechnocraneRuntimeSettings>();
+		return (Settings) ? 0.001 * FMath::Max(Settings->ClusterSampleWaitTime, 0.0f) : 0.0;
+	}
+
+	void ShowStatus(const TArray<FString>& Args)
+	{
+		static const TCHAR* ModeNames[] = { TEXT("disabled"), TEXT("primary"), TEXT("secondary") };
+
+		UE_LOG(LogTechnocrane, Display, TEXT("Technocrane cluster samples %s, %u frames selected, %u samples missed, last selection [%s]"),
+			ModeNames[static_cast<int32>(FTechnocraneClusterSamples::GetMode())], FTechnocraneClusterSamples::GetNumSelections(),
+			FTechnocraneClusterSamples::GetNumMissedSamples(), *FTechnocraneClusterSamples::GetLastSelection());
+	}
+};
+
+void FTechnocraneClusterSamples::SetMode(const ECraneClusterMode InMode)
+{
+	check(IsInGameThread());
+
+	Mode.store(InMode, std::memory_order_release);
+
+	LastSelection.Reset();
+	NumSelections = 0;
+	NumMissedSamples = 0;
+}
+
+void FTechnocraneClusterSamples::RegisterSource(ICraneClusterSampleSource* Source)
+{
+	check(IsInGameThread());
+	Sources.AddUnique(Source);
+}
+
+void FTechnocraneClusterSamples::UnregisterSource(ICraneClusterSampleSource* Source)
+{
+	check(IsInGameThread());
+	Sources.Remove(Source);
+}
+
+FString FTechnocraneClusterSamples::SelectSamples()
+{
+	using namespace NTechnocraneClusterSamples;
+	check(IsInGameThread());
+
+	const UTechnocraneRuntimeSettings* Settings = GetDefault<UTechnocraneRuntimeSettings>();
+	const int32 Delay = (Settings) ? FMath::Max(Settings->ClusterSampleDelay, 0) : 0;
+
+	FString Selection;
+	for (ICraneClusterSampleSource* Source : Sources)
+	{
+		const FCraneSampleKey Key = Source->GetLatestSample(Delay);
+		if (!Key.IsValid())
+		{
+			continue;
+		}
+
+		// the primary has the sample already, no wait
+		Source->PushSample(Key, 0.0);
+
+		if (!Selection.IsEmpty())
+		{
+			Selection.AppendChar(EntrySeparator);
+		}
+		Selection += FString::Printf(TEXT("%s%c%d%c%u"), *Source->GetClusterSourceId(), KeySeparator, Key.PacketNumber, ValueSeparator, Key.Timecode);
+	}
+
+	LastSelection = Selection;
+	++NumSelections;
+	return Selection;
+}
+
+bool FTechnocraneClusterSamples::ApplySelection(const FString& Selection)
+{
+	using namespace NTechnocraneClusterSamples;
+	check(IsInGameThread());
+
+	LastSelection = Selection;
+	++NumSelections;
+
+	TArray<FString> Entries;
+	Selection.ParseIntoArray(Entries, &EntrySeparator, true);
+
+	const double WaitSeconds = GetWaitSeconds();
+	bool bAllReceived = true;
+
+	for (const FString& Entry : Entries)
+	{
+		FString SourceId, Value, PacketNumber, Timecode;
+		if (!Entry.Split(FString::ElementsToString(&KeySeparator, 1), &SourceId, &Value)
+			|| !Value.Split(FString::ElementsToString(&ValueSeparator, 1), &PacketNumber, &Timecode))
+		{
+			UE_LOG(LogTechnocrane, Warning, TEXT("Wrong cluster sample selection entry %s"), *Entry);
+			bAllReceived = false;
+			continue;
+		}
+
+		FCraneSampleKey Key;
+		Key.PacketNumber = FCString::Atoi(*PacketNumber);
+		Key.Timecode = static_cast<uint32>(FCString::Strtoui64(*Timecode, nullptr, 10));
+
+		ICraneClusterSampleSource* const* Source = Sources.FindByPredicate([&SourceId](const ICraneClusterSampleSource* Item)
+		{
+			return Item->GetClusterSourceId() == SourceId;
+		});
+
+		// a node without the source renders the frame without it, nothing to keep in sync
+		if (!Source)
+		{
+			continue;
+		}
+
+		if (!(*Source)->PushSample(Key, WaitSeconds))
+		{
+			UE_LOG(LogTechnocrane, Verbose, TEXT("Cluster sample %d of %s is not received in time"), Key.PacketNumber, *SourceId);
+			++NumMissedSamples;
+			bAllReceived = false;
+		}
+	}
+	return bAllReceived;
+}
+
+static FAutoConsoleCommand GTechnocraneClusterSamplesCmd(
+	TEXT("Technocrane.ClusterSamples"),
+	TEXT("Log the cluster sample selection mode, the last selection and the number of samples that were not received in time."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&NTechnocraneClusterSamples::ShowStatus)
+);
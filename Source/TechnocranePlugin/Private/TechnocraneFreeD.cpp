@@ -0,0 +1,177 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneFreeD.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneFreeD.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneRuntimeSettings.h"
+
+#include "HAL/IConsoleManager.h"
+
+namespace NTechnocraneFreeD
+{
+	// fields of the message, angles and positions follow the order of the axis tables
+	constexpr int32 AngleOffset = 2;
+	constexpr int32 PositionOffset = 11;
+	constexpr int32 ZoomOffset = 20;
+	constexpr int32 FocusOffset = 23;
+	constexpr int32 SpareOffset = 26;
+
+	FLensEncoding MakeLensEncoding(const UTechnocraneRuntimeSettings& Settings)
+	{
+		FLensEncoding Lens;
+		Lens.bCalibrated = Settings.FreeDLensEncoding == ECraneFreeDLensEncoding::Calibrated;
+		Lens.EncoderScale = FMath::Max(Settings.FreeDEncoderScale, 1.0f);
+		return Lens;
+	}
+
+	int32 ToFixed(const float Value, const float Scale, const int32 MinValue, const int32 MaxValue)
+	{
+		return static_cast<int32>(FMath::Clamp<int64>(FMath::RoundToInt64(static_cast<double>(Value) * Scale), MinValue, MaxValue));
+	}
+
+	void Write24(uint8* Data, const int32 Value)
+	{
+		Data[0] = static_cast<uint8>((Value >> 16) & 0xFF);
+		Data[1] = static_cast<uint8>((Value >> 8) & 0xFF);
+		Data[2] = static_cast<uint8>(Value & 0xFF);
+	}
+
+	int32 ReadSigned24(const uint8* Data)
+	{
+		const int32 Value = (Data[0] << 16) | (Data[1] << 8) | Data[2];
+		return (Value & 0x800000) ? Value - (1 << 24) : Value;
+	}
+
+	int32 ReadUnsigned24(const uint8* Data)
+	{
+		return (Data[0] << 16) | (Data[1] << 8) | Data[2];
+	}
+
+	uint8 ComputeChecksum(const uint8* Data)
+	{
+		uint8 Sum = 0x40;
+		for (int32 i = 0; i < Size - 1; ++i)
+		{
+			Sum -= Data[i];
+		}
+		return Sum;
+	}
+
+	void Encode(const NTechnocraneShared::SSample& Sample, const FCraneRawValues& Raw, const FLensEncoding& Lens, const uint8 CameraId, uint8 (&OutData)[Size])
+	{
+		OutData[0] = MessageType;
+		OutData[1] = CameraId;
+
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const float Angle = AngleSigns[i] * FRotator::NormalizeAxis(Sample.Rotation[AngleAxes[i]]);
+			Write24(OutData + AngleOffset + 3 * i, ToFixed(Angle, AngleScale, MinSigned24, MaxSigned24));
+
+			const float Position = PositionSigns[i] * Sample.Location[PositionAxes[i]];
+			Write24(OutData + PositionOffset + 3 * i, ToFixed(Position, PositionScale, MinSigned24, MaxSigned24));
+		}
+
+		if (Lens.bCalibrated)
+		{
+			Write24(OutData + ZoomOffset, ToFixed(Sample.FocalLength, FocalLengthScale, 0, MaxUnsigned24));
+			Write24(OutData + FocusOffset, ToFixed(Sample.FocusDistance, FocusDistanceScale, 0, MaxUnsigned24));
+		}
+		else
+		{
+			Write24(OutData + ZoomOffset, ToFixed(Raw.Zoom, Lens.EncoderScale, 0, MaxUnsigned24));
+			Write24(OutData + FocusOffset, ToFixed(Raw.Focus, Lens.EncoderScale, 0, MaxUnsigned24));
+		}
+
+		const int32 Aperture = ToFixed(Sample.Aperture, ApertureScale, 0, MAX_uint16);
+		OutData[SpareOffset] = static_cast<uint8>(Aperture >> 8);
+		OutData[SpareOffset + 1] = static_cast<uint8>(Aperture & 0xFF);
+
+		OutData[Size - 1] = ComputeChecksum(OutData);
+	}
+
+	bool Decode(const uint8* Data, const int32 DataSize, const FLensEncoding& Lens, NTechnocraneShared::SSample& OutSample, FCraneRawValues& OutRaw, uint8& OutCameraId)
+	{
+		if (DataSize != Size || Data[0] != MessageType || Data[Size - 1] != ComputeChecksum(Data))
+		{
+			return false;
+		}
+
+		OutCameraId = Data[1];
+
+		for (int32 i = 0; i < 3; ++i)
+		{
+			OutSample.Rotation[AngleAxes[i]] = AngleSigns[i] * ReadSigned24(Data + AngleOffset + 3 * i) / AngleScale;
+			OutSample.Location[PositionAxes[i]] = PositionSigns[i] * ReadSigned24(Data + PositionOffset + 3 * i) / PositionScale;
+		}
+
+		OutSample.Aperture = ((Data[SpareOffset] << 8) | Data[SpareOffset + 1]) / ApertureScale;
+		OutSample.Flags = NTechnocraneShared::IrisCalibrated;
+
+		if (Lens.bCalibrated)
+		{
+			OutSample.FocalLength = ReadUnsigned24(Data + ZoomOffset) / FocalLengthScale;
+			OutSample.FocusDistance = ReadUnsigned24(Data + FocusOffset) / FocusDistanceScale;
+			OutSample.Flags |= NTechnocraneShared::ZoomCalibrated | NTechnocraneShared::FocusCalibrated;
+
+			OutRaw.Zoom = 0.0f;
+			OutRaw.Focus = 0.0f;
+		}
+		else
+		{
+			const float InvEncoderScale = (Lens.EncoderScale > 0.0f) ? 1.0f / Lens.EncoderScale : 1.0f;
+			OutRaw.Zoom = ReadUnsigned24(Data + ZoomOffset) * InvEncoderScale;
+			OutRaw.Focus = ReadUnsigned24(Data + FocusOffset) * InvEncoderScale;
+
+			OutSample.FocalLength = 0.0f;
+			OutSample.FocusDistance = 0.0f;
+		}
+
+		OutSample.PacketNumber = 0;
+		OutSample.Timecode = 0;
+		OutSample.TrackPosition = 0.0f;
+		return true;
+	}
+
+	// encode and decode throughput, the round trip is checked by Technocrane.FreeD automation tests
+	void BenchmarkFreeD(const TArray<FString>& Args)
+	{
+		const int32 NumSamples = (Args.Num() > 0) ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 10000000) : 1000000;
+
+		NTechnocraneShared::SSample Sample;
+		FMemory::Memzero(Sample);
+		FCraneRawValues Raw;
+		const FLensEncoding Lens;
+
+		uint8 Data[Size];
+		NTechnocraneShared::SSample Decoded;
+		FCraneRawValues DecodedRaw;
+		uint8 CameraId = 0;
+
+		const double StartTime = FPlatformTime::Seconds();
+		uint32 Checksum = 0;
+
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			Sample.Location[0] = static_cast<float>(i & 0xFFFF);
+			Raw.Zoom = static_cast<float>(i & 0xFF);
+			Encode(Sample, Raw, Lens, 1, Data);
+			Decode(Data, Size, Lens, Decoded, DecodedRaw, CameraId);
+			Checksum += Data[Size - 1];
+		}
+
+		const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+		UE_LOG(LogTechnocrane, Display, TEXT("FreeD encode and decode of %d samples: %.2f ms, %.1f ns per sample (%u)"),
+			NumSamples, 1000.0 * ElapsedSeconds, 1e9 * ElapsedSeconds / NumSamples, Checksum);
+	}
+};
+
+static FAutoConsoleCommand GTechnocraneBenchmarkFreeDCmd(
+	TEXT("Technocrane.BenchmarkFreeD"),
+	TEXT("Measure FreeD D1 encode and decode throughput. Arguments: [Samples], a million by default."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&NTechnocraneFreeD::BenchmarkFreeD)
+);
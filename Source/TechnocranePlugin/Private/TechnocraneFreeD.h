@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneFreeD.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LiveLinkTechnocraneTypes.h"
+#include "TechnocraneSharedSamples.h"
+
+class UTechnocraneRuntimeSettings;
+
+/**
+ * FreeD D1 camera tracking message, 29 bytes, big endian 24 bit fields and a checksum.
+ *  Angles are degrees with 15 fractional bits, positions are mm with 6 fractional bits.
+ *  FreeD is right handed with Z up and the engine is left handed with Z up, fields are mapped by the axis tables below:
+ *  X is the engine Y (right), Y is the engine X (forward), Z is up, pan is the yaw clockwise from above,
+ *  tilt is the pitch up and roll is the roll clockwise looking along the lens.
+ *  Zoom and focus carry raw encoder counts by default, or a focal length in 1/1000 mm and a focus distance in mm,
+ *  the spare field is an aperture in 1/100 f-stop.
+ */
+namespace NTechnocraneFreeD
+{
+	constexpr uint8 MessageType = 0xD1;
+	constexpr int32 Size = 29;
+
+	constexpr int32 MinSigned24 = -(1 << 23);
+	constexpr int32 MaxSigned24 = (1 << 23) - 1;
+	constexpr int32 MaxUnsigned24 = (1 << 24) - 1;
+
+	constexpr float AngleScale = 32768.0f;
+	/** cm into mm with 6 fractional bits */
+	constexpr float PositionScale = 640.0f;
+	constexpr float FocalLengthScale = 1000.0f;
+	/** cm into mm */
+	constexpr float FocusDistanceScale = 10.0f;
+	constexpr float ApertureScale = 100.0f;
+
+	/** an engine location axis and a sign of the X, Y and Z fields */
+	constexpr int32 PositionAxes[3] = { 1, 0, 2 };
+	constexpr float PositionSigns[3] = { 1.0f, 1.0f, 1.0f };
+
+	/** an engine rotation component (pitch, yaw, roll) and a sign of the pan, tilt and roll fields */
+	constexpr int32 AngleAxes[3] = { 1, 0, 2 };
+	constexpr float AngleSigns[3] = { 1.0f, 1.0f, 1.0f };
+
+	/** how zoom and focus fields are filled */
+	struct FLensEncoding
+	{
+		/** a focal length and a focus distance instead of encoder counts */
+		bool bCalibrated{ false };
+		/** FreeD counts per unit of a raw crane encoder value */
+		float EncoderScale{ 1000.0f };
+	};
+
+	/** the lens encoding of runtime settings */
+	FLensEncoding MakeLensEncoding(const UTechnocraneRuntimeSettings& Settings);
+
+	void Write24(uint8* Data, const int32 Value);
+	int32 ReadSigned24(const uint8* Data);
+	int32 ReadUnsigned24(const uint8* Data);
+
+	uint8 ComputeChecksum(const uint8* Data);
+
+	/** values out of the field range are clamped, raw values are used for encoder counts only */
+	void Encode(const NTechnocraneShared::SSample& Sample, const FCraneRawValues& Raw, const FLensEncoding& Lens, const uint8 CameraId, uint8 (&OutData)[Size]);
+
+	/**
+	 * false for a message of another size or type, or with a wrong checksum. FreeD has no packet number and timecode.
+	 *  Encoder counts go to raw zoom and focus and leave a focal length and a focus distance for a lens calibration
+	 */
+	bool Decode(const uint8* Data, const int32 DataSize, const FLensEncoding& Lens, NTechnocraneShared::SSample& OutSample, FCraneRawValues& OutRaw, uint8& OutCameraId);
+};
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneLensProfile.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneLensProfile.h"
+#include "TechnocranePrivatePCH.h"
+#include <technocrane_hardware.h>
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TechnocraneLensProfile)
+
+namespace NTechnocraneLensProfile
+{
+	bool BuildTable(const TCHAR* ChannelName, const UObject* Owner, const TArray<FVector2D>& Points, const int32 TableSize, FCraneLensTable& Table)
+	{
+		if (Points.Num() == 0)
+		{
+			Table.Reset();
+			return false;
+		}
+
+		TArray<FVector2f> SinglePoints;
+		SinglePoints.Reserve(Points.Num());
+		for (const FVector2D& Point : Points)
+		{
+			SinglePoints.Emplace(Point);
+		}
+
+		if (!Table.Build(SinglePoints, TableSize))
+		{
+			UE_LOG(LogTechnocrane, Warning, TEXT("%s: %s calibration needs at least two points with monotonic values"), *GetNameSafe(Owner), ChannelName);
+			return false;
+		}
+		return true;
+	}
+
+	void EvaluateTable(const FCraneLensTable& Table, const TArray<float>& Encoders, TArray<float>& OutValues)
+	{
+		if (!Table.IsValid())
+		{
+			OutValues.SetNumZeroed(Encoders.Num());
+			return;
+		}
+
+		OutValues.SetNumUninitialized(Encoders.Num());
+		Table.Evaluate(Encoders, OutValues);
+	}
+};
+
+void UTechnocraneLensProfile::Build()
+{
+	NTechnocraneLensProfile::BuildTable(TEXT("Focal length"), this, FocalLengthPoints, TableSize, FocalLengthTable);
+	NTechnocraneLensProfile::BuildTable(TEXT("Focus distance"), this, FocusDistancePoints, TableSize, FocusDistanceTable);
+	NTechnocraneLensProfile::BuildTable(TEXT("T-stop"), this, TStopPoints, TableSize, TStopTable);
+
+	++Revision;
+}
+
+void UTechnocraneLensProfile::GetFocalLengths(const TArray<float>& Encoders, TArray<float>& OutFocalLengths) const
+{
+	NTechnocraneLensProfile::EvaluateTable(FocalLengthTable, Encoders, OutFocalLengths);
+}
+
+void UTechnocraneLensProfile::GetFocusDistances(const TArray<float>& Encoders, TArray<float>& OutFocusDistances) const
+{
+	NTechnocraneLensProfile::EvaluateTable(FocusDistanceTable, Encoders, OutFocusDistances);
+}
+
+void UTechnocraneLensProfile::GetTStops(const TArray<float>& Encoders, TArray<float>& OutTStops) const
+{
+	NTechnocraneLensProfile::EvaluateTable(TStopTable, Encoders, OutTStops);
+}
+
+bool UTechnocraneLensProfile::ComputeFocusDistance(const FCraneLensTable& FocusTable, const float Encoder, const FVector2D& Range, const float SpaceScale, float& OutFocusDistance)
+{
+	if (FocusTable.IsValid())
+	{
+		OutFocusDistance = FocusTable.Evaluate(Encoder);
+		return true;
+	}
+
+	float FocusDistance = 1.0f;
+	const bool bIsCalibrated = NTechnocrane::ComputeFocusf(FocusDistance, Encoder, Range.X, Range.Y);
+
+	OutFocusDistance = SpaceScale * FocusDistance;
+	return bIsCalibrated;
+}
+
+void UTechnocraneLensProfile::PostLoad()
+{
+	Super::PostLoad();
+
+	// tables are cheap to resample, only calibration points are saved
+	Build();
+}
+
+#if WITH_EDITOR
+void UTechnocraneLensProfile::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	Build();
+}
+#endif
@@ -0,0 +1,60 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneLiveLinkClient.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneLiveLinkClient.h"
+#include "Features/IModularFeatures.h"
+#include "ILiveLinkClient.h"
+
+std::atomic<ILiveLinkClient*> FTechnocraneLiveLinkClient::Client{ nullptr };
+FDelegateHandle FTechnocraneLiveLinkClient::RegisteredHandle;
+FDelegateHandle FTechnocraneLiveLinkClient::UnregisteredHandle;
+
+void FTechnocraneLiveLinkClient::Startup()
+{
+	IModularFeatures& ModularFeatures = IModularFeatures::Get();
+
+	RegisteredHandle = ModularFeatures.OnModularFeatureRegistered().AddStatic(&FTechnocraneLiveLinkClient::OnModularFeatureRegistered);
+	UnregisteredHandle = ModularFeatures.OnModularFeatureUnregistered().AddStatic(&FTechnocraneLiveLinkClient::OnModularFeatureUnregistered);
+
+	if (ModularFeatures.IsModularFeatureAvailable(ILiveLinkClient::ModularFeatureName))
+	{
+		Client.store(&ModularFeatures.GetModularFeature<ILiveLinkClient>(ILiveLinkClient::ModularFeatureName), std::memory_order_release);
+	}
+}
+
+void FTechnocraneLiveLinkClient::Shutdown()
+{
+	if (IModularFeatures::IsAvailable())
+	{
+		IModularFeatures& ModularFeatures = IModularFeatures::Get();
+
+		ModularFeatures.OnModularFeatureRegistered().Remove(RegisteredHandle);
+		ModularFeatures.OnModularFeatureUnregistered().Remove(UnregisteredHandle);
+	}
+
+	RegisteredHandle.Reset();
+	UnregisteredHandle.Reset();
+
+	Client.store(nullptr, std::memory_order_release);
+}
+
+void FTechnocraneLiveLinkClient::OnModularFeatureRegistered(const FName& Type, IModularFeature* ModularFeature)
+{
+	if (Type == ILiveLinkClient::ModularFeatureName)
+	{
+		Client.store(static_cast<ILiveLinkClient*>(ModularFeature), std::memory_order_release);
+	}
+}
+
+void FTechnocraneLiveLinkClient::OnModularFeatureUnregistered(const FName& Type, IModularFeature* ModularFeature)
+{
+	if (Type == ILiveLinkClient::ModularFeatureName)
+	{
+		ILiveLinkClient* Expected = static_cast<ILiveLinkClient*>(ModularFeature);
+		Client.compare_exchange_strong(Expected, nullptr, std::memory_order_acq_rel);
+	}
+}
@@ -0,0 +1,38 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneLiveLinkClient.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// forward
+class ILiveLinkClient;
+class IModularFeature;
+
+/**
+ * LiveLink client resolved once at module startup instead of a modular feature lookup every frame,
+ *  the pointer is updated when LiveLink client gets registered or unregistered
+ */
+class FTechnocraneLiveLinkClient
+{
+public:
+	static void Startup();
+	static void Shutdown();
+
+	/** safe to call from any thread, could be nullptr when LiveLink is not loaded */
+	static ILiveLinkClient* Get() { return Client.load(std::memory_order_acquire); }
+
+private:
+	static void OnModularFeatureRegistered(const FName& Type, IModularFeature* ModularFeature);
+	static void OnModularFeatureUnregistered(const FName& Type, IModularFeature* ModularFeature);
+
+	static std::atomic<ILiveLinkClient*> Client;
+
+	static FDelegateHandle RegisteredHandle;
+	static FDelegateHandle UnregisteredHandle;
+};
@@ -10,6 +10,8 @@
 #include "Modules/ModuleManager.h"
 #include "ITechnocranePlugin.h"
 #include "technocrane_hardware.h"
+#include "TechnocraneLiveLinkClient.h"
+#include "TechnocranePresetRegistry.h"
 
 #include "Interfaces/IPluginManager.h"
 
@@ -24,6 +26,9 @@ private:
 	/** Handle to the delay-loaded library. */
 	void* TechnocraneLibHandle;
 
+	/** modules built on optional engine plugins are not loaded by the plugin descriptor, only when their plugin is enabled */
+	void LoadOptionalModules();
+
 };
 
 IMPLEMENT_MODULE(FTechnocranePlugin, TechnocranePlugin )
@@ -49,6 +54,9 @@ void FTechnocranePlugin::StartupModule()
 	// This code will execute after your module is loaded into memory (but after global variables are initialized, of course.)
 	check(TechnocraneLibHandle == nullptr);
 
+	FTechnocraneLiveLinkClient::Startup();
+	LoadOptionalModules();
+
 	// Note: These paths correspond to the RuntimeDependency specified in the .Build.cs script.
 	const FString PluginBaseDir = IPluginManager::Get().FindPlugin("TechnocranePlugin")->GetBaseDir();
 	const FString TechnocraneDll = TEXT("TechnocraneLib.dll");
@@ -84,11 +92,39 @@ void FTechnocranePlugin::StartupModule()
 }
 
 
+void FTechnocranePlugin::LoadOptionalModules()
+{
+	// an engine plugin and a module that depends on it
+	static const TCHAR* OptionalModules[][2] =
+	{
+		{ TEXT("ControlRig"), TEXT("TechnocraneControlRig") },
+		{ TEXT("nDisplay"), TEXT("TechnocraneDisplayCluster") }
+	};
+
+	for (const auto& OptionalModule : OptionalModules)
+	{
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(OptionalModule[0]);
+		if (!Plugin.IsValid() || !Plugin->IsEnabled())
+		{
+			UE_LOG(LogTechnocrane, Log, TEXT("%s plugin is not enabled, %s module is not loaded"), OptionalModule[0], OptionalModule[1]);
+			continue;
+		}
+
+		if (!FModuleManager::Get().LoadModule(OptionalModule[1]))
+		{
+			UE_LOG(LogTechnocrane, Warning, TEXT("Failed to load %s module"), OptionalModule[1]);
+		}
+	}
+}
+
 void FTechnocranePlugin::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
 
+	FTechnocraneLiveLinkClient::Shutdown();
+	FTechnocranePresetRegistry::Get().Shutdown();
+
 	// Unload the DLL.
 	if (nullptr != TechnocraneLibHandle)
 	{
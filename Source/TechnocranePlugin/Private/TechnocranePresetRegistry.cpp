@@ -0,0 +1,421 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocranePresetRegistry.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocranePresetRegistry.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneRig.h"
+#include "TechnocraneRigKinematics.h"
+#include "Engine/DataTable.h"
+#include "Engine/SkeletalMesh.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace NTechnocranePresetRegistry
+{
+	// baked geometry is tagged with the crane model and the column rotation bone it's derived from
+	FCraneRigGeometryPtr ReadBakedGeometry(const FCraneData& Data)
+	{
+		if (Data.BakedRigGeometry.Num() == 0)
+		{
+			return nullptr;
+		}
+
+		FMemoryReader Reader(Data.BakedRigGeometry);
+
+		FString ModelPath;
+		FName ColumnRotationBone;
+		Reader << ModelPath;
+		Reader << ColumnRotationBone;
+
+		if (Reader.IsError() || ModelPath != Data.GetCraneModelPath().ToString() || ColumnRotationBone != Data.ColumnRotationBone)
+		{
+			return nullptr;
+		}
+
+		TSharedPtr<FCraneRigGeometry, ESPMode::ThreadSafe> Geometry = MakeShared<FCraneRigGeometry, ESPMode::ThreadSafe>();
+		Reader << *Geometry;
+
+		return (!Reader.IsError() && Geometry->IsValid()) ? Geometry : nullptr;
+	}
+
+	void WriteBakedGeometry(const FCraneRigGeometry& Geometry, FCraneData& Data)
+	{
+		Data.BakedRigGeometry.Reset();
+		FMemoryWriter Writer(Data.BakedRigGeometry);
+
+		FString ModelPath = Data.GetCraneModelPath().ToString();
+		FName ColumnRotationBone = Data.ColumnRotationBone;
+		FCraneRigGeometry GeometryCopy = Geometry;
+
+		Writer << ModelPath;
+		Writer << ColumnRotationBone;
+		Writer << GeometryCopy;
+	}
+};
+
+FTechnocranePresetRegistry& FTechnocranePresetRegistry::Get()
+{
+	static FTechnocranePresetRegistry Registry;
+	return Registry;
+}
+
+bool FTechnocranePresetRegistry::Initialize(const UDataTable* InCranesData)
+{
+	if (bInitialized)
+	{
+		return true;
+	}
+
+	check(IsInGameThread());
+
+	const UDataTable* CranesData = (InCranesData) ? InCranesData : LoadObject<UDataTable>(nullptr, TEXT("/TechnocranePlugin/CranesData"));
+	if (!CranesData)
+	{
+		UE_LOG(LogTechnocrane, Warning, TEXT("Failed to load crane presets data"));
+		return false;
+	}
+
+	UpdateEntries(*CranesData);
+
+#if WITH_EDITOR
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FTechnocranePresetRegistry::OnObjectPropertyChanged);
+
+	CranesDataTable = const_cast<UDataTable*>(CranesData);
+	DataTableChangedHandle = CranesDataTable->OnDataTableChanged().AddRaw(this, &FTechnocranePresetRegistry::OnDataTableChanged);
+#endif
+
+	bInitialized = true;
+	return true;
+}
+
+void FTechnocranePresetRegistry::UpdateEntries(const UDataTable& CranesData)
+{
+	const int32 NumModels = static_cast<int32>(ECranePreviewModelsEnum::ECranePreview_Count);
+
+	// entries are compiled aside, other threads read the previous ones meanwhile
+	TArray<FCranePresetEntryPtr> NewEntries;
+	NewEntries.SetNum(NumModels);
+
+	TArray<int32> ChangedModels;
+
+	for (int32 i = 0; i < NumModels; ++i)
+	{
+		const FName RowName = FTechnocraneRigKinematics::GetPresetRowName(i);
+		const FCraneData* Data = CranesData.FindRow<FCraneData>(RowName, "", false);
+		const FCranePresetEntryPtr PrevEntry = Find(i);
+
+		if (!Data && PrevEntry.IsValid())
+		{
+			UE_LOG(LogTechnocrane, Warning, TEXT("Crane preset %s is removed, rigs keep its last values"), *RowName.ToString());
+			NewEntries[i] = PrevEntry;
+			continue;
+		}
+		else if (!Data)
+		{
+			UE_LOG(LogTechnocrane, Warning, TEXT("Crane preset %s is missing"), *RowName.ToString());
+			continue;
+		}
+
+		TSharedPtr<FCranePresetEntry, ESPMode::ThreadSafe> Entry = MakeShared<FCranePresetEntry, ESPMode::ThreadSafe>();
+		Entry->RowName = RowName;
+		Entry->Data = *Data;
+		Entry->Preset = FTechnocraneRigKinematics::MakePreset(*Data);
+		Entry->ModelPath = Data->GetCraneModelPath();
+		Entry->BakedGeometry = NTechnocranePresetRegistry::ReadBakedGeometry(*Data);
+
+		// geometry of the model depends on the mesh and on the column rotation bone
+		if (!PrevEntry.IsValid() || PrevEntry->ModelPath != Entry->ModelPath || PrevEntry->Data.ColumnRotationBone != Data->ColumnRotationBone)
+		{
+			ChangedModels.Add(i);
+		}
+
+		NewEntries[i] = Entry;
+	}
+
+	FScopeLock Lock(&GeometryLock);
+	Swap(Entries, NewEntries);
+
+	for (const int32 ModelIndex : ChangedModels)
+	{
+		ModelGeometries.Remove(ModelIndex);
+	}
+}
+
+void FTechnocranePresetRegistry::SetEntry(const int32 CraneModel, FCranePresetEntryPtr Entry)
+{
+	FScopeLock Lock(&GeometryLock);
+	if (Entries.IsValidIndex(CraneModel))
+	{
+		Entries[CraneModel] = MoveTemp(Entry);
+	}
+}
+
+void FTechnocranePresetRegistry::Shutdown()
+{
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	ObjectPropertyChangedHandle.Reset();
+
+	if (UDataTable* CranesData = CranesDataTable.Get())
+	{
+		CranesData->OnDataTableChanged().Remove(DataTableChangedHandle);
+	}
+	CranesDataTable.Reset();
+	DataTableChangedHandle.Reset();
+#endif
+
+	ResetGeometry();
+	{
+		FScopeLock Lock(&GeometryLock);
+		Entries.Reset();
+	}
+	bInitialized = false;
+}
+
+#if WITH_EDITOR
+void FTechnocranePresetRegistry::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// an interactive edit is followed by a final one
+	const USkeletalMesh* Mesh = Cast<USkeletalMesh>(Object);
+	if (!Mesh || PropertyChangedEvent.ChangeType == EPropertyChangeType::Interactive)
+	{
+		return;
+	}
+
+	const FSoftObjectPath MeshPath(Mesh);
+	TArray<TTuple<int32, FCranePresetEntryPtr>> ChangedEntries;
+	{
+		FScopeLock Lock(&GeometryLock);
+
+		for (auto It = Geometries.CreateIterator(); It; ++It)
+		{
+			if (It.Key().Key == Mesh)
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		for (int32 i = 0; i < Entries.Num(); ++i)
+		{
+			if (Entries[i].IsValid() && Entries[i]->ModelPath == MeshPath)
+			{
+				ModelGeometries.Remove(i);
+				ChangedEntries.Emplace(i, Entries[i]);
+			}
+		}
+	}
+
+	// geometry stored with presets of the crane model could be out of date, the table is dirtied only when it differs
+	for (const TTuple<int32, FCranePresetEntryPtr>& Changed : ChangedEntries)
+	{
+		const int32 ModelIndex = Changed.Key;
+		const FCranePresetEntryPtr& Entry = Changed.Value;
+		const FCraneRigGeometryPtr Geometry = FindOrBuildGeometry(Mesh, Entry->Data.ColumnRotationBone);
+
+		if (Geometry.IsValid() && Geometry->IsValid())
+		{
+			BakeGeometry(ModelIndex, *Geometry);
+		}
+		else if (Entry->BakedGeometry.IsValid())
+		{
+			TSharedPtr<FCranePresetEntry, ESPMode::ThreadSafe> NewEntry = MakeShared<FCranePresetEntry, ESPMode::ThreadSafe>(*Entry);
+			NewEntry->BakedGeometry = nullptr;
+			SetEntry(ModelIndex, NewEntry);
+		}
+	}
+}
+
+void FTechnocranePresetRegistry::BakeGeometry(const int32 CraneModel, const FCraneRigGeometry& Geometry)
+{
+	UDataTable* CranesData = CranesDataTable.Get();
+	const FCranePresetEntryPtr Entry = Find(CraneModel);
+	FCraneData* Data = (CranesData && Entry) ? CranesData->FindRow<FCraneData>(Entry->RowName, "", false) : nullptr;
+
+	if (!Data || !Geometry.IsValid())
+	{
+		return;
+	}
+
+	TSharedPtr<FCranePresetEntry, ESPMode::ThreadSafe> NewEntry = MakeShared<FCranePresetEntry, ESPMode::ThreadSafe>(*Entry);
+	NTechnocranePresetRegistry::WriteBakedGeometry(Geometry, NewEntry->Data);
+
+	// the same geometry is stored already
+	if (NewEntry->Data.BakedRigGeometry == Data->BakedRigGeometry && Entry->BakedGeometry.IsValid())
+	{
+		return;
+	}
+
+	Data->BakedRigGeometry = NewEntry->Data.BakedRigGeometry;
+	NewEntry->BakedGeometry = NTechnocranePresetRegistry::ReadBakedGeometry(NewEntry->Data);
+	SetEntry(CraneModel, NewEntry);
+
+	CranesData->MarkPackageDirty();
+	UE_LOG(LogTechnocrane, Log, TEXT("Crane geometry of preset %s is stored in %s, save the table to keep it"), *Entry->RowName.ToString(), *CranesData->GetName());
+}
+
+int32 FTechnocranePresetRegistry::BakeGeometry()
+{
+	if (!Initialize())
+	{
+		return 0;
+	}
+
+	int32 NumBaked = 0;
+	for (int32 i = 0; i < Num(); ++i)
+	{
+		const FCranePresetEntryPtr Entry = Find(i);
+		const USkeletalMesh* Mesh = (Entry) ? Cast<USkeletalMesh>(Entry->ModelPath.TryLoad()) : nullptr;
+		const FCraneRigGeometryPtr Geometry = (Mesh) ? FindOrBuildGeometry(Mesh, Entry->Data.ColumnRotationBone) : nullptr;
+
+		if (Geometry.IsValid() && Geometry->IsValid())
+		{
+			BakeGeometry(i, *Geometry);
+
+			const FCranePresetEntryPtr BakedEntry = Find(i);
+			NumBaked += (BakedEntry && BakedEntry->BakedGeometry.IsValid()) ? 1 : 0;
+		}
+	}
+	return NumBaked;
+}
+
+static FAutoConsoleCommand GTechnocraneBakePresetGeometryCmd(
+	TEXT("Technocrane.BakePresetGeometry"),
+	TEXT("Derive crane geometry of every crane model and store it in the crane presets data table, so simulations don't load crane models."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		const int32 NumBaked = FTechnocranePresetRegistry::Get().BakeGeometry();
+		UE_LOG(LogTechnocrane, Display, TEXT("Technocrane stored crane geometry of %d presets"), NumBaked);
+	})
+);
+
+void FTechnocranePresetRegistry::OnDataTableChanged()
+{
+	if (const UDataTable* CranesData = CranesDataTable.Get())
+	{
+		UpdateEntries(*CranesData);
+	}
+}
+#endif
+
+int32 FTechnocranePresetRegistry::Num() const
+{
+	FScopeLock Lock(&GeometryLock);
+	return Entries.Num();
+}
+
+FCranePresetEntryPtr FTechnocranePresetRegistry::Find(const ECranePreviewModelsEnum CraneModel) const
+{
+	return Find(static_cast<int32>(CraneModel));
+}
+
+FCranePresetEntryPtr FTechnocranePresetRegistry::Find(const int32 CraneModel) const
+{
+	FScopeLock Lock(&GeometryLock);
+	return Entries.IsValidIndex(CraneModel) ? Entries[CraneModel] : nullptr;
+}
+
+FCranePresetEntryPtr FTechnocranePresetRegistry::FindByRowName(const FName& RowName) const
+{
+	FScopeLock Lock(&GeometryLock);
+	for (const FCranePresetEntryPtr& Entry : Entries)
+	{
+		if (Entry.IsValid() && Entry->RowName == RowName)
+		{
+			return Entry;
+		}
+	}
+	return nullptr;
+}
+
+FCraneRigGeometryPtr FTechnocranePresetRegistry::FindOrBuildGeometry(const USkeletalMesh* Mesh, const FName& ColumnRotationBone)
+{
+	if (!Mesh)
+	{
+		return nullptr;
+	}
+
+	const TTuple<TObjectKey<USkeletalMesh>, FName> Key(Mesh, ColumnRotationBone);
+
+	FScopeLock Lock(&GeometryLock);
+
+	if (const FCraneRigGeometryPtr* Geometry = Geometries.Find(Key))
+	{
+		return *Geometry;
+	}
+
+	TSharedPtr<FCraneRigGeometry, ESPMode::ThreadSafe> Geometry = MakeShared<FCraneRigGeometry, ESPMode::ThreadSafe>();
+
+	if (!FTechnocraneRigKinematics::BuildGeometry(*Geometry, Mesh->GetRefSkeleton(), ColumnRotationBone))
+	{
+		UE_LOG(LogTechnocrane, Warning, TEXT("Crane model %s is missing required crane joints"), *Mesh->GetName());
+	}
+
+	// invalid geometry is cached as well, there is no need to look for joints again
+	Geometries.Add(Key, Geometry);
+	return Geometry;
+}
+
+FCraneRigGeometryPtr FTechnocranePresetRegistry::LoadGeometry(const ECranePreviewModelsEnum CraneModel)
+{
+	return LoadGeometry(static_cast<int32>(CraneModel));
+}
+
+FCraneRigGeometryPtr FTechnocranePresetRegistry::LoadGeometry(const int32 ModelIndex)
+{
+	check(IsInGameThread());
+	{
+		FScopeLock Lock(&GeometryLock);
+		if (const FCraneRigGeometryPtr* Geometry = ModelGeometries.Find(ModelIndex))
+		{
+			return *Geometry;
+		}
+	}
+
+	const FCranePresetEntryPtr Entry = (Initialize()) ? Find(ModelIndex) : nullptr;
+	if (!Entry)
+	{
+		return nullptr;
+	}
+
+	// the preset has its geometry, there is no need to load the crane model
+	if (Entry->BakedGeometry.IsValid())
+	{
+		FScopeLock Lock(&GeometryLock);
+		ModelGeometries.Add(ModelIndex, Entry->BakedGeometry);
+		return Entry->BakedGeometry;
+	}
+
+	UE_LOG(LogTechnocrane, Warning, TEXT("Crane preset %d has no stored geometry, loading its crane model, run Technocrane.BakePresetGeometry in the editor"), ModelIndex + 1);
+
+	const USkeletalMesh* Mesh = Cast<USkeletalMesh>(Entry->ModelPath.TryLoad());
+	if (!Mesh)
+	{
+		UE_LOG(LogTechnocrane, Warning, TEXT("Failed to load a crane model for preset %d"), ModelIndex + 1);
+		return nullptr;
+	}
+
+	FCraneRigGeometryPtr Geometry = FindOrBuildGeometry(Mesh, Entry->Data.ColumnRotationBone);
+
+#if WITH_EDITOR
+	if (Geometry.IsValid() && Geometry->IsValid())
+	{
+		BakeGeometry(ModelIndex, *Geometry);
+	}
+#endif
+
+	FScopeLock Lock(&GeometryLock);
+	ModelGeometries.Add(ModelIndex, Geometry);
+	return Geometry;
+}
+
+void FTechnocranePresetRegistry::ResetGeometry()
+{
+	FScopeLock Lock(&GeometryLock);
+	Geometries.Reset();
+	ModelGeometries.Reset();
+}
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneReachabilityField.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneReachabilityField.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneRigKinematics.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TechnocraneReachabilityField)
+
+bool UTechnocraneReachabilityField::Build()
+{
+	Field.Reset();
+	MinExtension = MaxExtension = 0.0f;
+
+	FCraneData Data;
+	FCraneRigGeometry Geometry;
+
+	if (!FTechnocraneRigKinematics::LoadPreset(FTechnocraneRigKinematics::GetPresetRowName(static_cast<int32>(CraneModel)), Data, Geometry))
+	{
+		return false;
+	}
+
+	BuildFrom(Geometry, FTechnocraneRigKinematics::MakePreset(Data));
+
+	UE_LOG(LogTechnocrane, Log, TEXT("Reachability field for %s, %d x %d cells"), *Data.Name, Field.NumRadial, Field.NumHeight);
+
+	MarkPackageDirty();
+	return Field.IsValid();
+}
+
+void UTechnocraneReachabilityField::BuildFrom(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset)
+{
+	Field.Build(Geometry, Preset, CellSize);
+	MinExtension = Geometry.MinExtension;
+	MaxExtension = Geometry.MaxExtension;
+}
+
+bool UTechnocraneReachabilityField::IsBuiltFor(const ECranePreviewModelsEnum InCraneModel, const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset) const
+{
+	return CraneModel == InCraneModel && Field.CellSize == CellSize && Field.IsBuiltFor(Geometry, Preset);
+}
+
+UTechnocraneReachabilityField* UTechnocraneReachabilityField::ResolveFor(UTechnocraneReachabilityField* InField, UObject* Outer, const ECranePreviewModelsEnum InCraneModel,
+	const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, UTechnocraneReachabilityField* Previous)
+{
+	if (!InField || !Geometry.IsValid())
+	{
+		return nullptr;
+	}
+
+	if (InField->CraneModel == InCraneModel)
+	{
+		// loaded from an older layout or computed before the preset data changed
+		if (!InField->IsBuiltFor(InCraneModel, Geometry, Preset))
+		{
+			UE_LOG(LogTechnocrane, Warning, TEXT("Reachability field %s is out of date, rebuilding it"), *InField->GetName());
+
+			InField->BuildFrom(Geometry, Preset);
+			InField->MarkPackageDirty();
+		}
+		return InField;
+	}
+
+	// margins of another crane are wrong for the rig, the asset is left as it is
+	if (Previous && Previous != InField && Previous->CellSize == InField->CellSize && Previous->IsBuiltFor(InCraneModel, Geometry, Preset))
+	{
+		return Previous;
+	}
+
+	UE_LOG(LogTechnocrane, Warning, TEXT("Reachability field %s is computed for another crane model, building a transient field for the rig"), *InField->GetName());
+
+	UTechnocraneReachabilityField* Resolved = NewObject<UTechnocraneReachabilityField>(Outer, NAME_None, RF_Transient);
+	Resolved->CraneModel = InCraneModel;
+	Resolved->CellSize = InField->CellSize;
+	Resolved->BuildFrom(Geometry, Preset);
+
+	return Resolved;
+}
+
+float UTechnocraneReachabilityField::GetReachMargin(const FVector& LocalPosition, float TrackPosition) const
+{
+	return Field.GetMargin(LocalPosition, TrackPosition);
+}
+
+bool UTechnocraneReachabilityField::IsReachable(const FVector& LocalPosition, float TrackPosition, float MinMargin) const
+{
+	return Field.IsValid() && Field.GetMargin(LocalPosition, TrackPosition) >= MinMargin;
+}
+
+void UTechnocraneReachabilityField::GetReachMargins(const TArray<FVector>& LocalPositions, float TrackPosition, TArray<float>& OutMargins) const
+{
+	OutMargins.SetNumUninitialized(LocalPositions.Num());
+	Field.GetMargins(LocalPositions, TrackPosition, OutMargins);
+}
+
+void UTechnocraneReachabilityField::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	Ar << Field;
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneReceptionHealth.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneReceptionHealth.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneStats.h"
+
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TechnocraneReceptionHealth)
+
+// totals over all sources, they keep the value between frames
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Technocrane Connected Sources"), STAT_TechnocraneConnectedSources, STATGROUP_Technocrane);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Technocrane Complete Packets"), STAT_TechnocraneCompletePackets, STATGROUP_Technocrane);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Technocrane Checksum Errors"), STAT_TechnocraneCheckSumErrors, STATGROUP_Technocrane);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Technocrane Missed Syncs"), STAT_TechnocraneMissedSyncs, STATGROUP_Technocrane);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Technocrane Bytes Read (KB)"), STAT_TechnocraneKBytesRead, STATGROUP_Technocrane);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Technocrane Packet Queue Depth"), STAT_TechnocraneQueueDepth, STATGROUP_Technocrane);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Technocrane Packet Rate (Hz)"), STAT_TechnocranePacketRate, STATGROUP_Technocrane);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Technocrane Error Rate (Hz)"), STAT_TechnocraneErrorRate, STATGROUP_Technocrane);
+
+TRACE_DECLARE_INT_COUNTER(TechnocraneCompletePackets, TEXT("Technocrane/CompletePackets"));
+TRACE_DECLARE_INT_COUNTER(TechnocraneCheckSumErrors, TEXT("Technocrane/CheckSumErrors"));
+TRACE_DECLARE_INT_COUNTER(TechnocraneMissedSyncs, TEXT("Technocrane/MissedSyncs"));
+TRACE_DECLARE_INT_COUNTER(TechnocraneQueueDepth, TEXT("Technocrane/QueueDepth"));
+TRACE_DECLARE_FLOAT_COUNTER(TechnocranePacketRate, TEXT("Technocrane/PacketRate"));
+TRACE_DECLARE_FLOAT_COUNTER(TechnocraneErrorRate, TEXT("Technocrane/ErrorRate"));
+
+namespace NTechnocraneReceptionHealth
+{
+	FCriticalSection Lock;
+	TArray<FCraneReceptionHealth> Sources;
+
+	// called under the lock
+	void UpdateCounters()
+	{
+		FCraneReceptionHealth Total;
+		int32 NumConnected = 0;
+
+		for (const FCraneReceptionHealth& Health : Sources)
+		{
+			NumConnected += (Health.bConnected) ? 1 : 0;
+			Total.TotalBytesRead += Health.TotalBytesRead;
+			Total.CompletePackets += Health.CompletePackets;
+			Total.CheckSumErrors += Health.CheckSumErrors;
+			Total.MissedSyncs += Health.MissedSyncs;
+			Total.PacketRate += Health.PacketRate;
+			Total.ErrorRate += Health.ErrorRate;
+			Total.QueueDepth += Health.QueueDepth;
+		}
+
+		SET_DWORD_STAT(STAT_TechnocraneConnectedSources, NumConnected);
+		SET_DWORD_STAT(STAT_TechnocraneCompletePackets, Total.CompletePackets);
+		SET_DWORD_STAT(STAT_TechnocraneCheckSumErrors, Total.CheckSumErrors);
+		SET_DWORD_STAT(STAT_TechnocraneMissedSyncs, Total.MissedSyncs);
+		SET_DWORD_STAT(STAT_TechnocraneKBytesRead, Total.TotalBytesRead / 1024);
+		SET_DWORD_STAT(STAT_TechnocraneQueueDepth, Total.QueueDepth);
+		SET_FLOAT_STAT(STAT_TechnocranePacketRate, Total.PacketRate);
+		SET_FLOAT_STAT(STAT_TechnocraneErrorRate, Total.ErrorRate);
+
+		TRACE_COUNTER_SET(TechnocraneCompletePackets, Total.CompletePackets);
+		TRACE_COUNTER_SET(TechnocraneCheckSumErrors, Total.CheckSumErrors);
+		TRACE_COUNTER_SET(TechnocraneMissedSyncs, Total.MissedSyncs);
+		TRACE_COUNTER_SET(TechnocraneQueueDepth, Total.QueueDepth);
+		TRACE_COUNTER_SET(TechnocranePacketRate, Total.PacketRate);
+		TRACE_COUNTER_SET(TechnocraneErrorRate, Total.ErrorRate);
+	}
+};
+
+void FTechnocraneReceptionStats::Update(const FCraneReceptionHealth& Health)
+{
+	using namespace NTechnocraneReceptionHealth;
+	FScopeLock ScopeLock(&Lock);
+
+	FCraneReceptionHealth* Entry = Sources.FindByPredicate([&Health](const FCraneReceptionHealth& Item) { return Item.SourceId == Health.SourceId; });
+	if (Entry)
+	{
+		*Entry = Health;
+	}
+	else
+	{
+		Sources.Add(Health);
+	}
+
+	UpdateCounters();
+}
+
+void FTechnocraneReceptionStats::Remove(const FString& SourceId)
+{
+	using namespace NTechnocraneReceptionHealth;
+	FScopeLock ScopeLock(&Lock);
+
+	Sources.RemoveAll([&SourceId](const FCraneReceptionHealth& Item) { return Item.SourceId == SourceId; });
+	UpdateCounters();
+}
+
+TArray<FCraneReceptionHealth> FTechnocraneReceptionStats::GetAll()
+{
+	using namespace NTechnocraneReceptionHealth;
+	FScopeLock ScopeLock(&Lock);
+
+	return Sources;
+}
+
+bool FTechnocraneReceptionStats::Find(const FString& SourceId, FCraneReceptionHealth& OutHealth)
+{
+	using namespace NTechnocraneReceptionHealth;
+	FScopeLock ScopeLock(&Lock);
+
+	const FCraneReceptionHealth* Entry = Sources.FindByPredicate([&SourceId](const FCraneReceptionHealth& Item) { return Item.SourceId == SourceId; });
+	if (!Entry)
+	{
+		return false;
+	}
+
+	OutHealth = *Entry;
+	return true;
+}
+
+TArray<FCraneReceptionHealth> UTechnocraneReceptionLibrary::GetReceptionHealth()
+{
+	return FTechnocraneReceptionStats::GetAll();
+}
+
+bool UTechnocraneReceptionLibrary::FindReceptionHealth(const FString& SourceId, FCraneReceptionHealth& OutHealth)
+{
+	return FTechnocraneReceptionStats::Find(SourceId, OutHealth);
+}
@@ -10,8 +10,11 @@
 #include <UObject/ConstructorHelpers.h>
 #include <Components/SkeletalMeshComponent.h>
 #include <Components/PoseableMeshComponent.h>
+#include <Components/InstancedStaticMeshComponent.h>
 #include <Engine/SkeletalMesh.h>
 #include "Engine/CollisionProfile.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "DrawDebugHelpers.h"
 
 #include <Runtime/CinematicCamera/Public/CineCameraActor.h>
@@ -23,6 +26,61 @@
 #include <TechnocraneCamera.h>
 #include <TechnocraneCameraComponent.h>
 #include <TechnocraneRigAnimInstance.h>
+#include "TechnocraneReachabilityField.h"
+#include "TechnocraneRigKinematics.h"
+#include "TechnocranePresetRegistry.h"
+#include "TechnocraneRigPoseCache.h"
+#include "TechnocraneClearanceQuery.h"
+#include "TechnocraneStats.h"
+#include "MovieSceneSignedObject.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "WorldCollision.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Technocrane Rigs Full Rate"), STAT_TechnocraneRigsFullRate, STATGROUP_Technocrane);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Technocrane Rigs Reduced Rate"), STAT_TechnocraneRigsReducedRate, STATGROUP_Technocrane);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Technocrane Rigs Simulation Only"), STAT_TechnocraneRigsSimulationOnly, STATGROUP_Technocrane);
+DECLARE_CYCLE_STAT(TEXT("Technocrane Rig Simulation Only"), STAT_TechnocraneRigSimulationOnly, STATGROUP_Technocrane);
+DECLARE_CYCLE_STAT(TEXT("Technocrane Rig Clearance"), STAT_TechnocraneRigClearance, STATGROUP_Technocrane);
+DECLARE_CYCLE_STAT(TEXT("Technocrane Pose Cache Clearance"), STAT_TechnocranePoseCacheClearance, STATGROUP_Technocrane);
+
+namespace NTechnocraneRig
+{
+	// how often the rig looks at its visibility and distance to views
+	constexpr float SignificanceInterval{ 0.1f };
+	// the longest run of tracks, the same as the amount of tracks limit
+	constexpr int32 MaxTrackSegments{ 200 };
+
+	void AdjustTierStat(const ECraneRigUpdateTier Tier, const int32 Delta)
+	{
+		switch (Tier)
+		{
+		case ECraneRigUpdateTier::FullRate: INC_DWORD_STAT_BY(STAT_TechnocraneRigsFullRate, Delta); break;
+		case ECraneRigUpdateTier::ReducedRate: INC_DWORD_STAT_BY(STAT_TechnocraneRigsReducedRate, Delta); break;
+		case ECraneRigUpdateTier::SimulationOnly: INC_DWORD_STAT_BY(STAT_TechnocraneRigsSimulationOnly, Delta); break;
+		}
+	}
+
+	using FClearanceCapsules = FCraneClearanceQuery::FCapsules;
+
+	FCraneClearanceRadii MakeClearanceRadii(const ATechnocraneRig& Rig)
+	{
+		FCraneClearanceRadii Radii;
+		Radii.Column = Rig.ColumnClearanceRadius;
+		Radii.Beam = Rig.BeamClearanceRadius;
+		Radii.Head = Rig.HeadClearanceRadius;
+		return Radii;
+	}
+
+	void TransformCapsules(const FTransform& ComponentTransform, FClearanceCapsules& InOutCapsules)
+	{
+		for (FCraneClearanceCapsule& Capsule : InOutCapsules)
+		{
+			Capsule.Start = ComponentTransform.TransformPosition(Capsule.Start);
+			Capsule.End = ComponentTransform.TransformPosition(Capsule.End);
+		}
+	}
+};
 
 #define LOCTEXT_NAMESPACE "TechnocraneCamera"
 
@@ -38,16 +96,76 @@ public:
 	{}
 
 	USkeletalMeshComponent* MeshComponent{ nullptr };
-	FCraneData* CraneData{ nullptr };
+	FCranePresetEntryPtr Preset;
+
+	// crane geometry of the preview mesh, to solve simulation data without a pose
+	FCraneRigGeometryPtr Geometry;
+	// the rig is counted in update tier stats
+	bool bCountedInTierStats{ false };
+
+	// a crane model that is loading or loaded by the handle
+	ECranePreviewModelsEnum RequestedModel{ ECranePreviewModelsEnum::ECranePreview_Count };
+	TSharedPtr<FStreamableHandle> PreviewMeshHandle;
+	double RequestTime{ 0.0 };
+	// the first request and whether a model has been shown since, to log the time to the first rig
+	double FirstRequestTime{ 0.0 };
+	bool bFirstModelApplied{ false };
+
+	// baked crane poses of a shot and what they were baked for
+	FCraneRigPoseCachePtr PoseCache;
+	ECranePreviewModelsEnum PoseCacheModel{ ECranePreviewModelsEnum::ECranePreview_Count };
+	FVector PoseCachePivotOffset{ FVector::ZeroVector };
+	FTransform PoseCacheRigTransform{ FTransform::Identity };
+	TWeakObjectPtr<const UMovieSceneSignedObject> PoseCacheSource;
+	FGuid PoseCacheSignature;
+	TWeakObjectPtr<const UMovieSceneSignedObject> PoseCacheTrackPositionSource;
+	FGuid PoseCacheTrackPositionSignature;
+
+	// async overlaps issued last frame around world space crane parts
+	FCraneClearanceQuery ClearanceQuery;
+
+	// the latest collected clearance, merged into the simulation data
+	float MinClearance{ 0.0f };
+	bool bClearanceCollision{ false };
+	FName CollisionJoint;
+	FName CollisionActor;
+
+	void ResetClearance()
+	{
+		ClearanceQuery.Reset();
+		MinClearance = 0.0f;
+		bClearanceCollision = false;
+		CollisionJoint = NAME_None;
+		CollisionActor = NAME_None;
+	}
 	
 	void SetPoseableMeshComponent(USkeletalMeshComponent* component)
 	{
 		MeshComponent = component;
 	}
 
-	void SetCranePresetData(FCraneData*	data)
+	void SetCranePreset(FCranePresetEntryPtr InPreset, FCraneRigGeometryPtr InGeometry)
 	{
-		CraneData = data;
+		Preset = InPreset;
+		Geometry = InGeometry;
+	}
+
+	// a previous crane model is not needed anymore, it will be unloaded by the garbage collector
+	void ReleasePreviewMeshRequest()
+	{
+		if (PreviewMeshHandle.IsValid())
+		{
+			if (PreviewMeshHandle->IsLoadingInProgress())
+			{
+				PreviewMeshHandle->CancelHandle();
+			}
+			else
+			{
+				PreviewMeshHandle->ReleaseHandle();
+			}
+			PreviewMeshHandle.Reset();
+		}
+		RequestedModel = ECranePreviewModelsEnum::ECranePreview_Count;
 	}
 
 };
@@ -73,11 +191,17 @@ ATechnocraneRig::ATechnocraneRig()
 {
 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
 	PrimaryActorTick.bCanEverTick = true;
-	PrimaryActorTick.TickInterval = 1.0f;
+	PrimaryActorTick.TickInterval = NTechnocraneRig::SignificanceInterval;
+
+	// after animation is evaluated, enabled only while clearance is checked
+	ClearanceTickFunction.bCanEverTick = true;
+	ClearanceTickFunction.bStartWithTickEnabled = false;
+	ClearanceTickFunction.TickGroup = TG_PostUpdateWork;
 
 	// default control values
 	TrackPosition = 0.0f;
-	AmountOfTracks = 1;
+	// the run follows track positions of the crane
+	AmountOfTracks = 0;
 
 	CameraPivotOffset = FVector(-70.0f, 0.0f, 0.0f);
 
@@ -95,7 +219,7 @@ ATechnocraneRig::ATechnocraneRig()
 		if (CraneDataAsset.Succeeded())
 		{
 			CranesData = CraneDataAsset.Object;
-			PreloadPreviewMeshes();
+			CreatePreviewMeshComponent();
 			PreloadTracksMesh();
 		}
 		else
@@ -105,34 +229,9 @@ ATechnocraneRig::ATechnocraneRig()
 	}
 }
 
-bool ATechnocraneRig::PreloadPreviewMeshes()
+void ATechnocraneRig::CreatePreviewMeshComponent()
 {
-	if (!CranesData)
-	{
-		return false;
-	}
-		
-	const TArray<FName> RowNames = CranesData->GetRowNames();
-
-	for (const FName RawName : RowNames)
-	{
-		FString ModelPath("");
-
-		if (FCraneData* Data = CranesData->FindRow<FCraneData>(RawName, "", false))
-		{
-			ModelPath = Data->CraneModelPath;
-		}
-
-		ConstructorHelpers::FObjectFinder<USkeletalMesh> CraneBaseMesh(*ModelPath);
-
-		if (CraneBaseMesh.Succeeded())
-		{
-			PreviewMeshes.Add(CraneBaseMesh.Object);
-		}
-	}
-
-	//
-
+	// crane models are not loaded here, only the selected one is loaded on demand
 	MeshComponent = CreateOptionalDefaultSubobject<USkeletalMeshComponent>(TEXT("preview_mesh"));
 	if (MeshComponent)
 	{
@@ -144,8 +243,6 @@ bool ATechnocraneRig::PreloadPreviewMeshes()
 
 		TechnocraneRig.Impl->SetPoseableMeshComponent(MeshComponent);
 	}
-	
-	return (!PreviewMeshes.IsEmpty());
 }
 
 bool ATechnocraneRig::PreloadTracksMesh()
@@ -157,7 +254,8 @@ bool ATechnocraneRig::PreloadTracksMesh()
 	if (CraneTracksBaseMesh.Succeeded())
 	{
 		CraneTracksMesh = CraneTracksBaseMesh.Object;
-		CraneTracksMeshComponent = CreateOptionalDefaultSubobject<UStaticMeshComponent>(TEXT("tracks_mesh"));
+		// a static mesh component was saved as tracks_mesh, the new name keeps it from loading into the instanced one
+		CraneTracksMeshComponent = CreateOptionalDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("tracks_instances"));
 
 		if (CraneTracksMeshComponent)
 		{
@@ -185,55 +283,682 @@ void ATechnocraneRig::UpdateTracksMesh()
 	{
 		CraneTracksMeshComponent->SetVisibility(bShowTracks);
 	}
+
+	if (!FMath::IsNearlyEqual(LastTracksStartPosition, TracksStartPosition))
+	{
+		TracksRunEnd = TracksStartPosition;
+	}
+	TracksRunEnd = FMath::Max(TracksRunEnd, GetCraneTrackPosition());
+
+	if (bShowTracks)
+	{
+		UpdateTrackSegments();
+	}
+}
+
+float ATechnocraneRig::GetTracksLength() const
+{
+	return (CraneTracksMesh) ? GetNumTrackSegments() * GetTrackSegmentLength() : 0.0f;
+}
+
+float ATechnocraneRig::GetTrackSegmentLength() const
+{
+	return FMath::Max(2.0f * CraneTracksMesh->GetBounds().BoxExtent.Y, 1.0f);
+}
+
+int32 ATechnocraneRig::GetNumTrackSegments() const
+{
+	if (AmountOfTracks > 0)
+	{
+		return AmountOfTracks;
+	}
+
+	// the crane base stands on a segment at the farthest position, there is at least one segment under the crane
+	const float RunLength = FMath::Max(TracksRunEnd - TracksStartPosition, 0.0f);
+	return FMath::Min(FMath::FloorToInt(RunLength / GetTrackSegmentLength()) + 1, NTechnocraneRig::MaxTrackSegments);
+}
+
+float ATechnocraneRig::GetCraneTrackPosition() const
+{
+	if (const ACineCameraActor* CameraActor = Cast<ACineCameraActor>(TargetComponent.OtherActor.Get()))
+	{
+		if (const UTechnocraneCameraComponent* TechnocraneCameraComp = Cast<UTechnocraneCameraComponent>(CameraActor->GetCineCameraComponent()))
+		{
+			return TechnocraneCameraComp->TrackPos;
+		}
+	}
+	return TrackPosition;
+}
+
+FTransform ATechnocraneRig::GetTrackSegmentTransform(const FVector& SegmentStart, const float Heading) const
+{
+	const FBoxSphereBounds MeshBounds = CraneTracksMesh->GetBounds();
+	const float SegmentLength = GetTrackSegmentLength();
+
+	// place the segment center, the mesh pivot is not necessarily in the middle of the segment
+	const FQuat Rotation = FRotator(0.0f, Heading, 0.0f).Quaternion();
+	const FVector SegmentCenter = SegmentStart + Rotation.RotateVector(FVector(0.0f, 0.5f * SegmentLength, 0.0f));
+	const FVector PivotOffset(MeshBounds.Origin.X, MeshBounds.Origin.Y, 0.0f);
+
+	return FTransform(Rotation, SegmentCenter - Rotation.RotateVector(PivotOffset));
+}
+
+void ATechnocraneRig::UpdateTrackSegments()
+{
+	if (!CraneTracksMesh)
+	{
+		return;
+	}
+
+	const int32 NumSegments = GetNumTrackSegments();
+	const int32 NumInstances = CraneTracksMeshComponent->GetInstanceCount();
+
+	const bool bLayoutChanged = !FMath::IsNearlyEqual(LastTracksStartPosition, TracksStartPosition)
+		|| !FMath::IsNearlyEqual(LastTracksCurveAngle, TracksCurveAngle);
+
+	if (!bLayoutChanged && NumInstances == NumSegments)
+	{
+		return;
+	}
+
+	// remove segments from the end of the run
+	if (NumInstances > NumSegments)
+	{
+		TArray<int32> RemovedInstances;
+		for (int32 i = NumSegments; i < NumInstances; ++i)
+		{
+			RemovedInstances.Add(i);
+		}
+		CraneTracksMeshComponent->RemoveInstances(RemovedInstances);
+	}
+
+	// walk along the run once, every segment turns by the curve angle relative to a previous one
+	const int32 NumKept = FMath::Min(NumInstances, NumSegments);
+	const int32 FirstSegment = (bLayoutChanged) ? 0 : NumKept;
+	const FVector SegmentStep(0.0f, GetTrackSegmentLength(), 0.0f);
+
+	TArray<FTransform> KeptTransforms;
+	TArray<FTransform> NewTransforms;
+	KeptTransforms.Reserve(NumKept - FirstSegment);
+	NewTransforms.Reserve(NumSegments - NumKept);
+
+	FVector SegmentStart(0.0f, TracksStartPosition, 0.0f);
+	float Heading = 0.0f;
+
+	for (int32 i = 0; i < NumSegments; ++i)
+	{
+		if (i >= FirstSegment)
+		{
+			// existing segments move only when the layout is changed, new ones are appended to the end of the run
+			TArray<FTransform>& Transforms = (i < NumKept) ? KeptTransforms : NewTransforms;
+			Transforms.Add(GetTrackSegmentTransform(SegmentStart, Heading));
+		}
+
+		SegmentStart += FRotator(0.0f, Heading, 0.0f).RotateVector(SegmentStep);
+		Heading += TracksCurveAngle;
+	}
+
+	if (KeptTransforms.Num() > 0)
+	{
+		CraneTracksMeshComponent->BatchUpdateInstancesTransforms(0, KeptTransforms, false /*bWorldSpace*/, true /*bMarkRenderStateDirty*/);
+	}
+
+	if (NewTransforms.Num() > 0)
+	{
+		CraneTracksMeshComponent->AddInstances(NewTransforms, false /*bShouldReturnIndices*/);
+	}
+
+	LastTracksStartPosition = TracksStartPosition;
+	LastTracksCurveAngle = TracksCurveAngle;
 }
 
 void ATechnocraneRig::UpdatePreviewMeshes()
 {
-	if (PreviewMeshes.IsEmpty() || !MeshComponent)
+	FTechnocranePresetRegistry& Registry = FTechnocranePresetRegistry::Get();
+
+	if (!MeshComponent || !Registry.Initialize(CranesData))
 	{
 		return;
 	}
 
-	if (LastPreviewModel != CraneModel)
+	FTechnocraneRigImpl& Impl = *TechnocraneRig.Impl;
+
+	if (LastPreviewModel == CraneModel)
 	{
-		// attach another crane
-		USkeletalMesh* PreviewMesh = PreviewMeshes[static_cast<int32>(CraneModel)];
-			
-		// crane preset data
-		const FString PresetName(FString::FromInt(static_cast<int32>(CraneModel) + 1));
-		if (FCraneData* Data = CranesData->FindRow<FCraneData>(FName(*PresetName), "", false))
+		// the model is switched back while another one is still loading
+		if (Impl.RequestedModel != CraneModel)
 		{
-			TechnocraneRig.Impl->SetCranePresetData(Data);
+			Impl.ReleasePreviewMeshRequest();
+		}
+		return;
+	}
+	else if (Impl.RequestedModel == CraneModel)
+	{
+		// waiting for the model to load
+		return;
+	}
+
+	if (const FCranePresetEntryPtr Preset = Registry.Find(CraneModel))
+	{
+		Impl.ReleasePreviewMeshRequest();
+		Impl.RequestedModel = CraneModel;
+		Impl.RequestTime = FPlatformTime::Seconds();
+		Impl.FirstRequestTime = (Impl.FirstRequestTime > 0.0) ? Impl.FirstRequestTime : Impl.RequestTime;
+
+		// the delegate is called right away when the model is already in memory
+		Impl.PreviewMeshHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Preset->ModelPath,
+			FStreamableDelegate::CreateUObject(this, &ATechnocraneRig::OnPreviewMeshLoaded, CraneModel), FStreamableManager::AsyncLoadHighPriority);
 
-			MeshComponent->SetSkinnedAssetAndUpdate(PreviewMesh);
-			MeshComponent->SetAnimInstanceClass(UTechnocraneRigAnimInstance::StaticClass());
+		if (!Impl.PreviewMeshHandle.IsValid())
+		{
+			UE_LOG(LogTechnocrane, Warning, TEXT("Failed to request a crane model %s"), *Preset->ModelPath.ToString());
+		}
+	}
+}
+
+void ATechnocraneRig::OnPreviewMeshLoaded(ECranePreviewModelsEnum InCraneModel)
+{
+	FTechnocraneRigImpl& Impl = *TechnocraneRig.Impl;
 
-			TObjectPtr<UTechnocraneRigAnimInstance> AnimInstance = Cast<UTechnocraneRigAnimInstance>(MeshComponent->GetAnimInstance());
+	// the selection has changed while loading
+	if (InCraneModel != CraneModel || InCraneModel != Impl.RequestedModel || !MeshComponent)
+	{
+		return;
+	}
+
+	const FCranePresetEntryPtr Preset = FTechnocranePresetRegistry::Get().Find(CraneModel);
+	USkeletalMesh* LoadedMesh = (Impl.PreviewMeshHandle.IsValid()) ? Cast<USkeletalMesh>(Impl.PreviewMeshHandle->GetLoadedAsset()) : nullptr;
+
+	if (!Preset || !LoadedMesh)
+	{
+		UE_LOG(LogTechnocrane, Warning, TEXT("Failed to load a crane model for preset %d"), static_cast<int32>(CraneModel) + 1);
+		return;
+	}
+
+	UE_LOG(LogTechnocrane, Verbose, TEXT("Crane model %s is loaded in %.2f ms"), *Preset->ModelPath.ToString(), 1000.0 * (FPlatformTime::Seconds() - Impl.RequestTime));
+
+	ApplyPreviewMesh(LoadedMesh, Preset);
+
+	if (!Impl.bFirstModelApplied)
+	{
+		Impl.bFirstModelApplied = true;
+		UE_LOG(LogTechnocrane, Log, TEXT("Crane rig %s shows its model in %.2f ms"), *GetName(), 1000.0 * (FPlatformTime::Seconds() - Impl.FirstRequestTime));
+	}
+}
+
+void ATechnocraneRig::ApplyPreviewMesh(USkeletalMesh* InPreviewMesh, const FCranePresetEntryPtr& Preset)
+{
+	const FCraneData* Data = &Preset->Data;
+
+	// attach another crane, a previous mesh is not referenced anymore
+	PreviewMesh = InPreviewMesh;
+
+	TechnocraneRig.Impl->SetCranePreset(Preset, FTechnocranePresetRegistry::Get().FindOrBuildGeometry(PreviewMesh, Data->ColumnRotationBone));
+	ResolveReachabilityField();
+
+	MeshComponent->SetSkinnedAssetAndUpdate(PreviewMesh);
+	MeshComponent->SetAnimInstanceClass(UTechnocraneRigAnimInstance::StaticClass());
+
+	TObjectPtr<UTechnocraneRigAnimInstance> AnimInstance = Cast<UTechnocraneRigAnimInstance>(MeshComponent->GetAnimInstance());
+
+	if (AnimInstance)
+	{
+		AnimInstance->ConfigureAnimInstance(TargetComponent.OtherActor, *Data, CameraPivotOffset, bShowDebug);
+		AnimInstance->SetReachabilityField(ActiveReachabilityField, ReachWarningMargin);
+		MeshComponent->SetUpdateAnimationInEditor(true);
+		MeshComponent->InitAnim(true /*bForceReinit*/);
+	}
+
+	// the anim instance could be recreated on init
+	if (UTechnocraneRigAnimInstance* OutputInstance = Cast<UTechnocraneRigAnimInstance>(MeshComponent->GetAnimInstance()))
+	{
+		OutputInstance->OnSimulationUpdated().RemoveAll(this);
+		OutputInstance->OnSimulationUpdated().AddUObject(this, &ATechnocraneRig::HandleSimulationUpdated);
+	}
 
-			if (AnimInstance)
+	// start at full rate, significance lowers the tier on the next tick
+	SetUpdateTier(ECraneRigUpdateTier::FullRate);
+	ApplyUpdateTier(UpdateTier);
+
+	LastPreviewModel = CraneModel;
+	bLastSupportTracks = Data->TracksSupport > 0;
+	LastTracksOffset = Data->ZOffsetOnTracks;
+
+	if (CraneTracksMeshComponent)
+	{
+		CraneTracksMeshComponent->SetRelativeLocation(FVector(0.0f, 0.0f, LastTracksOffset));
+	}
+}
+
+void ATechnocraneRig::UpdateCraneComponents()
+{
+	UpdatePreviewMeshes();
+	UpdateTracksMesh();
+}
+
+void ATechnocraneRig::UpdateSignificance()
+{
+	if (!MeshComponent || LastPreviewModel == ECranePreviewModelsEnum::ECranePreview_Count)
+	{
+		return;
+	}
+
+	ECraneRigUpdateTier NewTier = ECraneRigUpdateTier::FullRate;
+
+	if (!bHeroCrane)
+	{
+		if (!MeshComponent->WasRecentlyRendered(2.0f * NTechnocraneRig::SignificanceInterval))
+		{
+			NewTier = ECraneRigUpdateTier::SimulationOnly;
+		}
+		else if (const UWorld* World = GetWorld())
+		{
+			// distance to the closest view, every viewport and scene capture counts
+			const FVector Location = GetActorLocation();
+			float MinDistSquared = (World->ViewLocationsRenderedLastFrame.Num() > 0) ? MAX_flt : 0.0f;
+
+			for (const FVector& ViewLocation : World->ViewLocationsRenderedLastFrame)
 			{
-				AnimInstance->ConfigureAnimInstance(TargetComponent.OtherActor, *Data, CameraPivotOffset, bShowDebug);
-				MeshComponent->SetUpdateAnimationInEditor(true);
-				MeshComponent->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
-				MeshComponent->InitAnim(true /*bForceReinit*/);
+				MinDistSquared = FMath::Min(MinDistSquared, static_cast<float>(FVector::DistSquared(Location, ViewLocation)));
 			}
 
-			LastPreviewModel = CraneModel;
-			bLastSupportTracks = Data->TracksSupport > 0;
-			LastTracksOffset = Data->ZOffsetOnTracks;
-
-			if (CraneTracksMeshComponent)
+			if (MinDistSquared > FMath::Square(ReducedRateDistance))
 			{
-				CraneTracksMeshComponent->SetRelativeLocation(FVector(0.0f, 0.0f, LastTracksOffset));
+				NewTier = ECraneRigUpdateTier::ReducedRate;
 			}
 		}
 	}
+
+	if (NewTier != UpdateTier)
+	{
+		SetUpdateTier(NewTier);
+		ApplyUpdateTier(NewTier);
+	}
 }
 
-void ATechnocraneRig::UpdateCraneComponents()
+void ATechnocraneRig::SetUpdateTier(const ECraneRigUpdateTier InTier)
 {
-	UpdatePreviewMeshes();
-	UpdateTracksMesh();
+	if (TechnocraneRig.Impl->bCountedInTierStats)
+	{
+		NTechnocraneRig::AdjustTierStat(UpdateTier, -1);
+	}
+
+	UpdateTier = InTier;
+	NTechnocraneRig::AdjustTierStat(UpdateTier, 1);
+	TechnocraneRig.Impl->bCountedInTierStats = true;
+}
+
+void ATechnocraneRig::ResetTierStats()
+{
+	if (TechnocraneRig.Impl.IsValid() && TechnocraneRig.Impl->bCountedInTierStats)
+	{
+		NTechnocraneRig::AdjustTierStat(UpdateTier, -1);
+		TechnocraneRig.Impl->bCountedInTierStats = false;
+	}
+}
+
+void ATechnocraneRig::ApplyUpdateTier(const ECraneRigUpdateTier InTier)
+{
+	if (!MeshComponent)
+	{
+		return;
+	}
+
+	switch (InTier)
+	{
+	case ECraneRigUpdateTier::FullRate:
+		MeshComponent->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+		MeshComponent->SetComponentTickInterval(0.0f);
+		break;
+
+	case ECraneRigUpdateTier::ReducedRate:
+		MeshComponent->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+		MeshComponent->SetComponentTickInterval(1.0f / FMath::Max(ReducedUpdateRate, 1.0f));
+		break;
+
+	case ECraneRigUpdateTier::SimulationOnly:
+		// the pose is not needed while nobody sees the crane, simulation data is solved by the rig
+		MeshComponent->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+		MeshComponent->SetComponentTickInterval(0.0f);
+		break;
+	}
+}
+
+void ATechnocraneRig::UpdateSimulationData()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneRigSimulationOnly);
+
+	const FCranePresetEntryPtr Preset = TechnocraneRig.Impl->Preset;
+	const FCraneRigGeometry* Geometry = TechnocraneRig.Impl->Geometry.Get();
+
+	if (!Preset || !Geometry || !Geometry->IsValid())
+	{
+		return;
+	}
+
+	FCraneRigSolverInput Input;
+	if (!FTechnocraneRigKinematics::MakeTargetInput(TargetComponent.OtherActor.Get(), CameraPivotOffset, GetActorTransform(), TrackPosition, Input))
+	{
+		return;
+	}
+
+	FCraneRigSolution Solution;
+	FCraneRigSolver::Solve(*Geometry, Preset->Preset, Input, Solution);
+	FTechnocraneRigKinematics::ToSimulationData(Solution, SimulationData);
+
+	if (ActiveReachabilityField)
+	{
+		SimulationData.ReachMargin = ActiveReachabilityField->GetReachMargin(Input.Target, Input.TrackPosition);
+		SimulationData.bNearReachLimit = SimulationData.ReachMargin < ReachWarningMargin;
+	}
+
+	ApplyClearance(SimulationData);
+	OnSimulationUpdated.Broadcast(SimulationData);
+}
+
+void ATechnocraneRig::HandleSimulationUpdated(const FCraneSimulationData& InData)
+{
+	// an off-screen crane could still be evaluated for a frame, the rig solves it on its own
+	if (UpdateTier == ECraneRigUpdateTier::SimulationOnly)
+	{
+		return;
+	}
+
+	SimulationData = InData;
+	ApplyClearance(SimulationData);
+	OnSimulationUpdated.Broadcast(SimulationData);
+}
+
+void ATechnocraneRig::ConfigureAnimInstance()
+{
+	if (!MeshComponent)
+	{
+		return;
+	}
+
+	ResolveReachabilityField();
+
+	if (const FCranePresetEntryPtr Preset = FTechnocranePresetRegistry::Get().Find(CraneModel))
+	{
+		TObjectPtr<UTechnocraneRigAnimInstance> AnimInstance = Cast<UTechnocraneRigAnimInstance>(MeshComponent->GetAnimInstance());
+
+		if (AnimInstance)
+		{
+			AnimInstance->ConfigureAnimInstance(TargetComponent.OtherActor, Preset->Data, CameraPivotOffset, bShowDebug);
+			AnimInstance->SetReachabilityField(ActiveReachabilityField, ReachWarningMargin);
+			AnimInstance->SetPoseCache((bUsePoseCache) ? TechnocraneRig.Impl->PoseCache : nullptr, PoseCacheTime);
+		}
+	}
+}
+
+void ATechnocraneRig::ResolveReachabilityField()
+{
+	const FCranePresetEntryPtr Preset = TechnocraneRig.Impl->Preset;
+	const FCraneRigGeometry* Geometry = TechnocraneRig.Impl->Geometry.Get();
+
+	// margins of a field made for another crane or for older preset data would be wrong
+	ActiveReachabilityField = (Preset && Geometry)
+		? UTechnocraneReachabilityField::ResolveFor(ReachabilityField, this, CraneModel, *Geometry, Preset->Preset, ActiveReachabilityField)
+		: nullptr;
+}
+
+void ATechnocraneRig::SetTargetActor(AActor* InTargetActor)
+{
+	TargetComponent.OtherActor = InTargetActor;
+	ConfigureAnimInstance();
+}
+
+void ATechnocraneRig::SetPoseCacheTime(float InTime)
+{
+	PoseCacheTime = InTime;
+	UpdatePoseCache();
+}
+
+bool ATechnocraneRig::BakePoseCache(TArrayView<const FTransform> CameraTransforms, TArrayView<const float> TrackPositions, const FFrameRate FrameRate,
+	const UMovieSceneSignedObject* Source, const UMovieSceneSignedObject* TrackPositionSource)
+{
+	ClearPoseCache();
+
+	FTechnocranePresetRegistry& Registry = FTechnocranePresetRegistry::Get();
+
+	const FCranePresetEntryPtr Preset = (Registry.Initialize()) ? Registry.Find(CraneModel) : nullptr;
+	const FCraneRigGeometryPtr Geometry = (Preset) ? Registry.LoadGeometry(CraneModel) : nullptr;
+
+	if (!Preset || !Geometry.IsValid() || !Geometry->IsValid() || CameraTransforms.Num() == 0)
+	{
+		return false;
+	}
+
+	// the same inputs the anim node makes from a target camera
+	FTransform CameraComponentTransform = FTransform::Identity;
+	float CameraTrackPosition = TrackPosition;
+
+	if (const ACineCameraActor* CameraActor = Cast<ACineCameraActor>(TargetComponent.OtherActor.Get()))
+	{
+		const UCineCameraComponent* CameraComp = CameraActor->GetCineCameraComponent();
+		CameraComponentTransform = CameraComp->GetRelativeTransform();
+
+		if (const UTechnocraneCameraComponent* TechnocraneCameraComp = Cast<UTechnocraneCameraComponent>(CameraComp))
+		{
+			CameraTrackPosition = TechnocraneCameraComp->TrackPos;
+		}
+	}
+
+	const FTransform RigTransform = GetActorTransform();
+
+	TArray<FCraneRigSolverInput> Inputs;
+	Inputs.SetNum(CameraTransforms.Num());
+
+	// a dolly moves along tracks during the shot, the last position holds when there are fewer positions than frames
+	for (int32 i = 0; i < CameraTransforms.Num(); ++i)
+	{
+		FTechnocraneRigKinematics::MakeCameraInput(CameraTransforms[i], CameraComponentTransform * CameraTransforms[i], CameraPivotOffset, RigTransform, Inputs[i]);
+		Inputs[i].TrackPosition = (TrackPositions.Num() > 0) ? TrackPositions[FMath::Min(i, TrackPositions.Num() - 1)] : CameraTrackPosition;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TSharedRef<FCraneRigPoseCache, ESPMode::ThreadSafe> PoseCache = MakeShared<FCraneRigPoseCache, ESPMode::ThreadSafe>();
+	PoseCache->Build(*Geometry, Preset->Preset, Inputs, FrameRate);
+
+	UE_LOG(LogTechnocrane, Log, TEXT("%s: baked %d crane poses in %.2f ms, %.2f MB"), *GetName(), PoseCache->Num(),
+		1000.0 * (FPlatformTime::Seconds() - StartTime), PoseCache->GetAllocatedSize() / (1024.0 * 1024.0));
+
+	FTechnocraneRigImpl& Impl = *TechnocraneRig.Impl;
+	Impl.PoseCache = PoseCache;
+	Impl.PoseCacheModel = CraneModel;
+	Impl.PoseCachePivotOffset = CameraPivotOffset;
+	Impl.PoseCacheRigTransform = RigTransform;
+	Impl.PoseCacheSource = Source;
+	Impl.PoseCacheSignature = (Source) ? Source->GetSignature() : FGuid();
+	Impl.PoseCacheTrackPositionSource = TrackPositionSource;
+	Impl.PoseCacheTrackPositionSignature = (TrackPositionSource) ? TrackPositionSource->GetSignature() : FGuid();
+
+	UpdatePoseCache();
+	return true;
+}
+
+void ATechnocraneRig::ClearPoseCache()
+{
+	TechnocraneRig.Impl->PoseCache.Reset();
+	UpdatePoseCache();
+}
+
+bool ATechnocraneRig::HasPoseCache() const
+{
+	return TechnocraneRig.Impl->PoseCache.IsValid();
+}
+
+void ATechnocraneRig::UpdatePoseCache()
+{
+	FTechnocraneRigImpl& Impl = *TechnocraneRig.Impl;
+
+	if (Impl.PoseCache.IsValid())
+	{
+		const UMovieSceneSignedObject* Source = Impl.PoseCacheSource.Get();
+		const UMovieSceneSignedObject* TrackPositionSource = Impl.PoseCacheTrackPositionSource.Get();
+
+		const bool bSourceChanged = (Impl.PoseCacheSignature.IsValid() && (!Source || Source->GetSignature() != Impl.PoseCacheSignature))
+			|| (Impl.PoseCacheTrackPositionSignature.IsValid() && (!TrackPositionSource || TrackPositionSource->GetSignature() != Impl.PoseCacheTrackPositionSignature));
+
+		if (bSourceChanged
+			|| Impl.PoseCacheModel != CraneModel
+			|| !Impl.PoseCachePivotOffset.Equals(CameraPivotOffset)
+			|| !Impl.PoseCacheRigTransform.Equals(GetActorTransform()))
+		{
+			UE_LOG(LogTechnocrane, Log, TEXT("%s: crane pose cache is out of date and dropped"), *GetName());
+			Impl.PoseCache.Reset();
+		}
+	}
+
+	if (UTechnocraneRigAnimInstance* AnimInstance = (MeshComponent) ? Cast<UTechnocraneRigAnimInstance>(MeshComponent->GetAnimInstance()) : nullptr)
+	{
+		AnimInstance->SetPoseCache((bUsePoseCache) ? Impl.PoseCache : nullptr, PoseCacheTime);
+	}
+}
+
+int32 ATechnocraneRig::CheckPoseCacheClearance(TArray<float>& OutClearance) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_TechnocranePoseCacheClearance);
+
+	OutClearance.Reset();
+
+	const FTechnocraneRigImpl& Impl = *TechnocraneRig.Impl;
+	const FCraneRigPoseCache* PoseCache = Impl.PoseCache.Get();
+	const FCraneRigGeometry* Geometry = Impl.Geometry.Get();
+	const UWorld* World = GetWorld();
+
+	if (!PoseCache || !PoseCache->IsValid() || !Geometry || !Geometry->IsValid() || !World || !MeshComponent)
+	{
+		return INDEX_NONE;
+	}
+
+	const FTransform ComponentTransform = MeshComponent->GetComponentTransform();
+	const FCraneClearanceRadii Radii = NTechnocraneRig::MakeClearanceRadii(*this);
+	const double FrameInterval = PoseCache->FrameRate.AsInterval();
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(TechnocraneClearance), false, this);
+	if (const AActor* TargetActor = TargetComponent.OtherActor.Get())
+	{
+		Params.AddIgnoredActor(TargetActor);
+	}
+
+	OutClearance.SetNumUninitialized(PoseCache->Num());
+
+	// scene queries only read the physics scene, frames are checked with synchronous overlaps on worker threads
+	ParallelFor(PoseCache->Num(), [&](const int32 Frame)
+	{
+		FCraneRigPose Pose;
+		FCraneRigSolution Solution;
+		PoseCache->Evaluate(Frame * FrameInterval, Pose, Solution);
+
+		NTechnocraneRig::FClearanceCapsules Capsules;
+		FCraneRigClearance::MakeCapsules(*Geometry, Pose, Radii, Capsules);
+		NTechnocraneRig::TransformCapsules(ComponentTransform, Capsules);
+
+		TArray<FOverlapResult> Overlaps;
+		float MinClearance = ClearanceSearchDistance;
+
+		for (const FCraneClearanceCapsule& Capsule : Capsules)
+		{
+			Overlaps.Reset();
+			World->OverlapMultiByChannel(Overlaps, Capsule.GetCenter(), Capsule.GetRotation(), ClearanceChannel,
+				FCraneClearanceQuery::MakeShape(Capsule, ClearanceSearchDistance), Params);
+
+			const AActor* Actor = nullptr;
+			MinClearance = FMath::Min(MinClearance, FCraneClearanceQuery::ComputeClearance(Capsule, Overlaps, ClearanceSearchDistance, Actor));
+		}
+
+		OutClearance[Frame] = MinClearance;
+	});
+
+	return OutClearance.IndexOfByPredicate([](const float Clearance) { return Clearance <= 0.0f; });
+}
+
+void ATechnocraneRig::UpdateClearance()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneRigClearance);
+
+	FTechnocraneRigImpl& Impl = *TechnocraneRig.Impl;
+	UWorld* World = GetWorld();
+
+	if (!bCheckClearance || !World || !MeshComponent)
+	{
+		Impl.ResetClearance();
+		return;
+	}
+
+	// overlaps issued last frame are resolved by now, an expired batch is dropped
+	FCraneClearanceResult Result;
+	if (Impl.ClearanceQuery.Collect(*World, Result))
+	{
+		Impl.MinClearance = Result.MinClearance;
+		Impl.bClearanceCollision = Result.bCollision;
+		Impl.CollisionJoint = (Result.bCollision) ? GetCraneJointName(static_cast<ECraneJoints>(Result.CollisionJoint)) : NAME_None;
+		Impl.CollisionActor = Result.CollisionActor;
+	}
+
+	// an off-screen crane is not evaluated, there is no pose to check
+	const FCraneRigGeometry* Geometry = Impl.Geometry.Get();
+	if (UpdateTier == ECraneRigUpdateTier::SimulationOnly || !Geometry || !Geometry->IsValid())
+	{
+		return;
+	}
+
+	// component space transforms solved by the anim node in the last evaluation
+	const TArray<FTransform>& BoneTransforms = MeshComponent->GetComponentSpaceTransforms();
+	FCraneRigPose Pose;
+
+	for (int32 Joint = 0; Joint < FCraneRigGeometry::JointCount; ++Joint)
+	{
+		if (!Geometry->HasJoint(Joint))
+		{
+			continue;
+		}
+		if (!BoneTransforms.IsValidIndex(Geometry->RefBoneIndex[Joint]))
+		{
+			return;
+		}
+		Pose.ComponentSpace[Joint] = BoneTransforms[Geometry->RefBoneIndex[Joint]];
+	}
+
+	NTechnocraneRig::FClearanceCapsules Capsules;
+	FCraneRigClearance::MakeCapsules(*Geometry, Pose, NTechnocraneRig::MakeClearanceRadii(*this), Capsules);
+	NTechnocraneRig::TransformCapsules(MeshComponent->GetComponentTransform(), Capsules);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(TechnocraneClearance), false, this);
+	if (const AActor* TargetActor = TargetComponent.OtherActor.Get())
+	{
+		Params.AddIgnoredActor(TargetActor);
+	}
+
+	// one batch per frame, the results are collected on the next frame
+	Impl.ClearanceQuery.Issue(*World, Capsules, ClearanceChannel, ClearanceSearchDistance, Params);
+}
+
+void ATechnocraneRig::EnableClearanceTick()
+{
+	if (ClearanceTickFunction.IsTickFunctionEnabled() == bCheckClearance)
+	{
+		return;
+	}
+
+	ClearanceTickFunction.SetTickFunctionEnable(bCheckClearance);
+
+	if (!bCheckClearance)
+	{
+		TechnocraneRig.Impl->ResetClearance();
+	}
+}
+
+void ATechnocraneRig::ApplyClearance(FCraneSimulationData& InOutData) const
+{
+	const FTechnocraneRigImpl& Impl = *TechnocraneRig.Impl;
+
+	InOutData.MinClearance = Impl.MinClearance;
+	InOutData.bClearanceCollision = Impl.bClearanceCollision;
+	InOutData.CollisionJoint = Impl.CollisionJoint;
+	InOutData.CollisionActor = Impl.CollisionActor;
 }
 
 // Called when the game starts or when spawned
@@ -242,6 +967,23 @@ void ATechnocraneRig::BeginPlay()
 	Super::BeginPlay();
 }
 
+void ATechnocraneRig::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ResetTierStats();
+	Super::EndPlay(EndPlayReason);
+}
+
+void ATechnocraneRig::BeginDestroy()
+{
+	ResetTierStats();
+
+	if (TechnocraneRig.Impl.IsValid())
+	{
+		TechnocraneRig.Impl->ReleasePreviewMeshRequest();
+	}
+	Super::BeginDestroy();
+}
+
 // Called every frame
 void ATechnocraneRig::Tick(float DeltaTime)
 {
@@ -250,15 +992,14 @@ void ATechnocraneRig::Tick(float DeltaTime)
 	// feed exposed API into underlying components
 	UpdateCraneComponents();
 
-	// update simulation stats
-	if (MeshComponent)
-	{
-		TObjectPtr<UTechnocraneRigAnimInstance> AnimInstance = Cast<UTechnocraneRigAnimInstance>(MeshComponent->GetAnimInstance());
+	UpdateSignificance();
+	UpdatePoseCache();
+	EnableClearanceTick();
 
-		if (AnimInstance)
-		{
-			AnimInstance->GetSimulationOutData(SimulationData);
-		}
+	// simulation output of an evaluated crane is pushed by the anim instance every frame
+	if (UpdateTier == ECraneRigUpdateTier::SimulationOnly)
+	{
+		UpdateSimulationData();
 	}
 }
 
@@ -267,18 +1008,13 @@ void ATechnocraneRig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChan
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
-	if (MeshComponent && PropertyChangedEvent.MemberProperty && TargetComponent.OtherActor.IsValid())
+	if (PropertyChangedEvent.MemberProperty && TargetComponent.OtherActor.IsValid())
 	{
-		const FString PresetName(FString::FromInt(static_cast<int32>(CraneModel) + 1));
-		if (FCraneData* Data = CranesData->FindRow<FCraneData>(FName(*PresetName), "", false))
-		{
-			TObjectPtr<UTechnocraneRigAnimInstance> AnimInstance = Cast<UTechnocraneRigAnimInstance>(MeshComponent->GetAnimInstance());
-
-			if (AnimInstance)
-			{
-				AnimInstance->ConfigureAnimInstance(TargetComponent.OtherActor, *Data, CameraPivotOffset, bShowDebug);
-			}
-		}
+		ConfigureAnimInstance();
+	}
+	else if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(ATechnocraneRig, ReachabilityField))
+	{
+		ResolveReachabilityField();
 	}
 
 	UpdateCraneComponents();
@@ -300,9 +1036,60 @@ void ATechnocraneRig::EditorApplyTranslation(const FVector& DeltaTranslation, bo
 
 #endif // WITH_EDITOR
 
+float ATechnocraneRig::GetReachMargin(const FVector& WorldLocation) const
+{
+	if (!ActiveReachabilityField)
+	{
+		return 0.0f;
+	}
+
+	const FVector LocalPosition = GetActorTransform().InverseTransformPosition(WorldLocation);
+	return ActiveReachabilityField->GetReachMargin(LocalPosition, TrackPosition);
+}
+
 bool ATechnocraneRig::ShouldTickIfViewportsOnly() const
 {
 	return true;
 }
 
+void ATechnocraneRig::RegisterActorTickFunctions(bool bRegister)
+{
+	Super::RegisterActorTickFunctions(bRegister);
+
+	if (bRegister)
+	{
+		if (ClearanceTickFunction.bCanEverTick)
+		{
+			ClearanceTickFunction.Target = this;
+			ClearanceTickFunction.SetTickFunctionEnable(bCheckClearance);
+			ClearanceTickFunction.RegisterTickFunction(GetLevel());
+		}
+	}
+	else if (ClearanceTickFunction.IsTickFunctionRegistered())
+	{
+		ClearanceTickFunction.UnRegisterTickFunction();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// FCraneRigClearanceTickFunction
+
+void FCraneRigClearanceTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && IsValid(Target) && (TickType != LEVELTICK_ViewportsOnly || Target->ShouldTickIfViewportsOnly()))
+	{
+		Target->UpdateClearance();
+	}
+}
+
+FString FCraneRigClearanceTickFunction::DiagnosticMessage()
+{
+	return (Target) ? Target->GetFullName() + TEXT("[TickClearance]") : TEXT("TechnocraneRig[TickClearance]");
+}
+
+FName FCraneRigClearanceTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("TechnocraneRigClearance"));
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -12,25 +12,61 @@
 /// Anim Instance 
 ///////////////////////////////////
 
+UTechnocraneRigAnimInstance::UTechnocraneRigAnimInstance(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// the game thread only copies an input snapshot, the crane is solved on animation workers
+	bUseMultiThreadedAnimationUpdate = true;
+}
+
 void UTechnocraneRigAnimInstance::NativeInitializeAnimation()
 {
 	FTechnocraneRigInstanceProxy& Proxy = GetProxyOnGameThread<FTechnocraneRigInstanceProxy>();
 	Proxy.Initialize(this);
 }
 
-void UTechnocraneRigAnimInstance::ConfigureAnimInstance(TWeakObjectPtr<AActor> InTargetActor, FCraneData& InCraneData, const FVector& InCameraPivotOffset, bool bShowDebug)
+void UTechnocraneRigAnimInstance::ConfigureAnimInstance(TWeakObjectPtr<AActor> InTargetActor, const FCraneData& InCraneData, const FVector& InCameraPivotOffset, bool bShowDebug)
 {
 	FTechnocraneRigInstanceProxy& Proxy = GetProxyOnGameThread<FTechnocraneRigInstanceProxy>();
 	Proxy.ConfigureAnimInstanceProxy(InTargetActor, InCraneData, InCameraPivotOffset, bShowDebug);
 }
 
-void UTechnocraneRigAnimInstance::GetSimulationOutData(FCraneSimulationData& OutData)
+void UTechnocraneRigAnimInstance::SetReachabilityField(UTechnocraneReachabilityField* InField, const float InWarningMargin)
 {
 	FTechnocraneRigInstanceProxy& Proxy = GetProxyOnGameThread<FTechnocraneRigInstanceProxy>();
-	OutData = Proxy.CraneData;
+	Proxy.SetReachabilityField(InField, InWarningMargin);
+}
+
+void UTechnocraneRigAnimInstance::SetPoseCache(FCraneRigPoseCachePtr InPoseCache, const float InTime)
+{
+	// the proxy is not touched here, getting it would wait for a running parallel update
+	if (PoseCache != InPoseCache)
+	{
+		PoseCache = MoveTemp(InPoseCache);
+		bPoseCacheChanged = true;
+	}
+	PoseCacheTime = InTime;
+}
+
+void UTechnocraneRigAnimInstance::GetSimulationOutData(FCraneSimulationData& OutData) const
+{
+	SimulationOutput.Read(OutData);
+}
+
+void UTechnocraneRigAnimInstance::NativePostEvaluateAnimation()
+{
+	Super::NativePostEvaluateAnimation();
+
+	if (SimulationOutput.GetVersion() != LastBroadcastVersion && SimulationUpdatedEvent.IsBound())
+	{
+		FCraneSimulationData Data;
+		LastBroadcastVersion = SimulationOutput.Read(Data);
+
+		SimulationUpdatedEvent.Broadcast(Data);
+	}
 }
 
 FAnimInstanceProxy* UTechnocraneRigAnimInstance::CreateAnimInstanceProxy()
 {
-	return new FTechnocraneRigInstanceProxy(this, &AnimNode);
+	return new FTechnocraneRigInstanceProxy(this, &AnimNode, &SimulationOutput);
 }
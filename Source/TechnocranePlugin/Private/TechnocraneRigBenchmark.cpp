@@ -0,0 +1,424 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneRigBenchmark.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneRigKinematics.h"
+#include "TechnocraneReachField.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneData.h"
+#include "TechnocraneRig.h"
+#include "TechnocraneCamera.h"
+#include "TechnocraneCameraComponent.h"
+#include "TechnocraneTakeSamples.h"
+#include "TechnocranePresetRegistry.h"
+#include "AnimNode_TechnocraneRig.h"
+
+#include "CineCameraActor.h"
+#include "Engine/World.h"
+#include "Engine/SkeletalMesh.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Channels/MovieSceneFloatChannel.h"
+
+namespace NTechnocraneRigBenchmark
+{
+	// measure a batch solve for a number of crane rigs that are spread around the crane base
+	void RunBatch(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const int32 NumRigs, const int32 NumIterations)
+	{
+		FCraneRigBatch Batch;
+		const int32 PresetIndex = Batch.AddPreset(&Geometry, Preset);
+		Batch.SetNum(NumRigs);
+
+		FRandomStream RandomStream(NumRigs);
+		FCraneRigSolverInput Input;
+
+		for (int32 i = 0; i < NumRigs; ++i)
+		{
+			Input.Target = FVector(RandomStream.FRandRange(-600.0f, 600.0f), RandomStream.FRandRange(-600.0f, 600.0f), RandomStream.FRandRange(0.0f, 400.0f));
+			Input.TrackPosition = RandomStream.FRandRange(0.0f, 200.0f);
+			Input.RawRotation = FVector(RandomStream.FRandRange(-180.0f, 180.0f), RandomStream.FRandRange(-45.0f, 45.0f), 0.0f);
+			Input.NeckQ = FQuat::MakeFromEuler(FVector(90.0f, 0.0f, 180.0f + Input.RawRotation.X));
+
+			Batch.SetRig(i, PresetIndex, Input);
+		}
+
+		// warm up worker threads
+		Batch.Solve();
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumIterations; ++i)
+		{
+			Batch.Solve();
+		}
+		const double ElapsedMs = 1000.0 * (FPlatformTime::Seconds() - StartTime) / NumIterations;
+
+		// the same rigs through the per rig solver on one thread
+		FCraneRigBatch Reference(Batch);
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumIterations; ++i)
+		{
+			Reference.SolveEachRig();
+		}
+		const double ReferenceMs = 1000.0 * (FPlatformTime::Seconds() - StartTime) / NumIterations;
+
+		UE_LOG(LogTechnocrane, Display, TEXT("Technocrane rig batch solve, %d rigs: %.4f ms per batch, %.3f us per rig, per rig solver %.4f ms (x%.1f)%s"),
+			NumRigs, ElapsedMs, 1000.0 * ElapsedMs / NumRigs, ReferenceMs, ReferenceMs / FMath::Max(ElapsedMs, 1e-6),
+			Batch.LaneGeometries[PresetIndex].bIsValid ? TEXT("") : TEXT(", lanes are off for the preset"));
+	}
+
+	// measure reachability queries against a precomputed field
+	void RunReachQueries(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, const int32 NumQueries, const int32 NumIterations)
+	{
+		double StartTime = FPlatformTime::Seconds();
+
+		FCraneReachField Field;
+		Field.Build(Geometry, Preset, 10.0f);
+
+		const double BuildMs = 1000.0 * (FPlatformTime::Seconds() - StartTime);
+
+		FRandomStream RandomStream(NumQueries);
+		TArray<FVector> Positions;
+		Positions.SetNumUninitialized(NumQueries);
+
+		for (FVector& Position : Positions)
+		{
+			Position = FVector(RandomStream.FRandRange(-1500.0f, 1500.0f), RandomStream.FRandRange(-1500.0f, 1500.0f), RandomStream.FRandRange(-200.0f, 1000.0f));
+		}
+
+		TArray<float> Margins;
+		Margins.SetNumUninitialized(NumQueries);
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumIterations; ++i)
+		{
+			Field.GetMargins(Positions, 0.0f, Margins);
+		}
+		const double ElapsedMs = 1000.0 * (FPlatformTime::Seconds() - StartTime) / NumIterations;
+
+		UE_LOG(LogTechnocrane, Display, TEXT("Technocrane reach field, %d x %d cells built in %.2f ms, %d queries: %.4f ms"),
+			Field.NumRadial, Field.NumHeight, BuildMs, NumQueries, ElapsedMs);
+	}
+
+	// measure the game thread part of a rig update, the input snapshot against building the camera input there as well
+	void RunGameThreadInputs(const int32 NumRigs, const int32 NumIterations)
+	{
+		FRandomStream RandomStream(NumRigs);
+		TArray<FTransform> CameraTransforms;
+		TArray<FTransform> OwnerTransforms;
+		CameraTransforms.SetNumUninitialized(NumRigs);
+		OwnerTransforms.SetNumUninitialized(NumRigs);
+
+		for (int32 i = 0; i < NumRigs; ++i)
+		{
+			CameraTransforms[i] = FTransform(FRotator(RandomStream.FRandRange(-30.0f, 30.0f), RandomStream.FRandRange(-180.0f, 180.0f), 0.0f),
+				FVector(RandomStream.FRandRange(-600.0f, 600.0f), RandomStream.FRandRange(-600.0f, 600.0f), RandomStream.FRandRange(0.0f, 400.0f)));
+			OwnerTransforms[i] = FTransform(FRotator(0.0f, RandomStream.FRandRange(-180.0f, 180.0f), 0.0f), FVector(i * 1500.0f, 0.0f, 0.0f));
+		}
+
+		TArray<FCraneRigGameThreadInputs> Inputs;
+		Inputs.SetNum(NumRigs);
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (int32 i = 0; i < NumRigs; ++i)
+			{
+				FCraneRigGameThreadInputs& Input = Inputs[i];
+				Input.CameraActorRotation = CameraTransforms[i].GetRotation();
+				Input.CameraLocation = CameraTransforms[i].GetLocation();
+				Input.OwnerLocation = OwnerTransforms[i].GetLocation();
+				Input.OwnerRotation = OwnerTransforms[i].GetRotation();
+				Input.OwnerScale = OwnerTransforms[i].GetScale3D();
+				Input.bHasTarget = true;
+			}
+		}
+		const double SnapshotMs = 1000.0 * (FPlatformTime::Seconds() - StartTime) / NumIterations;
+
+		TArray<FCraneRigSolverInput> CameraInputs;
+		CameraInputs.SetNum(NumRigs);
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (int32 i = 0; i < NumRigs; ++i)
+			{
+				FTechnocraneRigKinematics::MakeCameraInput(FTransform(CameraTransforms[i].GetRotation()), FTransform(CameraTransforms[i].GetLocation()),
+					FVector(0.0f, 0.0f, -20.0f), OwnerTransforms[i], CameraInputs[i]);
+			}
+		}
+		const double CameraInputMs = 1000.0 * (FPlatformTime::Seconds() - StartTime) / NumIterations;
+
+		UE_LOG(LogTechnocrane, Display, TEXT("Technocrane rig game thread inputs, %d rigs: snapshot %.4f ms, camera input moved to workers %.4f ms (%.3f us per rig)"),
+			NumRigs, SnapshotMs, CameraInputMs, 1000.0 * CameraInputMs / NumRigs);
+	}
+
+	void BenchmarkRigSolver(const TArray<FString>& Args)
+	{
+		// the first preset by default, or a given row name
+		const FName RowName = (Args.Num() > 0) ? FName(*Args[0]) : FTechnocraneRigKinematics::GetPresetRowName(0);
+
+		FCraneData Data;
+		FCraneRigGeometry Geometry;
+
+		if (!FTechnocraneRigKinematics::LoadPreset(RowName, Data, Geometry))
+		{
+			return;
+		}
+
+		const FCraneRigPreset Preset = FTechnocraneRigKinematics::MakePreset(Data);
+		const int32 NumRigsToTest[] = { 1, 16, 256, 4096 };
+
+		for (const int32 NumRigs : NumRigsToTest)
+		{
+			RunBatch(Geometry, Preset, NumRigs, 100);
+		}
+
+		RunReachQueries(Geometry, Preset, 4096, 100);
+		RunGameThreadInputs(256, 100);
+	}
+
+	// spawn a grid of crane rigs with target cameras, to profile update tiers with stat Technocrane
+	void SpawnRigBenchmark(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		const int32 NumRigs = (Args.Num() > 0) ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 1024) : 64;
+		const bool bHeroCrane = Args.Num() > 1 && Args[1].Equals(TEXT("hero"), ESearchCase::IgnoreCase);
+
+		const int32 NumColumns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumRigs)));
+		const float Spacing = 1500.0f;
+
+		FRandomStream RandomStream(NumRigs);
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		for (int32 i = 0; i < NumRigs; ++i)
+		{
+			const FVector Location((i % NumColumns) * Spacing, (i / NumColumns) * Spacing, 0.0f);
+
+			ATechnocraneRig* Rig = World->SpawnActor<ATechnocraneRig>(Location, FRotator::ZeroRotator, SpawnParams);
+			if (!Rig)
+			{
+				continue;
+			}
+
+			const FVector CameraLocation = Location + FVector(RandomStream.FRandRange(200.0f, 500.0f), RandomStream.FRandRange(-300.0f, 300.0f), RandomStream.FRandRange(100.0f, 400.0f));
+			ACineCameraActor* Camera = World->SpawnActor<ACineCameraActor>(CameraLocation, FRotator(RandomStream.FRandRange(-30.0f, 30.0f), 0.0f, 0.0f), SpawnParams);
+
+			Rig->bHeroCrane = bHeroCrane;
+			Rig->SetTargetActor(Camera);
+		}
+
+		// rig updates run on workers only with a parallel animation update, compare game thread and worker update counters
+		const IConsoleVariable* ParallelAnimUpdate = IConsoleManager::Get().FindConsoleVariable(TEXT("a.ParallelAnimUpdate"));
+		const bool bParallelAnimUpdate = ParallelAnimUpdate && ParallelAnimUpdate->GetInt() != 0;
+
+		UE_LOG(LogTechnocrane, Display, TEXT("Technocrane spawned %d rigs%s, parallel anim update %s, use stat Technocrane to watch update tiers"),
+			NumRigs, bHeroCrane ? TEXT(" (hero)") : TEXT(""), bParallelAnimUpdate ? TEXT("on") : TEXT("off"));
+	}
+
+	// spawn a grid of parked technocrane cameras, to compare calibration cost with and without idle sleep
+	void SpawnCameraBenchmark(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		const int32 NumCameras = (Args.Num() > 0) ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 4096) : 256;
+		const bool bSleepWhenIdle = Args.Num() > 1 && Args[1].Equals(TEXT("sleep"), ESearchCase::IgnoreCase);
+
+		const int32 NumColumns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumCameras)));
+		const float Spacing = 200.0f;
+
+		FRandomStream RandomStream(NumCameras);
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		for (int32 i = 0; i < NumCameras; ++i)
+		{
+			const FVector Location((i % NumColumns) * Spacing, (i / NumColumns) * Spacing, 200.0f);
+
+			ATDCamera* Camera = World->SpawnActor<ATDCamera>(Location, FRotator::ZeroRotator, SpawnParams);
+			UTechnocraneCameraComponent* CameraComp = (Camera) ? Camera->GetTechnocraneCameraComponent() : nullptr;
+
+			if (CameraComp)
+			{
+				// manual focus, so a parked camera is allowed to sleep
+				CameraComp->FocusSettings.FocusMethod = ECameraFocusMethod::Manual;
+				CameraComp->bSleepWhenIdle = bSleepWhenIdle;
+				CameraComp->SetRawLensValues(RandomStream.FRandRange(0.0f, 100.0f), RandomStream.FRandRange(0.0f, 100.0f), RandomStream.FRandRange(0.0f, 100.0f));
+			}
+		}
+
+		UE_LOG(LogTechnocrane, Display, TEXT("Technocrane spawned %d cameras%s, use stat Technocrane to watch calibrations"),
+			NumCameras, bSleepWhenIdle ? TEXT(" (sleep when idle)") : TEXT(""));
+	}
+
+	// compare a take stored as raw samples with the same take baked into a float channel per crane channel
+	void BenchmarkTakeSamples(const TArray<FString>& Args)
+	{
+		const int32 NumMinutes = (Args.Num() > 0) ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 600) : 60;
+		const int32 Rate = (Args.Num() > 1) ? FMath::Clamp(FCString::Atoi(*Args[1]), 1, 1000) : 100;
+		const int32 NumSamples = NumMinutes * 60 * Rate;
+		const int32 NumQueries = 100000;
+
+		const FFrameRate SampleRate(Rate, 1);
+		const FFrameRate TickResolution(24000, 1);
+		constexpr int32 NumChannels = FCraneTakeSamples::NumChannels;
+
+		// smooth crane moves with a bit of encoder noise
+		FRandomStream RandomStream(NumSamples);
+		FCraneTakeSamples Samples;
+		Samples.Reset(SampleRate, 0, NumSamples);
+
+		float Sample[NumChannels];
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			const float Seconds = static_cast<float>(i) / static_cast<float>(Rate);
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Sample[Channel] = 100.0f * FMath::Sin(Seconds * (0.05f + 0.01f * Channel)) + RandomStream.FRandRange(-0.01f, 0.01f);
+			}
+			Samples.AddSample(Sample);
+		}
+
+		SIZE_T CurvesSize = 0;
+		TArray<FMovieSceneFloatChannel> Curves;
+		Curves.SetNum(NumChannels);
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			TArray<FFrameNumber> Times;
+			TArray<FMovieSceneFloatValue> Values;
+			Times.Reserve(NumSamples);
+			Values.Reserve(NumSamples);
+
+			for (int32 i = 0; i < NumSamples; ++i)
+			{
+				FMovieSceneFloatValue Value(Samples.GetValue(i, static_cast<ECraneTakeChannel>(Channel)));
+				Value.InterpMode = RCIM_Linear;
+
+				Times.Add(FFrameRate::TransformTime(FFrameTime(i), SampleRate, TickResolution).FloorToFrame());
+				Values.Add(Value);
+			}
+
+			Curves[Channel].Set(Times, Values);
+			CurvesSize += Curves[Channel].GetTimes().Num() * sizeof(FFrameNumber) + Curves[Channel].GetValues().Num() * sizeof(FMovieSceneFloatValue);
+		}
+
+		// random times, like scrubbing or a parallel bake
+		TArray<FFrameTime> Times;
+		Times.SetNumUninitialized(NumQueries);
+		for (FFrameTime& Time : Times)
+		{
+			Time = FFrameTime::FromDecimal(RandomStream.FRandRange(0.0f, static_cast<float>(NumSamples - 1)));
+		}
+
+		float Checksum = 0.0f;
+		double StartTime = FPlatformTime::Seconds();
+		for (const FFrameTime& Time : Times)
+		{
+			Samples.Evaluate(Time, Sample);
+			Checksum += Sample[0];
+		}
+		const double SamplesMs = 1000.0 * (FPlatformTime::Seconds() - StartTime);
+
+		StartTime = FPlatformTime::Seconds();
+		for (const FFrameTime& Time : Times)
+		{
+			const FFrameTime CurveTime = FFrameRate::TransformTime(Time, SampleRate, TickResolution);
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Curves[Channel].Evaluate(CurveTime, Sample[Channel]);
+			}
+			Checksum -= Sample[0];
+		}
+		const double CurvesMs = 1000.0 * (FPlatformTime::Seconds() - StartTime);
+
+		UE_LOG(LogTechnocrane, Display, TEXT("Technocrane take of %d min at %d Hz, %d samples x %d channels"), NumMinutes, Rate, NumSamples, NumChannels);
+		UE_LOG(LogTechnocrane, Display, TEXT("  raw samples:    %.2f MB, %d evaluations %.3f ms"),
+			Samples.GetAllocatedSize() / (1024.0 * 1024.0), NumQueries, SamplesMs);
+		UE_LOG(LogTechnocrane, Display, TEXT("  float channels: %.2f MB, %d evaluations %.3f ms (checksum difference %f)"),
+			CurvesSize / (1024.0 * 1024.0), NumQueries, CurvesMs, Checksum);
+	}
+
+	// crane models that are in memory right now, with the size of their render and physics data
+	void ReportPreviewMeshes(const TArray<FString>& Args)
+	{
+		FTechnocranePresetRegistry& Registry = FTechnocranePresetRegistry::Get();
+
+		if (!Registry.Initialize())
+		{
+			return;
+		}
+
+		int32 NumLoaded = 0;
+		SIZE_T TotalBytes = 0;
+
+		for (int32 i = 0; i < Registry.Num(); ++i)
+		{
+			const FCranePresetEntryPtr Preset = Registry.Find(i);
+			USkeletalMesh* Mesh = (Preset) ? Cast<USkeletalMesh>(Preset->ModelPath.ResolveObject()) : nullptr;
+
+			if (!Mesh)
+			{
+				continue;
+			}
+
+			SIZE_T Bytes = Mesh->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+			if (UPhysicsAsset* PhysicsAsset = Mesh->GetPhysicsAsset())
+			{
+				Bytes += PhysicsAsset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+			}
+
+			UE_LOG(LogTechnocrane, Display, TEXT("  %s: %.2f MB"), *Preset->ModelPath.ToString(), Bytes / (1024.0 * 1024.0));
+
+			++NumLoaded;
+			TotalBytes += Bytes;
+		}
+
+		const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+
+		UE_LOG(LogTechnocrane, Display, TEXT("Technocrane crane models in memory %d of %d, %.2f MB, process used %.2f MB"),
+			NumLoaded, Registry.Num(), TotalBytes / (1024.0 * 1024.0), MemoryStats.UsedPhysical / (1024.0 * 1024.0));
+	}
+};
+
+static FAutoConsoleCommand GTechnocraneBenchmarkRigSolverCmd(
+	TEXT("Technocrane.BenchmarkRigSolver"),
+	TEXT("Measure the batch crane rig solver for 1, 16, 256 and 4096 rigs, reachability field queries and the game thread part of 256 rig updates. Optional argument is a crane preset row name."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&NTechnocraneRigBenchmark::BenchmarkRigSolver)
+);
+
+static FAutoConsoleCommandWithWorldAndArgs GTechnocraneSpawnRigBenchmarkCmd(
+	TEXT("Technocrane.SpawnRigBenchmark"),
+	TEXT("Spawn a grid of crane rigs with target cameras. Arguments: <Count> [hero], hero rigs always update at full rate."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&NTechnocraneRigBenchmark::SpawnRigBenchmark)
+);
+
+static FAutoConsoleCommandWithWorldAndArgs GTechnocraneSpawnCameraBenchmarkCmd(
+	TEXT("Technocrane.SpawnCameraBenchmark"),
+	TEXT("Spawn a grid of parked technocrane cameras. Arguments: <Count> [sleep], sleep lets idle cameras stop ticking."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&NTechnocraneRigBenchmark::SpawnCameraBenchmark)
+);
+
+static FAutoConsoleCommand GTechnocraneReportPreviewMeshesCmd(
+	TEXT("Technocrane.ReportPreviewMeshes"),
+	TEXT("List crane models that are in memory with the size of their mesh and physics data. Each rig logs the time to show its model on LogTechnocrane."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&NTechnocraneRigBenchmark::ReportPreviewMeshes)
+);
+
+static FAutoConsoleCommand GTechnocraneBenchmarkTakeSamplesCmd(
+	TEXT("Technocrane.BenchmarkTakeSamples"),
+	TEXT("Compare memory and evaluation time of a take stored as raw samples and as float channels. Arguments: [Minutes] [Rate], one hour at 100 Hz by default."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&NTechnocraneRigBenchmark::BenchmarkTakeSamples)
+);
@@ -14,9 +14,10 @@
 /// Anim instance proxy struct
 /////////////////////////////////
 
-FTechnocraneRigInstanceProxy::FTechnocraneRigInstanceProxy(UAnimInstance* InAnimInstance, FAnimNode_TechnocraneRig* InAnimNode)
+FTechnocraneRigInstanceProxy::FTechnocraneRigInstanceProxy(UAnimInstance* InAnimInstance, FAnimNode_TechnocraneRig* InAnimNode, FCraneSimulationOutput* InSimulationOutput)
 	: FAnimInstanceProxy(InAnimInstance),
-	AnimNode(InAnimNode)
+	AnimNode(InAnimNode),
+	SimulationOutput(InSimulationOutput)
 {
 }
 
@@ -34,7 +35,19 @@ void FTechnocraneRigInstanceProxy::PreUpdate(UAnimInstance* InAnimInstance, floa
 	if(InAnimInstance)
 	{
 		Super::PreUpdate(InAnimInstance, DeltaSeconds);
-				
+
+		// the cache is handed over only when it changes, the time is copied every frame
+		UTechnocraneRigAnimInstance* Instance = CastChecked<UTechnocraneRigAnimInstance>(InAnimInstance);
+		if (Instance->bPoseCacheChanged)
+		{
+			AnimNode->SetPoseCache(Instance->PoseCache, Instance->PoseCacheTime);
+			Instance->bPoseCacheChanged = false;
+		}
+		else
+		{
+			AnimNode->SetPoseCacheTime(Instance->PoseCacheTime);
+		}
+
 		if (AnimNode->HasPreUpdate())
 		{
 			AnimNode->PreUpdate(InAnimInstance);
@@ -60,7 +73,11 @@ bool FTechnocraneRigInstanceProxy::Evaluate(FPoseContext& Output)
 	
 	/* This evaluates UAnimNode_TechnocraneRig */
 	AnimNode->Evaluate_AnyThread(Output);
-	CraneData = AnimNode->OutCraneData;
+
+	if (SimulationOutput)
+	{
+		SimulationOutput->Publish(AnimNode->OutCraneData);
+	}
 	
 	return true;
 }
@@ -75,7 +92,7 @@ void FTechnocraneRigInstanceProxy::UpdateAnimationNode(const FAnimationUpdateCon
 	AnimNode->Update_AnyThread(InContext);
 }
 
-void FTechnocraneRigInstanceProxy::ConfigureAnimInstanceProxy(TWeakObjectPtr<AActor> InTargetActor, FCraneData& InCraneData, const FVector& InCameraPivotOffset, bool bShowDebug)
+void FTechnocraneRigInstanceProxy::ConfigureAnimInstanceProxy(TWeakObjectPtr<AActor> InTargetActor, const FCraneData& InCraneData, const FVector& InCameraPivotOffset, bool bShowDebug)
 {
 	if (ACineCameraActor* CineCamera = Cast<ACineCameraActor>(InTargetActor))
 	{
@@ -85,3 +102,9 @@ void FTechnocraneRigInstanceProxy::ConfigureAnimInstanceProxy(TWeakObjectPtr<AAc
 	AnimNode->CameraPivotOffset = InCameraPivotOffset;
 	AnimNode->bShowDebug = bShowDebug;
 }
+
+void FTechnocraneRigInstanceProxy::SetReachabilityField(UTechnocraneReachabilityField* InField, const float InWarningMargin)
+{
+	AnimNode->ReachabilityField = InField;
+	AnimNode->ReachWarningMargin = InWarningMargin;
+}
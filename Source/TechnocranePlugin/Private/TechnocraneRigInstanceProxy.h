@@ -26,7 +26,7 @@ public:
 
 	FTechnocraneRigInstanceProxy() = default; //Constructor
 	
-	FTechnocraneRigInstanceProxy(UAnimInstance* InAnimInstance, FAnimNode_TechnocraneRig* InAnimNode);
+	FTechnocraneRigInstanceProxy(UAnimInstance* InAnimInstance, FAnimNode_TechnocraneRig* InAnimNode, FCraneSimulationOutput* InSimulationOutput);
 	
 public:	
 	/* FAnimInstanceProxy Instance */ 
@@ -37,9 +37,11 @@ public:
 	virtual void UpdateAnimationNode(const FAnimationUpdateContext& InContext) override;
 	/* END FAnimInstanceProxy Instance */
 	
-	void ConfigureAnimInstanceProxy(TWeakObjectPtr<AActor> InTargetActor, FCraneData& InCraneData, const FVector& InCameraPivotOffset, bool bShowDebug);
+	void ConfigureAnimInstanceProxy(TWeakObjectPtr<AActor> InTargetActor, const FCraneData& InCraneData, const FVector& InCameraPivotOffset, bool bShowDebug);
+	void SetReachabilityField(UTechnocraneReachabilityField* InField, const float InWarningMargin);
 
 	FAnimNode_TechnocraneRig* AnimNode = nullptr;
-	FCraneSimulationData	CraneData;
+	/** simulation output is published here after every evaluation, owned by the anim instance */
+	FCraneSimulationOutput* SimulationOutput = nullptr;
 	
 };
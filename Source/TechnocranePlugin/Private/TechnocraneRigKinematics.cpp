@@ -0,0 +1,197 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneRigKinematics.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneRigKinematics.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneShared.h"
+#include "TechnocranePresetRegistry.h"
+#include "ReferenceSkeleton.h"
+#include "Engine/SkeletalMesh.h"
+#include "CineCameraActor.h"
+#include "CineCameraComponent.h"
+#include "TechnocraneCameraComponent.h"
+
+static_assert(static_cast<int32>(ECraneJoints::JointCount) == ECraneKinematicsJoint::Count, "Crane joints have to match between runtime and kinematics modules");
+static_assert(TECHNOCRANE_EXTENSION_BEAMS_COUNT == TECHNOCRANE_MAX_BEAMS_COUNT - 1, "Kinematics extends all beams except the first one");
+
+FCraneRigPreset FTechnocraneRigKinematics::MakePreset(const FCraneData& InCraneData)
+{
+	FCraneRigPreset Preset;
+	Preset.ZOffsetOnGround = InCraneData.ZOffsetOnGround;
+	Preset.TiltMin = InCraneData.TiltMin;
+	Preset.TiltMax = InCraneData.TiltMax;
+	return Preset;
+}
+
+FName FTechnocraneRigKinematics::GetPresetRowName(const int32 CraneModel)
+{
+	// rows in crane presets data table start from 1
+	return FName(*FString::FromInt(CraneModel + 1));
+}
+
+bool FTechnocraneRigKinematics::LoadPreset(const FName& RowName, FCraneData& OutCraneData, FCraneRigGeometry& OutGeometry)
+{
+	FTechnocranePresetRegistry& Registry = FTechnocranePresetRegistry::Get();
+	if (!Registry.Initialize())
+	{
+		return false;
+	}
+
+	// geometry comes with the preset, the crane model is loaded only when it's missing
+	for (int32 i = 0; i < Registry.Num(); ++i)
+	{
+		const FCranePresetEntryPtr Preset = Registry.Find(i);
+		if (!Preset || Preset->RowName != RowName)
+		{
+			continue;
+		}
+
+		const FCraneRigGeometryPtr Geometry = Registry.LoadGeometry(i);
+		if (!Geometry.IsValid() || !Geometry->IsValid())
+		{
+			return false;
+		}
+
+		OutCraneData = Preset->Data;
+		OutGeometry = *Geometry;
+		return true;
+	}
+
+	UE_LOG(LogTechnocrane, Warning, TEXT("Crane preset %s is missing"), *RowName.ToString());
+	return false;
+}
+
+bool FTechnocraneRigKinematics::BuildGeometry(FCraneRigGeometry& OutGeometry, const FReferenceSkeleton& RefSkeleton, const FName& InColumnRotationBone)
+{
+	const int32 NumBones = RefSkeleton.GetNum();
+
+	TArray<FName> BoneNames;
+	TArray<int32> ParentIndices;
+	BoneNames.SetNumUninitialized(NumBones);
+	ParentIndices.SetNumUninitialized(NumBones);
+
+	for (int32 i = 0; i < NumBones; ++i)
+	{
+		BoneNames[i] = RefSkeleton.GetBoneName(i);
+		ParentIndices[i] = RefSkeleton.GetParentIndex(i);
+	}
+
+	return BuildGeometry(OutGeometry, BoneNames, RefSkeleton.GetRefBonePose(), ParentIndices, InColumnRotationBone);
+}
+
+bool FTechnocraneRigKinematics::BuildGeometry(FCraneRigGeometry& OutGeometry, TArrayView<const FName> BoneNames, TArrayView<const FTransform> RefPose,
+	TArrayView<const int32> ParentIndices, const FName& InColumnRotationBone)
+{
+	int32 ColumnRotationBone = ECraneKinematicsJoint::Columns;
+	int32 JointBoneIndices[FCraneRigGeometry::JointCount];
+
+	for (int32 i = 0; i < FCraneRigGeometry::JointCount; ++i)
+	{
+		const ECraneJoints JointId = static_cast<ECraneJoints>(i);
+		const FName JointName(GetCraneJointName(JointId));
+
+		if (InColumnRotationBone == JointName)
+		{
+			ColumnRotationBone = i;
+		}
+
+		int32 JointRefIndex = BoneNames.Find(JointName);
+		if (JointRefIndex < 0 && JointId == ECraneJoints::Base)
+		{
+			JointRefIndex = 0; // make a default root bone as base in case the given joint name is not found
+		}
+		JointBoneIndices[i] = JointRefIndex;
+	}
+
+	return OutGeometry.Build(RefPose, ParentIndices, JointBoneIndices, ColumnRotationBone);
+}
+
+bool FTechnocraneRigKinematics::Evaluate(const FCraneData& InCraneData, const FCraneRigGeometry& Geometry, const FTransform& Target, const float TrackPosition,
+	FCraneRigPose& OutPose, FCraneSimulationData& OutData)
+{
+	if (!Geometry.IsValid())
+	{
+		return false;
+	}
+
+	const FCraneRigPreset Preset = MakePreset(InCraneData);
+
+	FCraneRigSolverInput Input;
+	Input.Target = Target.GetLocation();
+	Input.TrackPosition = TrackPosition;
+	Input.RawRotation = Target.Rotator().Euler();
+	Input.NeckQ = FQuat::MakeFromEuler(FVector(90.0, 0.0, 180.0 + Input.RawRotation.X));
+
+	FCraneRigSolution Solution;
+	FCraneRigSolver::Solve(Geometry, Preset, Input, Solution);
+	FCraneRigSolver::BuildPose(Geometry, Preset, TrackPosition, Solution, OutPose);
+
+	ToSimulationData(Solution, OutData);
+	return true;
+}
+
+void FTechnocraneRigKinematics::MakeCameraInput(const FTransform& CameraActorTransform, const FTransform& CameraTransform, const FVector& CameraPivotOffset,
+	const FTransform& OwnerTransform, FCraneRigSolverInput& OutInput)
+{
+	const FQuat ActorRotation = CameraActorTransform.GetRotation();
+
+	// add some camera pivot offset
+
+	FVector AdjOffset = ActorRotation.GetForwardVector() * CameraPivotOffset.X;
+	AdjOffset += -ActorRotation.GetRightVector() * CameraPivotOffset.Y;
+	AdjOffset += ActorRotation.GetUpVector() * CameraPivotOffset.Z;
+
+	const FVector TargetLocation = CameraTransform.GetLocation() + AdjOffset;
+
+	OutInput.RawRotation = ActorRotation.Rotator().Euler();
+	OutInput.NeckQ = FQuat::MakeFromEuler(FVector(90.0, 0.0, 180.0 + OutInput.RawRotation.X));
+
+	if (!CameraPivotOffset.IsNearlyZero(0.0001))
+	{
+		const FVector DirToCam = (CameraTransform.GetLocation() - TargetLocation).GetSafeNormal();
+		const FVector DirInPlane = DirToCam.GetSafeNormal2D();
+
+		const double AngleRad = FMath::Atan2(FVector::DotProduct(FVector::CrossProduct(FVector::ForwardVector, DirInPlane), FVector::UpVector),
+			FVector::DotProduct(DirInPlane, FVector::ForwardVector));
+
+		OutInput.NeckQ = FQuat::MakeFromEuler(FVector(90.0, 0.0, 90.0 + FMath::RadiansToDegrees(AngleRad)));
+	}
+
+	OutInput.Target = OwnerTransform.InverseTransformPosition(TargetLocation);
+}
+
+bool FTechnocraneRigKinematics::MakeTargetInput(const AActor* TargetActor, const FVector& CameraPivotOffset, const FTransform& OwnerTransform,
+	const float DefaultTrackPosition, FCraneRigSolverInput& OutInput)
+{
+	const ACineCameraActor* CameraActor = Cast<ACineCameraActor>(TargetActor);
+	if (!CameraActor)
+	{
+		return false;
+	}
+
+	FTransform CameraTransform = CameraActor->GetTransform();
+	OutInput.TrackPosition = DefaultTrackPosition;
+
+	if (const UCineCameraComponent* CameraComp = CameraActor->GetCineCameraComponent())
+	{
+		CameraTransform = CameraComp->GetRelativeTransform() * CameraTransform;
+	}
+	if (const UTechnocraneCameraComponent* CameraComp = Cast<UTechnocraneCameraComponent>(CameraActor->GetCineCameraComponent()))
+	{
+		OutInput.TrackPosition = CameraComp->TrackPos;
+	}
+
+	MakeCameraInput(CameraActor->GetTransform(), CameraTransform, CameraPivotOffset, OwnerTransform, OutInput);
+	return true;
+}
+
+void FTechnocraneRigKinematics::ToSimulationData(const FCraneRigSolution& Solution, FCraneSimulationData& OutData)
+{
+	OutData.GroundHeight = Solution.GroundHeight;
+	OutData.TiltAngle = Solution.TiltAngle;
+	OutData.ExtensionLength = Solution.ExtensionLength;
+}
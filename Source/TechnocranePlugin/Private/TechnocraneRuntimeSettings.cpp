@@ -22,6 +22,18 @@ UTechnocraneRuntimeSettings::UTechnocraneRuntimeSettings()
 	NetworkPortIdByDefault = 15246;
 	SpaceScaleByDefault = 100.0f;
 	bPacketContainsRawAndCalibratedData = false;
+	bPublishSharedSamples = false;
+	bMulticastSamples = false;
+	MulticastEndpoint = "239.255.42.99:15247";
+	MulticastTtl = 1;
+	bFreeDOutput = false;
+	FreeDOutputEndpoint = "127.0.0.1:40000";
+	FreeDInputEndpoint = "0.0.0.0:40001";
+	FreeDLensEncoding = ECraneFreeDLensEncoding::EncoderCounts;
+	FreeDEncoderScale = 1000.0f;
+	FreeDCameraId = 1;
+	ClusterSampleDelay = 1;
+	ClusterSampleWaitTime = 4.0f;
 
 	ZoomRange = FFloatInterval(0.0f, 100.0f);
 	FocusRange = FFloatInterval(0.0f, 100.0f);
@@ -0,0 +1,286 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSampleMulticast.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneSampleMulticast.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneFreeD.h"
+
+#include "Common/UdpSocketBuilder.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/RunnableThread.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+namespace NTechnocraneSampleDatagram
+{
+	struct FWriter
+	{
+		uint8* Data;
+		int32 Offset{ 0 };
+
+		void U8(const uint8 Value) { Data[Offset++] = Value; }
+		void U16(const uint16 Value) { U8(Value & 0xFF); U8(Value >> 8); }
+		void U32(const uint32 Value) { U16(Value & 0xFFFF); U16(Value >> 16); }
+		void F32(const float Value) { uint32 Bits; FMemory::Memcpy(&Bits, &Value, sizeof(Bits)); U32(Bits); }
+	};
+
+	struct FReader
+	{
+		const uint8* Data;
+		int32 Offset{ 0 };
+
+		uint8 U8() { return Data[Offset++]; }
+		uint16 U16() { const uint16 Low = U8(); return Low | static_cast<uint16>(U8() << 8); }
+		uint32 U32() { const uint32 Low = U16(); return Low | (static_cast<uint32>(U16()) << 16); }
+		float F32() { const uint32 Bits = U32(); float Value; FMemory::Memcpy(&Value, &Bits, sizeof(Value)); return Value; }
+	};
+
+	void Encode(const NTechnocraneShared::SSample& Sample, const FCraneRawValues& Raw, const uint32 Sequence, uint8 (&OutData)[Size])
+	{
+		FWriter Writer{ OutData };
+
+		Writer.U32(Magic);
+		Writer.U8(Version);
+		Writer.U8(0);
+		Writer.U16(static_cast<uint16>(Sample.Flags));
+		Writer.U32(Sequence);
+		Writer.U32(static_cast<uint32>(Sample.PacketNumber));
+		Writer.U32(Sample.Timecode);
+
+		for (const float Value : Sample.Location) { Writer.F32(Value); }
+		for (const float Value : Sample.Rotation) { Writer.F32(Value); }
+
+		Writer.F32(Sample.TrackPosition);
+		Writer.F32(Sample.FocalLength);
+		Writer.F32(Sample.FocusDistance);
+		Writer.F32(Sample.Aperture);
+
+		for (const float Value : Raw.Position) { Writer.F32(Value); }
+		Writer.F32(Raw.Pan);
+		Writer.F32(Raw.Tilt);
+		Writer.F32(Raw.Roll);
+
+		check(Writer.Offset == Size);
+	}
+
+	bool Decode(const uint8* Data, const int32 DataSize, NTechnocraneShared::SSample& OutSample, FCraneRawValues& OutRaw, uint32& OutSequence)
+	{
+		if (DataSize != Size)
+		{
+			return false;
+		}
+
+		FReader Reader{ Data };
+
+		if (Reader.U32() != Magic || Reader.U8() != Version)
+		{
+			return false;
+		}
+
+		Reader.U8();
+		OutSample.Flags = Reader.U16();
+		OutSequence = Reader.U32();
+		OutSample.PacketNumber = static_cast<int32>(Reader.U32());
+		OutSample.Timecode = Reader.U32();
+
+		for (float& Value : OutSample.Location) { Value = Reader.F32(); }
+		for (float& Value : OutSample.Rotation) { Value = Reader.F32(); }
+
+		OutSample.TrackPosition = Reader.F32();
+		OutSample.FocalLength = Reader.F32();
+		OutSample.FocusDistance = Reader.F32();
+		OutSample.Aperture = Reader.F32();
+
+		for (float& Value : OutRaw.Position) { Value = Reader.F32(); }
+		OutRaw.Pan = Reader.F32();
+		OutRaw.Tilt = Reader.F32();
+		OutRaw.Roll = Reader.F32();
+		return true;
+	}
+};
+
+FCraneSampleMulticastSender::~FCraneSampleMulticastSender()
+{
+	Stop();
+
+	if (Thread)
+	{
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (WorkEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+		WorkEvent = nullptr;
+	}
+
+	if (Socket)
+	{
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		Socket = nullptr;
+	}
+}
+
+bool FCraneSampleMulticastSender::Start(const FIPv4Endpoint& InEndpoint, const int32 Ttl, const ECraneSampleFormat InFormat, const uint8 InCameraId,
+	const NTechnocraneFreeD::FLensEncoding& InLensEncoding)
+{
+	check(!IsStarted());
+
+	Endpoint = InEndpoint;
+	Format = InFormat;
+	CameraId = InCameraId;
+	LensEncoding = InLensEncoding;
+	Socket = FUdpSocketBuilder(TEXT("Technocrane Multicast Sender"))
+		.AsReusable()
+		.WithMulticastLoopback()
+		.WithMulticastTtl(static_cast<uint8>(FMath::Clamp(Ttl, 1, 255)))
+		.Build();
+
+	if (!Socket)
+	{
+		UE_LOG(LogTechnocrane, Warning, TEXT("Failed to create a socket to send crane samples to %s"), *Endpoint.ToString());
+		return false;
+	}
+
+	WorkEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, TEXT("Technocrane Multicast Sender"), 64 * 1024, TPri_AboveNormal);
+
+	UE_LOG(LogTechnocrane, Log, TEXT("Crane samples are sent to %s"), *Endpoint.ToString());
+	return Thread != nullptr;
+}
+
+void FCraneSampleMulticastSender::Enqueue(const NTechnocraneShared::SSample& Sample, const FCraneRawValues& Raw)
+{
+	if (NumPending.load(std::memory_order_relaxed) >= MaxPendingSamples)
+	{
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	Pending.Enqueue(FPendingSample{ Sample, Raw });
+	NumPending.fetch_add(1, std::memory_order_release);
+	WorkEvent->Trigger();
+}
+
+uint32 FCraneSampleMulticastSender::Run()
+{
+	const TSharedRef<FInternetAddr> Address = Endpoint.ToInternetAddr();
+
+	uint8 Data[NTechnocraneSampleDatagram::Size];
+	uint8 FreeDData[NTechnocraneFreeD::Size];
+	FPendingSample Item;
+
+	while (!bStopping)
+	{
+		WorkEvent->Wait(FTimespan::FromMilliseconds(100));
+
+		while (Pending.Dequeue(Item))
+		{
+			NumPending.fetch_sub(1, std::memory_order_relaxed);
+			int32 BytesSent = 0;
+
+			if (Format == ECraneSampleFormat::FreeD)
+			{
+				NTechnocraneFreeD::Encode(Item.Sample, Item.Raw, LensEncoding, CameraId, FreeDData);
+				Socket->SendTo(FreeDData, NTechnocraneFreeD::Size, BytesSent, *Address);
+			}
+			else
+			{
+				NTechnocraneSampleDatagram::Encode(Item.Sample, Item.Raw, Sequence++, Data);
+				Socket->SendTo(Data, NTechnocraneSampleDatagram::Size, BytesSent, *Address);
+			}
+		}
+	}
+	return 0;
+}
+
+void FCraneSampleMulticastSender::Stop()
+{
+	bStopping = true;
+
+	if (WorkEvent)
+	{
+		WorkEvent->Trigger();
+	}
+}
+
+namespace NTechnocraneSampleMulticast
+{
+	// send samples through the sender thread to a loopback port and check every received datagram
+	void TestLoopback(const TArray<FString>& Args)
+	{
+		const int32 NumSamples = (Args.Num() > 0) ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 100000) : 1000;
+		const FIPv4Endpoint Endpoint(FIPv4Address(127, 0, 0, 1), (Args.Num() > 1) ? static_cast<uint16>(FCString::Atoi(*Args[1])) : 15248);
+
+		FSocket* Socket = FUdpSocketBuilder(TEXT("Technocrane Loopback Receiver"))
+			.BoundToEndpoint(Endpoint)
+			.WithReceiveBufferSize(1024 * 1024)
+			.Build();
+
+		if (!Socket)
+		{
+			UE_LOG(LogTechnocrane, Warning, TEXT("Failed to bind %s for a loopback test"), *Endpoint.ToString());
+			return;
+		}
+
+		int32 NumReceived = 0;
+		int32 NumMismatched = 0;
+		{
+			FCraneSampleMulticastSender Sender;
+			Sender.Start(Endpoint, 1);
+
+			NTechnocraneShared::SSample Sample;
+			FMemory::Memzero(Sample);
+			FCraneRawValues Raw;
+
+			uint8 Data[NTechnocraneSampleDatagram::Size + 1];
+			TSharedRef<FInternetAddr> From = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+
+			for (int32 i = 0; i < NumSamples; ++i)
+			{
+				Sample.PacketNumber = i;
+				Sample.TrackPosition = 0.5f * i;
+				Raw.Pan = 0.25f * i;
+				Sender.Enqueue(Sample, Raw);
+
+				// a datagram per sample keeps the queue short
+				while (Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds((i + 1 < NumSamples) ? 0 : 100)))
+				{
+					int32 BytesRead = 0;
+					if (!Socket->RecvFrom(Data, sizeof(Data), BytesRead, *From))
+					{
+						break;
+					}
+
+					NTechnocraneShared::SSample Received;
+					FCraneRawValues ReceivedRaw;
+					uint32 Sequence = 0;
+
+					const bool bDecoded = NTechnocraneSampleDatagram::Decode(Data, BytesRead, Received, ReceivedRaw, Sequence);
+					NumMismatched += (!bDecoded || Received.TrackPosition != 0.5f * Received.PacketNumber || ReceivedRaw.Pan != 0.25f * Received.PacketNumber) ? 1 : 0;
+					++NumReceived;
+				}
+			}
+
+			UE_LOG(LogTechnocrane, Display, TEXT("Technocrane multicast loopback on %s: %d samples sent, %d received, %d mismatched, %u dropped by the sender"),
+				*Endpoint.ToString(), NumSamples, NumReceived, NumMismatched, Sender.GetNumDropped());
+		}
+
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+	}
+};
+
+static FAutoConsoleCommand GTechnocraneMulticastLoopbackCmd(
+	TEXT("Technocrane.MulticastLoopback"),
+	TEXT("Send crane sample datagrams through the multicast sender to a loopback port and check what is received. Arguments: [Samples] [Port], 1000 samples to 15248 by default."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&NTechnocraneSampleMulticast::TestLoopback)
+);
@@ -0,0 +1,101 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSampleMulticast.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "LiveLinkTechnocraneTypes.h"
+#include "TechnocraneFreeD.h"
+#include "TechnocraneSharedSamples.h"
+
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+class FSocket;
+
+/**
+ * A datagram of a decoded crane sample, little endian with a fixed layout:
+ *  magic, version, flags, sequence, packet number, timecode, location, rotation, track position, focal length, focus distance, aperture,
+ *  then raw crane position, pan, tilt and roll
+ */
+namespace NTechnocraneSampleDatagram
+{
+	constexpr uint32 Magic = 0x534D4354;
+	constexpr uint8 Version = 2;
+	constexpr int32 Size = 84;
+
+	void Encode(const NTechnocraneShared::SSample& Sample, const FCraneRawValues& Raw, const uint32 Sequence, uint8 (&OutData)[Size]);
+	/** false for a datagram of another size, magic or version */
+	bool Decode(const uint8* Data, const int32 DataSize, NTechnocraneShared::SSample& OutSample, FCraneRawValues& OutRaw, uint32& OutSequence);
+};
+
+/** a wire format of sample datagrams */
+enum class ECraneSampleFormat : uint8
+{
+	/** NTechnocraneSampleDatagram */
+	Technocrane,
+	/** FreeD D1 message */
+	FreeD
+};
+
+/**
+ * Sends decoded samples as datagrams to a multicast group (or any udp endpoint) from its own thread.
+ *  The receiver thread only queues a sample, a slow network drops samples instead of holding the receiver.
+ */
+class FCraneSampleMulticastSender : public FRunnable
+{
+public:
+	/** samples waiting for the sender thread, newer samples are dropped above it */
+	static constexpr int32 MaxPendingSamples = 64;
+
+	FCraneSampleMulticastSender() = default;
+	virtual ~FCraneSampleMulticastSender();
+
+	/** @param InCameraId and InLensEncoding of FreeD messages, not used by other formats */
+	bool Start(const FIPv4Endpoint& InEndpoint, const int32 Ttl, const ECraneSampleFormat InFormat = ECraneSampleFormat::Technocrane, const uint8 InCameraId = 0,
+		const NTechnocraneFreeD::FLensEncoding& InLensEncoding = NTechnocraneFreeD::FLensEncoding());
+	bool IsStarted() const { return Thread != nullptr; }
+
+	/** single producer, called on the receiver thread */
+	void Enqueue(const NTechnocraneShared::SSample& Sample, const FCraneRawValues& Raw);
+
+	uint32 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+	// FRunnable interface
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	FIPv4Endpoint Endpoint;
+	ECraneSampleFormat Format{ ECraneSampleFormat::Technocrane };
+	uint8 CameraId{ 0 };
+	NTechnocraneFreeD::FLensEncoding LensEncoding;
+
+	FSocket* Socket{ nullptr };
+	FRunnableThread* Thread{ nullptr };
+	FEvent* WorkEvent{ nullptr };
+	FThreadSafeBool bStopping{ false };
+
+	struct FPendingSample
+	{
+		NTechnocraneShared::SSample Sample;
+		FCraneRawValues Raw;
+	};
+
+	TQueue<FPendingSample, EQueueMode::Spsc> Pending;
+	std::atomic<int32> NumPending{ 0 };
+	std::atomic<uint32> NumDropped{ 0 };
+
+	/** incremented by the sender thread, receivers detect lost datagrams with it */
+	uint32 Sequence{ 0 };
+};
@@ -0,0 +1,113 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSampleRing.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneSampleRing.h"
+#include "TechnocranePrivatePCH.h"
+
+#include "Algo/Sort.h"
+#include "HAL/Event.h"
+#include "Misc/ScopeLock.h"
+
+FCraneSampleRing::FCraneSampleRing()
+{
+	AddedEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FCraneSampleRing::~FCraneSampleRing()
+{
+	FPlatformProcess::ReturnSynchEventToPool(AddedEvent);
+	AddedEvent = nullptr;
+}
+
+FCraneSampleKey FCraneSampleRing::MakeKey(const NTechnocrane::STechnocrane_Packet& Packet)
+{
+	FCraneSampleKey Key;
+	Key.PacketNumber = static_cast<int32>(Packet.PacketNumber);
+
+	if (Packet.HasTimeCode())
+	{
+		Key.Timecode = ((Packet.hours & 0xFF) << 24) | ((Packet.minutes & 0xFF) << 16) | ((Packet.seconds & 0xFF) << 8) | (Packet.frames & 0xFF);
+	}
+	return Key;
+}
+
+void FCraneSampleRing::Add(const NTechnocrane::STechnocrane_Packet& Packet)
+{
+	const FCraneSampleKey Key = MakeKey(Packet);
+
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		Keys[Head] = Key;
+		Packets[Head] = Packet;
+
+		Head = (Head + 1) % Capacity;
+		Count = FMath::Min(Count + 1, Capacity);
+	}
+
+	AddedEvent->Trigger();
+}
+
+void FCraneSampleRing::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+
+	Head = 0;
+	Count = 0;
+}
+
+FCraneSampleKey FCraneSampleRing::GetLatest(const int32 Delay) const
+{
+	// packets could come out of order, the order is by the key and not by arrival
+	TArray<FCraneSampleKey, TInlineAllocator<Capacity>> SortedKeys;
+	{
+		FScopeLock ScopeLock(&Lock);
+		SortedKeys.Append(Keys, Count);
+	}
+
+	if (Delay >= SortedKeys.Num())
+	{
+		return FCraneSampleKey();
+	}
+
+	Algo::Sort(SortedKeys);
+	return SortedKeys[SortedKeys.Num() - 1 - Delay];
+}
+
+bool FCraneSampleRing::Find(const FCraneSampleKey& Key, NTechnocrane::STechnocrane_Packet& OutPacket) const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	// the latest packets are the most likely ones
+	for (int32 i = 1; i <= Count; ++i)
+	{
+		const int32 Index = (Head - i + Capacity) % Capacity;
+		if (Keys[Index] == Key)
+		{
+			OutPacket = Packets[Index];
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FCraneSampleRing::WaitFor(const FCraneSampleKey& Key, const double TimeoutSeconds, NTechnocrane::STechnocrane_Packet& OutPacket) const
+{
+	const double EndTime = FPlatformTime::Seconds() + TimeoutSeconds;
+
+	// an auto reset event stays triggered by a sample added between the lookup and the wait
+	while (!Find(Key, OutPacket))
+	{
+		const double RemainingSeconds = EndTime - FPlatformTime::Seconds();
+		if (RemainingSeconds <= 0.0)
+		{
+			return false;
+		}
+		AddedEvent->Wait(FTimespan::FromSeconds(RemainingSeconds));
+	}
+	return true;
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSampleRing.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "TechnocraneClusterSamples.h"
+
+#include <technocrane_hardware.h>
+
+class FEvent;
+
+/**
+ * Last received crane packets, written by the receiver thread and looked up by a sample key on the game thread.
+ *  The oldest packet is overwritten, a second of samples at 100 Hz is kept with some headroom.
+ */
+class FCraneSampleRing
+{
+public:
+	static constexpr int32 Capacity = 256;
+
+	FCraneSampleRing();
+	~FCraneSampleRing();
+
+	FCraneSampleRing(const FCraneSampleRing&) = delete;
+	FCraneSampleRing& operator=(const FCraneSampleRing&) = delete;
+
+	static FCraneSampleKey MakeKey(const NTechnocrane::STechnocrane_Packet& Packet);
+
+	void Add(const NTechnocrane::STechnocrane_Packet& Packet);
+	void Reset();
+
+	/** the latest sample key, Delay latest samples are skipped, invalid when not enough samples are received */
+	FCraneSampleKey GetLatest(const int32 Delay) const;
+
+	bool Find(const FCraneSampleKey& Key, NTechnocrane::STechnocrane_Packet& OutPacket) const;
+	/** the same as Find, sleeps until a new sample is added, up to a timeout, for a sample that is not received yet */
+	bool WaitFor(const FCraneSampleKey& Key, const double TimeoutSeconds, NTechnocrane::STechnocrane_Packet& OutPacket) const;
+
+private:
+	mutable FCriticalSection Lock;
+	/** triggered by every added sample, wakes up a waiting lookup */
+	FEvent* AddedEvent{ nullptr };
+
+	FCraneSampleKey Keys[Capacity];
+	NTechnocrane::STechnocrane_Packet Packets[Capacity];
+
+	/** the next entry to write */
+	int32 Head{ 0 };
+	int32 Count{ 0 };
+};
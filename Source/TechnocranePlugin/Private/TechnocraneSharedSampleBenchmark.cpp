@@ -0,0 +1,158 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSharedSampleBenchmark.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneSharedSamplePublisher.h"
+#include "TechnocranePrivatePCH.h"
+
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+
+// the reader is the same header that other processes include
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#endif
+#include "TechnocraneSharedSampleReader.h"
+#if PLATFORM_WINDOWS
+#include "Windows/HideWindowsPlatformTypes.h"
+#endif
+
+namespace NTechnocraneSharedSampleBenchmark
+{
+	const char* SourceId = "Benchmark";
+
+	struct FReaderResult
+	{
+		uint64 NumRead{ 0 };
+		uint64 NumLost{ 0 };
+		/** samples with fields of different writes, the sequence check has to keep it zero */
+		uint64 NumTorn{ 0 };
+		double SumLatency{ 0.0 };
+		double MaxLatency{ 0.0 };
+	};
+
+	// every field of a sample is derived from the index to catch a torn read
+	void MakeSample(const uint64 Index, NTechnocraneShared::SSample& Sample)
+	{
+		Sample.PacketNumber = static_cast<int32>(Index);
+		Sample.TrackPosition = static_cast<float>(Index & 0xFFFFF);
+		Sample.Location[0] = Sample.Location[1] = Sample.Location[2] = Sample.TrackPosition;
+		Sample.WorldTime = FPlatformTime::Seconds();
+	}
+
+	bool IsTorn(const NTechnocraneShared::SSample& Sample)
+	{
+		const float Value = static_cast<float>(Sample.PacketNumber & 0xFFFFF);
+		return Sample.TrackPosition != Value || Sample.Location[0] != Value || Sample.Location[2] != Value;
+	}
+
+	/** publish samples for a duration, a zero interval publishes as fast as possible */
+	void Run(const int32 NumReaders, const double Duration, const double Interval)
+	{
+		FCraneSharedSamplePublisher Publisher;
+		if (!Publisher.Open(FString(SourceId)))
+		{
+			return;
+		}
+
+		std::atomic<bool> bStop{ false };
+		std::atomic<int32> NumOpened{ 0 };
+
+		TArray<TFuture<FReaderResult>> Readers;
+		for (int32 i = 0; i < NumReaders; ++i)
+		{
+			Readers.Add(Async(EAsyncExecution::Thread, [&bStop, &NumOpened]()
+			{
+				FReaderResult Result;
+				NTechnocraneShared::CSampleReader Reader;
+
+				const bool bOpened = Reader.Open(SourceId);
+				++NumOpened;
+
+				if (!bOpened)
+				{
+					return Result;
+				}
+
+				NTechnocraneShared::SSample Sample;
+				while (!bStop.load(std::memory_order_relaxed))
+				{
+					while (Reader.ReadNext(Sample))
+					{
+						const double Latency = FPlatformTime::Seconds() - Sample.WorldTime;
+						Result.SumLatency += Latency;
+						Result.MaxLatency = FMath::Max(Result.MaxLatency, Latency);
+						Result.NumTorn += (IsTorn(Sample)) ? 1 : 0;
+						++Result.NumRead;
+					}
+					FPlatformProcess::YieldThread();
+				}
+
+				Result.NumLost = Reader.GetNumLost();
+				return Result;
+			}));
+		}
+
+		while (NumOpened.load() < NumReaders)
+		{
+			FPlatformProcess::YieldThread();
+		}
+
+		NTechnocraneShared::SSample Sample;
+		FMemory::Memzero(Sample);
+
+		uint64 NumPublished = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		double NextTime = StartTime;
+
+		for (double Time = StartTime; Time - StartTime < Duration; Time = FPlatformTime::Seconds())
+		{
+			if (Time < NextTime)
+			{
+				continue;
+			}
+
+			MakeSample(NumPublished++, Sample);
+			Publisher.Publish(Sample);
+			NextTime += Interval;
+		}
+
+		const double PublishSeconds = FPlatformTime::Seconds() - StartTime;
+
+		// readers catch up with the last samples
+		FPlatformProcess::Sleep(0.01f);
+		bStop = true;
+
+		UE_LOG(LogTechnocrane, Display, TEXT("Shared crane samples, %s, %d readers: %llu samples published, %.1f ns per sample"),
+			(Interval > 0.0) ? *FString::Printf(TEXT("%.0f Hz"), 1.0 / Interval) : TEXT("unthrottled"), NumReaders,
+			NumPublished, 1e9 * PublishSeconds / FMath::Max<uint64>(NumPublished, 1));
+
+		for (int32 i = 0; i < Readers.Num(); ++i)
+		{
+			const FReaderResult Result = Readers[i].Get();
+
+			UE_LOG(LogTechnocrane, Display, TEXT("  reader %d: %llu read, %llu lost, %llu torn, latency %.2f us average, %.2f us max"),
+				i, Result.NumRead, Result.NumLost, Result.NumTorn,
+				1e6 * Result.SumLatency / FMath::Max<uint64>(Result.NumRead, 1), 1e6 * Result.MaxLatency);
+		}
+	}
+
+	void BenchmarkSharedSamples(const TArray<FString>& Args)
+	{
+		const int32 NumReaders = (Args.Num() > 0) ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 64) : 4;
+		const double Duration = (Args.Num() > 1) ? FMath::Clamp(FCString::Atod(*Args[1]), 0.1, 60.0) : 2.0;
+
+		// the ring throughput, then a rate of a fast crane stream
+		Run(NumReaders, Duration, 0.0);
+		Run(NumReaders, Duration, 0.001);
+	}
+};
+
+static FAutoConsoleCommand GTechnocraneBenchmarkSharedSamplesCmd(
+	TEXT("Technocrane.BenchmarkSharedSamples"),
+	TEXT("Publish crane samples into a shared memory ring and read them from reader threads. Arguments: [Readers] [Seconds], 4 readers for 2 seconds by default."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&NTechnocraneSharedSampleBenchmark::BenchmarkSharedSamples)
+);
@@ -0,0 +1,62 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSharedSamplePublisher.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneSharedSamplePublisher.h"
+#include "TechnocranePrivatePCH.h"
+
+bool FCraneSharedSamplePublisher::Open(const FString& SourceId, const uint32 Capacity)
+{
+	using namespace NTechnocraneShared;
+
+	Close();
+
+	const FString RegionName = MakeRegionName(SourceId);
+	const SIZE_T RegionSize = GetRegionSize(Capacity);
+
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(RegionName, true, FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write, RegionSize);
+	if (!Region)
+	{
+		UE_LOG(LogTechnocrane, Warning, TEXT("Failed to create a shared memory region %s for crane samples"), *RegionName);
+		return false;
+	}
+
+	// readers check the magic number, it goes last
+	Header = static_cast<SHeader*>(Region->GetAddress());
+	FMemory::Memzero(Header, RegionSize);
+
+	Header->Version = Version;
+	Header->Capacity = Capacity;
+	Header->SlotSize = sizeof(SSlot);
+	Header->Count.store(0, std::memory_order_relaxed);
+
+	std::atomic_thread_fence(std::memory_order_release);
+	Header->Magic = Magic;
+
+	NextIndex = 0;
+
+	UE_LOG(LogTechnocrane, Log, TEXT("Crane samples are published into a shared memory region %s"), *RegionName);
+	return true;
+}
+
+void FCraneSharedSamplePublisher::Close()
+{
+	if (Region)
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+	}
+
+	Region = nullptr;
+	Header = nullptr;
+}
+
+void FCraneSharedSamplePublisher::Publish(const NTechnocraneShared::SSample& Sample)
+{
+	check(IsOpen());
+
+	NTechnocraneShared::WriteSample(Header, NextIndex, Sample);
+	++NextIndex;
+}
@@ -0,0 +1,41 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSharedSamplePublisher.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformMemory.h"
+#include "TechnocraneSharedSamples.h"
+
+/**
+ * Writes decoded crane samples into a named shared memory ring, see TechnocraneSharedSamples.h for the layout.
+ *  There is only one writer of a region, samples are published from the receiver thread.
+ */
+class TECHNOCRANEPLUGIN_API FCraneSharedSamplePublisher
+{
+public:
+	FCraneSharedSamplePublisher() = default;
+	FCraneSharedSamplePublisher(const FCraneSharedSamplePublisher&) = delete;
+	FCraneSharedSamplePublisher& operator=(const FCraneSharedSamplePublisher&) = delete;
+	~FCraneSharedSamplePublisher() { Close(); }
+
+	/** create a region for a crane source id, readers open it with the same id */
+	bool Open(const FString& SourceId, const uint32 Capacity = NTechnocraneShared::DefaultCapacity);
+	void Close();
+
+	bool IsOpen() const { return Header != nullptr; }
+
+	void Publish(const NTechnocraneShared::SSample& Sample);
+
+	static FString MakeRegionName(const FString& SourceId) { return FString(NTechnocraneShared::RegionPrefix) + SourceId; }
+
+private:
+	FPlatformMemory::FSharedMemoryRegion* Region{ nullptr };
+	NTechnocraneShared::SHeader* Header{ nullptr };
+
+	uint64 NextIndex{ 0 };
+};
@@ -0,0 +1,118 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSimulationComponent.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneSimulationComponent.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneRigKinematics.h"
+#include "TechnocraneReachabilityField.h"
+#include "TechnocraneStats.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(TechnocraneSimulationComponent)
+
+DECLARE_CYCLE_STAT(TEXT("Technocrane Simulation Component"), STAT_TechnocraneSimulationComponent, STATGROUP_Technocrane);
+
+UTechnocraneSimulationComponent::UTechnocraneSimulationComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	// cameras are moved by then
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+void UTechnocraneSimulationComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	UpdatePreset();
+}
+
+void UTechnocraneSimulationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Simulate();
+}
+
+#if WITH_EDITOR
+void UTechnocraneSimulationComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	UpdatePreset();
+}
+#endif
+
+void UTechnocraneSimulationComponent::UpdatePreset()
+{
+	if (LastCraneModel != CraneModel)
+	{
+		FTechnocranePresetRegistry& Registry = FTechnocranePresetRegistry::Get();
+
+		Preset = (Registry.Initialize()) ? Registry.Find(CraneModel) : nullptr;
+		Geometry = (Preset) ? Registry.LoadGeometry(CraneModel) : nullptr;
+		LastCraneModel = CraneModel;
+
+		Pose = FCraneRigPose();
+	}
+	else if (LastReachabilityField.Get() == ReachabilityField.Get())
+	{
+		return;
+	}
+
+	// margins of a field made for another crane or for older preset data would be wrong
+	LastReachabilityField = ReachabilityField;
+	ActiveReachabilityField = (Preset && Geometry.IsValid())
+		? UTechnocraneReachabilityField::ResolveFor(ReachabilityField, this, CraneModel, *Geometry, Preset->Preset, ActiveReachabilityField)
+		: nullptr;
+}
+
+bool UTechnocraneSimulationComponent::Simulate()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TechnocraneSimulationComponent);
+
+	// the crane model could be changed from blueprints
+	UpdatePreset();
+
+	if (!Preset || !Geometry.IsValid() || !Geometry->IsValid())
+	{
+		return false;
+	}
+
+	FCraneRigSolverInput Input;
+	if (!FTechnocraneRigKinematics::MakeTargetInput(TargetActor, CameraPivotOffset, GetComponentTransform(), TrackPosition, Input))
+	{
+		return false;
+	}
+
+	FCraneRigSolution Solution;
+	FCraneRigSolver::Solve(*Geometry, Preset->Preset, Input, Solution);
+
+	if (bComputeJointTransforms)
+	{
+		FCraneRigSolver::BuildPose(*Geometry, Preset->Preset, Input.TrackPosition, Solution, Pose);
+	}
+
+	FTechnocraneRigKinematics::ToSimulationData(Solution, SimulationData);
+
+	if (ActiveReachabilityField)
+	{
+		SimulationData.ReachMargin = ActiveReachabilityField->GetReachMargin(Input.Target, Input.TrackPosition);
+		SimulationData.bNearReachLimit = SimulationData.ReachMargin < ReachWarningMargin;
+	}
+
+	OnSimulationUpdated.Broadcast(SimulationData);
+	return true;
+}
+
+FTransform UTechnocraneSimulationComponent::GetJointTransform(ECraneJoints Joint, bool bWorldSpace) const
+{
+	const int32 JointIndex = static_cast<int32>(Joint);
+
+	if (JointIndex < 0 || JointIndex >= FCraneRigGeometry::JointCount)
+	{
+		return FTransform::Identity;
+	}
+
+	const FTransform& JointTransform = Pose.ComponentSpace[JointIndex];
+	return (bWorldSpace) ? JointTransform * GetComponentTransform() : JointTransform;
+}
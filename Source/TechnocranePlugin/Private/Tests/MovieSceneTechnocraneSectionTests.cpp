@@ -0,0 +1,127 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// MovieSceneTechnocraneSectionTests.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "MovieSceneTechnocraneSection.h"
+#include "MovieSceneTechnocraneTrack.h"
+#include "TechnocranePrivatePCH.h"
+
+#include "Misc/AutomationTest.h"
+#include "MovieScene.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMovieSceneTechnocraneSectionEvaluateTest, "Technocrane.Sequencer.TakeSection.Evaluate", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMovieSceneTechnocraneSectionEvaluateTest::RunTest(const FString& Parameters)
+{
+	const FFrameRate TickResolution(24000, 1);
+	const FFrameRate SampleRate(100, 1);
+
+	// a take at 01:00:00:00, the track position of a sample is its timecode frame
+	const FFrameNumber TakeStart = FTimecode(1, 0, 0, 0, false).ToFrameNumber(SampleRate);
+	constexpr int32 NumSamples = 200;
+
+	FCraneTakeSamples Samples;
+	Samples.Reset(SampleRate, TakeStart, NumSamples);
+
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		float Sample[FCraneTakeSamples::NumChannels]{ 0.0f };
+		Sample[static_cast<int32>(ECraneTakeChannel::TrackPosition)] = static_cast<float>(TakeStart.Value + i);
+		Samples.AddSample(MakeArrayView(Sample));
+	}
+
+	UMovieScene* MovieScene = NewObject<UMovieScene>(GetTransientPackage());
+	MovieScene->SetTickResolutionDirectly(TickResolution);
+
+	UMovieSceneTechnocraneTrack* Track = NewObject<UMovieSceneTechnocraneTrack>(MovieScene);
+
+	// the take is placed at 1s of the sequence
+	const FFrameNumber SectionStart = TickResolution.AsFrameNumber(1.0);
+	UMovieSceneTechnocraneSection* Section = Track->AddTake(MoveTemp(Samples), SectionStart);
+
+	auto EvaluateTrackPosition = [Section, TickResolution](const double Seconds)
+	{
+		float Sample[FCraneTakeSamples::NumChannels]{ 0.0f };
+		Section->EvaluateSamples(TickResolution.AsFrameTime(Seconds), TickResolution, MakeArrayView(Sample));
+		return Sample[static_cast<int32>(ECraneTakeChannel::TrackPosition)];
+	};
+
+	const float FirstFrame = static_cast<float>(TakeStart.Value);
+
+	TestTrue(TEXT("Section timecode is the take start"), Section->TimecodeSource.Timecode == FTimecode(1, 0, 0, 0, false));
+	TestTrue(TEXT("Section covers the take"), Section->GetExclusiveEndFrame() == SectionStart + TickResolution.AsFrameNumber(2.0));
+
+	TestEqual(TEXT("Section start is the first sample"), EvaluateTrackPosition(1.0), FirstFrame);
+	TestEqual(TEXT("Half a second later is 50 samples later"), EvaluateTrackPosition(1.5), FirstFrame + 50.0f);
+	TestEqual(TEXT("Samples are interpolated"), EvaluateTrackPosition(1.505), FirstFrame + 50.5f, 1.e-2f);
+
+	// trim keeps samples at their timecode
+	Section->TrimSection(FQualifiedFrameTime(TickResolution.AsFrameTime(1.25), TickResolution), true, false);
+
+	TestTrue(TEXT("Left trim moves the section timecode"), Section->TimecodeSource.Timecode == FTimecode(1, 0, 0, 25, false));
+	TestEqual(TEXT("Left trim keeps samples in place"), EvaluateTrackPosition(1.5), FirstFrame + 50.0f);
+
+	// split, the right section starts later in the take
+	UMovieSceneTechnocraneSection* RightSection = Cast<UMovieSceneTechnocraneSection>(Section->SplitSection(FQualifiedFrameTime(TickResolution.AsFrameTime(2.0), TickResolution), false));
+	if (TestNotNull(TEXT("Section is split"), RightSection))
+	{
+		float Sample[FCraneTakeSamples::NumChannels]{ 0.0f };
+		RightSection->EvaluateSamples(TickResolution.AsFrameTime(2.5), TickResolution, MakeArrayView(Sample));
+
+		TestTrue(TEXT("Right section timecode"), RightSection->TimecodeSource.Timecode == FTimecode(1, 0, 1, 0, false));
+		TestEqual(TEXT("Right section keeps samples in place"), Sample[static_cast<int32>(ECraneTakeChannel::TrackPosition)], FirstFrame + 150.0f);
+	}
+
+	// slip, a later timecode at the section start plays later samples
+	Section->TimecodeSource = FMovieSceneTimecodeSource(FTimecode(1, 0, 0, 35, false));
+	TestEqual(TEXT("Slipped section plays from its timecode"), EvaluateTrackPosition(1.5), FirstFrame + 60.0f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCraneTakeSamplesAnglesTest, "Technocrane.Sequencer.TakeSamples.Angles", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FCraneTakeSamplesAnglesTest::RunTest(const FString& Parameters)
+{
+	const int32 Yaw = static_cast<int32>(ECraneTakeChannel::Yaw);
+
+	FCraneTakeSamples Samples;
+	Samples.Reset(FFrameRate(100, 1), FFrameNumber(0));
+
+	// the pan crosses 180 degrees between two samples
+	float Sample[FCraneTakeSamples::NumChannels]{ 0.0f };
+	Sample[Yaw] = 179.0f;
+	Samples.AddSample(MakeArrayView(Sample));
+	Sample[Yaw] = -179.0f;
+	Samples.AddSample(MakeArrayView(Sample));
+
+	float Evaluated[FCraneTakeSamples::NumChannels]{ 0.0f };
+	Samples.Evaluate(FFrameTime(FFrameNumber(0), 0.5f), MakeArrayView(Evaluated));
+	TestEqual(TEXT("Angles are interpolated the short way around"), FMath::Abs(Evaluated[Yaw]), 180.0f, 1.e-3f);
+
+	// samples of an unknown version are rejected
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	int32 Version = 1000;
+	Writer << Version;
+	Writer << Samples.SampleRate;
+
+	FMemoryReader Reader(Bytes);
+	FCraneTakeSamples Loaded;
+	Reader << Loaded;
+
+	TestTrue(TEXT("Unknown version is an archive error"), Reader.IsError());
+	TestTrue(TEXT("Unknown version loads no samples"), Loaded.IsEmpty());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,110 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClearanceQueryTests.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneClearanceQuery.h"
+#include "TechnocranePrivatePCH.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace NTechnocraneClearanceQueryTests
+{
+	constexpr float SearchDistance = 100.0f;
+	constexpr float FrameTime = 1.0f / 30.0f;
+
+	// a batch is issued on one frame and collected on the next one, the same way the rig clearance tick does it
+	bool IssueAndCollect(UWorld& World, FCraneClearanceQuery& Query, const FCraneClearanceQuery::FCapsules& Capsules, FCraneClearanceResult& OutResult)
+	{
+		const FCollisionQueryParams Params(SCENE_QUERY_STAT(TechnocraneClearanceTest), false);
+		Query.Issue(World, Capsules, ECC_WorldStatic, SearchDistance, Params);
+
+		World.Tick(LEVELTICK_All, FrameTime);
+
+		return Query.Collect(World, OutResult);
+	}
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneClearanceQueryObstacleTest, "Technocrane.Rig.Clearance.Obstacle", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneClearanceQueryObstacleTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneClearanceQueryTests;
+
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Engine cube mesh is loaded"), CubeMesh))
+	{
+		return false;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FURL URL;
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	// a crane column, 2m up from the origin
+	FCraneClearanceQuery::FCapsules Capsules;
+	FCraneClearanceCapsule& Column = Capsules.AddDefaulted_GetRef();
+	Column.Start = FVector::ZeroVector;
+	Column.End = FVector(0.0f, 0.0f, 200.0f);
+	Column.Radius = 30.0f;
+	Column.Joint = 0;
+
+	FCraneClearanceQuery Query;
+	FCraneClearanceResult Result;
+
+	TestTrue(TEXT("Empty set is collected on the next frame"), IssueAndCollect(*World, Query, Capsules, Result));
+	TestEqual(TEXT("Nothing is close in an empty set"), Result.MinClearance, SearchDistance);
+	TestFalse(TEXT("No collision in an empty set"), Result.bCollision);
+	TestFalse(TEXT("Collected batch is done"), Query.IsPending());
+
+	// a 1m cube with its near face 50cm from the column surface
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AStaticMeshActor* Obstacle = World->SpawnActor<AStaticMeshActor>(FVector(130.0f, 0.0f, 100.0f), FRotator::ZeroRotator, SpawnParams);
+	if (TestNotNull(TEXT("Obstacle is spawned"), Obstacle))
+	{
+		UStaticMeshComponent* MeshComponent = Obstacle->GetStaticMeshComponent();
+		MeshComponent->SetMobility(EComponentMobility::Movable);
+		MeshComponent->SetStaticMesh(CubeMesh);
+		MeshComponent->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+
+		// the physics scene picks up the new body
+		World->Tick(LEVELTICK_All, FrameTime);
+
+		TestTrue(TEXT("Set with an obstacle is collected on the next frame"), IssueAndCollect(*World, Query, Capsules, Result));
+		TestTrue(TEXT("Obstacle lowers the clearance"), Result.MinClearance < SearchDistance);
+		TestEqual(TEXT("Clearance is the distance to the obstacle"), Result.MinClearance, 50.0f, 1.0f);
+		TestFalse(TEXT("Obstacle doesn't touch the column"), Result.bCollision);
+
+		// the cube is moved into the column
+		Obstacle->SetActorLocation(FVector(60.0f, 0.0f, 100.0f));
+		World->Tick(LEVELTICK_All, FrameTime);
+
+		TestTrue(TEXT("Moved obstacle is collected on the next frame"), IssueAndCollect(*World, Query, Capsules, Result));
+		TestTrue(TEXT("Obstacle in the column is a collision"), Result.bCollision);
+		TestEqual(TEXT("Collision is reported for the column"), Result.CollisionJoint, 0);
+		TestTrue(TEXT("Collision actor is the obstacle"), Result.CollisionActor == Obstacle->GetFName());
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,111 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClusterLoopback.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneClusterLoopback.h"
+#include "TechnocranePrivatePCH.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Common/UdpSocketBuilder.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+namespace NTechnocraneClusterLoopback
+{
+	constexpr int32 MaxMessageSize = 1024;
+
+	FIPv4Endpoint MakeEndpoint(const uint16 Port)
+	{
+		return FIPv4Endpoint(FIPv4Address(127, 0, 0, 1), Port);
+	}
+
+	NTechnocrane::STechnocrane_Packet MakePacket(const int32 PacketNumber)
+	{
+		NTechnocrane::STechnocrane_Packet Packet;
+		Packet.PacketNumber = static_cast<float>(PacketNumber);
+		Packet.PacketHasTimeCode = true;
+		Packet.hours = 1;
+		Packet.minutes = (PacketNumber / (25 * 60)) % 60;
+		Packet.seconds = (PacketNumber / 25) % 60;
+		Packet.frames = PacketNumber % 25;
+		Packet.TrackPos = static_cast<float>(PacketNumber);
+		return Packet;
+	}
+
+	FSocket* OpenSocket(const uint16 Port)
+	{
+		FSocket* Socket = FUdpSocketBuilder(TEXT("Technocrane Cluster Loopback"))
+			.BoundToEndpoint(MakeEndpoint(Port))
+			.WithReceiveBufferSize(256 * 1024)
+			.Build();
+
+		if (!Socket)
+		{
+			UE_LOG(LogTechnocrane, Warning, TEXT("Failed to bind %s for a cluster loopback"), *MakeEndpoint(Port).ToString());
+		}
+		return Socket;
+	}
+
+	void CloseSocket(FSocket*& Socket)
+	{
+		if (Socket)
+		{
+			Socket->Close();
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+			Socket = nullptr;
+		}
+	}
+
+	bool Send(FSocket& Socket, const uint16 Port, const FString& Message)
+	{
+		const FTCHARToUTF8 Data(*Message);
+		int32 BytesSent = 0;
+
+		return Socket.SendTo(reinterpret_cast<const uint8*>(Data.Get()), Data.Length(), BytesSent, *MakeEndpoint(Port).ToInternetAddr())
+			&& BytesSent == Data.Length();
+	}
+
+	bool Receive(FSocket& Socket, const double TimeoutSeconds, FString& OutMessage)
+	{
+		if (!Socket.Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(TimeoutSeconds)))
+		{
+			return false;
+		}
+
+		uint8 Data[MaxMessageSize];
+		int32 BytesRead = 0;
+		TSharedRef<FInternetAddr> From = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+
+		if (!Socket.RecvFrom(Data, sizeof(Data), BytesRead, *From))
+		{
+			return false;
+		}
+
+		const FUTF8ToTCHAR Message(reinterpret_cast<const ANSICHAR*>(Data), BytesRead);
+		OutMessage = FString(Message.Length(), Message.Get());
+		return true;
+	}
+
+	FString KeyToString(const FCraneSampleKey& Key)
+	{
+		return FString::Printf(TEXT("%d,%u"), Key.PacketNumber, Key.Timecode);
+	}
+
+	bool FSource::PushSample(const FCraneSampleKey& Key, const double WaitSeconds)
+	{
+		NTechnocrane::STechnocrane_Packet Packet;
+		if (!Ring.WaitFor(Key, WaitSeconds, Packet))
+		{
+			return false;
+		}
+
+		LastPushed = FCraneSampleRing::MakeKey(Packet);
+		return true;
+	}
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClusterLoopback.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "TechnocraneClusterSamples.h"
+#include "TechnocraneSampleRing.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class FSocket;
+
+/**
+ * Nodes of the cluster sample selection loopback test.
+ *  The test process is the primary node, it starts a secondary node in a separate process with the TechnocraneClusterNode commandlet.
+ *  Crane packets, selections and replies are text datagrams over local udp, a packet carries only its number.
+ */
+namespace NTechnocraneClusterLoopback
+{
+	/** the secondary node receives packets and selections on its own ports, it replies to the primary port */
+	constexpr uint16 PacketPort = 40110;
+	constexpr uint16 SelectionPort = 40111;
+	constexpr uint16 PrimaryPort = 40112;
+
+	/** selection, quit and ready messages start with a tag, a reply to a selection is a pushed key or a miss */
+	constexpr TCHAR SelectionTag = TEXT('S');
+	constexpr TCHAR QuitTag = TEXT('Q');
+	constexpr TCHAR ReadyTag = TEXT('R');
+	constexpr TCHAR PushedTag = TEXT('P');
+	constexpr TCHAR MissedTag = TEXT('M');
+
+	FIPv4Endpoint MakeEndpoint(const uint16 Port);
+
+	/** the same packet on both nodes for the same number, with a timecode at 25 fps */
+	NTechnocrane::STechnocrane_Packet MakePacket(const int32 PacketNumber);
+
+	FSocket* OpenSocket(const uint16 Port);
+	void CloseSocket(FSocket*& Socket);
+
+	bool Send(FSocket& Socket, const uint16 Port, const FString& Message);
+	/** false when nothing is received in time */
+	bool Receive(FSocket& Socket, const double TimeoutSeconds, FString& OutMessage);
+
+	FString KeyToString(const FCraneSampleKey& Key);
+
+	/** a crane stream of a node, keeps received packets in a ring and remembers the pushed one */
+	class FSource : public ICraneClusterSampleSource
+	{
+	public:
+		FSource() { FTechnocraneClusterSamples::RegisterSource(this); }
+		virtual ~FSource() { FTechnocraneClusterSamples::UnregisterSource(this); }
+
+		// ICraneClusterSampleSource interface
+
+		FString GetClusterSourceId() const override { return TEXT("Loopback"); }
+		FCraneSampleKey GetLatestSample(const int32 Delay) const override { return Ring.GetLatest(Delay); }
+		bool PushSample(const FCraneSampleKey& Key, const double WaitSeconds) override;
+
+		FCraneSampleRing Ring;
+		FCraneSampleKey LastPushed;
+	};
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClusterNodeCommandlet.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneClusterNodeCommandlet.h"
+#include "TechnocraneClusterLoopback.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneRuntimeSettings.h"
+
+#include "Async/Async.h"
+#include "Misc/Parse.h"
+
+#include <atomic>
+
+UTechnocraneClusterNodeCommandlet::UTechnocraneClusterNodeCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UTechnocraneClusterNodeCommandlet::Main(const FString& Params)
+{
+#if WITH_DEV_AUTOMATION_TESTS
+	using namespace NTechnocraneClusterLoopback;
+
+	// the primary gives up on a node that doesn't answer, a node without the primary quits on its own
+	constexpr double PrimaryTimeout = 30.0;
+
+	float WaitTime = 20.0f;
+	FParse::Value(*Params, TEXT("WaitTime="), WaitTime);
+
+	FSocket* PacketSocket = OpenSocket(PacketPort);
+	FSocket* SelectionSocket = OpenSocket(SelectionPort);
+
+	if (!PacketSocket || !SelectionSocket)
+	{
+		CloseSocket(PacketSocket);
+		CloseSocket(SelectionSocket);
+		return 1;
+	}
+
+	GetMutableDefault<UTechnocraneRuntimeSettings>()->ClusterSampleWaitTime = WaitTime;
+	FTechnocraneClusterSamples::SetMode(ECraneClusterMode::Secondary);
+
+	FSource Source;
+	std::atomic<bool> bQuit{ false };
+
+	// packets come on a receiver thread like they do from the crane, the game thread waits for them in the ring
+	TFuture<void> Receiver = Async(EAsyncExecution::Thread, [&Source, &bQuit, PacketSocket]()
+	{
+		FString Message;
+		while (!bQuit.load(std::memory_order_relaxed))
+		{
+			if (Receive(*PacketSocket, 0.1, Message))
+			{
+				Source.Ring.Add(MakePacket(FCString::Atoi(*Message)));
+			}
+		}
+	});
+
+	Send(*SelectionSocket, PrimaryPort, FString::ElementsToString(&ReadyTag, 1));
+
+	int32 NumSelections = 0;
+	FString Message;
+
+	while (Receive(*SelectionSocket, PrimaryTimeout, Message) && Message.Len() > 0 && Message[0] != QuitTag)
+	{
+		if (Message[0] != SelectionTag)
+		{
+			continue;
+		}
+
+		const bool bPushed = FTechnocraneClusterSamples::ApplySelection(Message.Mid(1));
+		Send(*SelectionSocket, PrimaryPort, (bPushed) ? FString::Printf(TEXT("%c%s"), PushedTag, *KeyToString(Source.LastPushed)) : FString::ElementsToString(&MissedTag, 1));
+		++NumSelections;
+	}
+
+	bQuit = true;
+	Receiver.Wait();
+
+	UE_LOG(LogTechnocrane, Display, TEXT("Technocrane cluster node applied %d selections, %u samples missed"),
+		NumSelections, FTechnocraneClusterSamples::GetNumMissedSamples());
+
+	FTechnocraneClusterSamples::SetMode(ECraneClusterMode::Disabled);
+
+	CloseSocket(PacketSocket);
+	CloseSocket(SelectionSocket);
+	return 0;
+#else
+	UE_LOG(LogTechnocrane, Error, TEXT("Technocrane cluster node needs a build with automation tests"));
+	return 1;
+#endif
+}
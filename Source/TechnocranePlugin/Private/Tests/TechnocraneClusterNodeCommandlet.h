@@ -0,0 +1,27 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClusterNodeCommandlet.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TechnocraneClusterNodeCommandlet.generated.h"
+
+/**
+ * A secondary node of the cluster sample selection loopback test, started by the test in a separate process.
+ *  Arguments: -WaitTime=<ms> how long a selected sample is waited for, 20 ms by default.
+ */
+UCLASS()
+class UTechnocraneClusterNodeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UTechnocraneClusterNodeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,148 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClusterSamplesTests.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneClusterLoopback.h"
+#include "TechnocranePrivatePCH.h"
+#include "TechnocraneRuntimeSettings.h"
+
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace NTechnocraneClusterSamplesTests
+{
+	constexpr int32 NumFrames = 100;
+	/** every few frames the selection reaches the secondary node before the packet does */
+	constexpr int32 LateEvery = 4;
+	constexpr float LateSeconds = 0.005f;
+	/** the secondary node wait for a selected sample, in milliseconds */
+	constexpr float WaitTime = 20.0f;
+
+	/** the secondary node boots an engine before it is ready */
+	constexpr double StartTimeout = 120.0;
+	constexpr double ReplyTimeout = 1.0;
+	constexpr double QuitTimeout = 10.0;
+
+	FString MakeMessage(const TCHAR Tag, const FString& Payload = FString())
+	{
+		return FString::Printf(TEXT("%c%s"), Tag, *Payload);
+	}
+
+	bool WaitForExit(FProcHandle& Process, const double TimeoutSeconds)
+	{
+		const double EndTime = FPlatformTime::Seconds() + TimeoutSeconds;
+		while (FPlatformProcess::IsProcRunning(Process))
+		{
+			if (FPlatformTime::Seconds() > EndTime)
+			{
+				return false;
+			}
+			FPlatformProcess::Sleep(0.05f);
+		}
+		return true;
+	}
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneClusterSamplesLoopbackTest, "Technocrane.Cluster.Samples.Loopback", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneClusterSamplesLoopbackTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneClusterLoopback;
+	using namespace NTechnocraneClusterSamplesTests;
+
+	FSocket* Socket = OpenSocket(PrimaryPort);
+	if (!TestNotNull(TEXT("Primary node socket is bound"), Socket))
+	{
+		return false;
+	}
+
+	// the secondary node is the same executable and project in a separate process
+	const FString NodeParams = FString::Printf(TEXT("\"%s\" -run=TechnocraneClusterNode -WaitTime=%.0f -unattended -nullrhi -nosplash -nosound -stdout"),
+		*FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()), WaitTime);
+
+	FProcHandle Node = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *NodeParams, false, true, true, nullptr, 0, nullptr, nullptr);
+	if (!TestTrue(TEXT("Secondary node process is started"), Node.IsValid()))
+	{
+		CloseSocket(Socket);
+		return false;
+	}
+
+	FString Message;
+	if (TestTrue(TEXT("Secondary node is ready"), Receive(*Socket, StartTimeout, Message) && Message == MakeMessage(ReadyTag)))
+	{
+		UTechnocraneRuntimeSettings* Settings = GetMutableDefault<UTechnocraneRuntimeSettings>();
+		const int32 PrevDelay = Settings->ClusterSampleDelay;
+		const ECraneClusterMode PrevMode = FTechnocraneClusterSamples::GetMode();
+
+		// the latest sample is selected, a late packet makes the secondary node wait for it
+		Settings->ClusterSampleDelay = 0;
+		FTechnocraneClusterSamples::SetMode(ECraneClusterMode::Primary);
+		{
+			FSource Source;
+
+			int32 NumMatched = 0;
+			int32 NumMissed = 0;
+
+			for (int32 Frame = 1; Frame <= NumFrames; ++Frame)
+			{
+				const bool bLate = (Frame % LateEvery) == 0;
+
+				Source.Ring.Add(MakePacket(Frame));
+				if (!bLate)
+				{
+					Send(*Socket, PacketPort, FString::FromInt(Frame));
+				}
+
+				Send(*Socket, SelectionPort, MakeMessage(SelectionTag, FTechnocraneClusterSamples::SelectSamples()));
+
+				if (bLate)
+				{
+					FPlatformProcess::Sleep(LateSeconds);
+					Send(*Socket, PacketPort, FString::FromInt(Frame));
+				}
+
+				if (!Receive(*Socket, ReplyTimeout, Message))
+				{
+					AddError(FString::Printf(TEXT("Secondary node doesn't reply to a selection of frame %d"), Frame));
+					break;
+				}
+
+				NumMatched += (Message == MakeMessage(PushedTag, KeyToString(Source.LastPushed))) ? 1 : 0;
+				NumMissed += (Message == MakeMessage(MissedTag)) ? 1 : 0;
+			}
+
+			TestEqual(TEXT("Secondary node pushes the sample selected by the primary on every frame"), NumMatched, NumFrames);
+			TestEqual(TEXT("Late samples are waited for"), NumMissed, 0);
+
+			// a sample that never comes, the secondary node renders the frame without it after the wait
+			const FCraneSampleKey LostKey = FCraneSampleRing::MakeKey(MakePacket(NumFrames + 100));
+			const double SendTime = FPlatformTime::Seconds();
+
+			Send(*Socket, SelectionPort, MakeMessage(SelectionTag, FString::Printf(TEXT("%s=%s"), *Source.GetClusterSourceId(), *KeyToString(LostKey))));
+
+			TestTrue(TEXT("Lost sample is reported as missed"), Receive(*Socket, ReplyTimeout, Message) && Message == MakeMessage(MissedTag));
+			TestTrue(TEXT("Secondary node waits for a lost sample"), FPlatformTime::Seconds() - SendTime >= 0.0009 * WaitTime);
+		}
+
+		FTechnocraneClusterSamples::SetMode(PrevMode);
+		Settings->ClusterSampleDelay = PrevDelay;
+	}
+
+	Send(*Socket, SelectionPort, MakeMessage(QuitTag));
+
+	if (!TestTrue(TEXT("Secondary node quits"), WaitForExit(Node, QuitTimeout)))
+	{
+		FPlatformProcess::TerminateProc(Node, true);
+	}
+	FPlatformProcess::CloseProc(Node);
+
+	CloseSocket(Socket);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,264 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneFreeDTests.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneFreeD.h"
+#include "TechnocranePrivatePCH.h"
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace NTechnocraneFreeDTests
+{
+	using namespace NTechnocraneFreeD;
+
+	// float values have a rounding error of their own above the fixed point half step
+	constexpr float AngleTolerance = 0.5f / AngleScale + 1.e-4f;
+	constexpr float PositionTolerance = 0.5f / PositionScale + 1.e-3f;
+
+	NTechnocraneShared::SSample MakeSample()
+	{
+		NTechnocraneShared::SSample Sample;
+		FMemory::Memzero(Sample);
+
+		Sample.Location[0] = 120.5f;
+		Sample.Location[1] = -340.25f;
+		Sample.Location[2] = 1500.0f;
+		Sample.Rotation[0] = 12.5f;
+		Sample.Rotation[1] = -75.25f;
+		Sample.Rotation[2] = 3.0f;
+		Sample.FocalLength = 35.0f;
+		Sample.FocusDistance = 250.0f;
+		Sample.Aperture = 2.8f;
+		return Sample;
+	}
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneFreeDRoundTripTest, "Technocrane.FreeD.RoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneFreeDRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneFreeDTests;
+
+	const NTechnocraneShared::SSample Sample = MakeSample();
+
+	FCraneRawValues Raw;
+	Raw.Zoom = 42.5f;
+	Raw.Focus = 17.25f;
+
+	uint8 Data[Size];
+	NTechnocraneShared::SSample Decoded;
+	FCraneRawValues DecodedRaw;
+	uint8 CameraId = 0;
+
+	// encoder counts, the default lens encoding
+	{
+		const FLensEncoding Lens;
+		Encode(Sample, Raw, Lens, 7, Data);
+
+		// fields are in the FreeD order, X is the engine right axis and Y is the engine forward axis
+		TestEqual(TEXT("Pan is the yaw"), ReadSigned24(Data + 2), FMath::RoundToInt(-75.25f * AngleScale));
+		TestEqual(TEXT("Tilt is the pitch"), ReadSigned24(Data + 5), FMath::RoundToInt(12.5f * AngleScale));
+		TestEqual(TEXT("Roll is the roll"), ReadSigned24(Data + 8), FMath::RoundToInt(3.0f * AngleScale));
+		TestEqual(TEXT("X is the engine Y"), ReadSigned24(Data + 11), FMath::RoundToInt(-340.25f * PositionScale));
+		TestEqual(TEXT("Y is the engine X"), ReadSigned24(Data + 14), FMath::RoundToInt(120.5f * PositionScale));
+		TestEqual(TEXT("Z is up"), ReadSigned24(Data + 17), FMath::RoundToInt(1500.0f * PositionScale));
+		TestEqual(TEXT("Zoom is encoder counts"), ReadUnsigned24(Data + 20), FMath::RoundToInt(42.5f * Lens.EncoderScale));
+		TestEqual(TEXT("Focus is encoder counts"), ReadUnsigned24(Data + 23), FMath::RoundToInt(17.25f * Lens.EncoderScale));
+
+		if (TestTrue(TEXT("Encoder message is decoded"), Decode(Data, Size, Lens, Decoded, DecodedRaw, CameraId)))
+		{
+			TestEqual(TEXT("Camera id"), static_cast<int32>(CameraId), 7);
+
+			for (int32 i = 0; i < 3; ++i)
+			{
+				TestEqual(TEXT("Decoded location"), Decoded.Location[i], Sample.Location[i], PositionTolerance);
+				TestEqual(TEXT("Decoded rotation"), Decoded.Rotation[i], Sample.Rotation[i], AngleTolerance);
+			}
+
+			TestEqual(TEXT("Decoded zoom encoder"), DecodedRaw.Zoom, Raw.Zoom, 0.5f / Lens.EncoderScale);
+			TestEqual(TEXT("Decoded focus encoder"), DecodedRaw.Focus, Raw.Focus, 0.5f / Lens.EncoderScale);
+			TestEqual(TEXT("Decoded aperture"), Decoded.Aperture, Sample.Aperture, 0.5f / ApertureScale + KINDA_SMALL_NUMBER);
+			TestFalse(TEXT("Encoder zoom needs a calibration"), (Decoded.Flags & NTechnocraneShared::ZoomCalibrated) != 0);
+		}
+	}
+
+	// a focal length and a focus distance
+	{
+		FLensEncoding Lens;
+		Lens.bCalibrated = true;
+		Encode(Sample, Raw, Lens, 1, Data);
+
+		if (TestTrue(TEXT("Calibrated message is decoded"), Decode(Data, Size, Lens, Decoded, DecodedRaw, CameraId)))
+		{
+			TestEqual(TEXT("Decoded focal length"), Decoded.FocalLength, Sample.FocalLength, 0.5f / FocalLengthScale + KINDA_SMALL_NUMBER);
+			TestEqual(TEXT("Decoded focus distance"), Decoded.FocusDistance, Sample.FocusDistance, 0.5f / FocusDistanceScale + KINDA_SMALL_NUMBER);
+			TestTrue(TEXT("Calibrated zoom and focus"), (Decoded.Flags & (NTechnocraneShared::ZoomCalibrated | NTechnocraneShared::FocusCalibrated))
+				== (NTechnocraneShared::ZoomCalibrated | NTechnocraneShared::FocusCalibrated));
+		}
+	}
+
+	// random samples within the field ranges come back within half of a fixed point step
+	{
+		const FLensEncoding Lens;
+		FRandomStream RandomStream(29);
+		NTechnocraneShared::SSample Random = Sample;
+
+		float MaxAngleError = 0.0f;
+		float MaxPositionError = 0.0f;
+		int32 NumFailed = 0;
+
+		for (int32 i = 0; i < 10000; ++i)
+		{
+			Random.Rotation[0] = RandomStream.FRandRange(-90.0f, 90.0f);
+			Random.Rotation[1] = RandomStream.FRandRange(-180.0f, 179.99f);
+			Random.Rotation[2] = RandomStream.FRandRange(-180.0f, 179.99f);
+
+			for (float& Value : Random.Location)
+			{
+				Value = RandomStream.FRandRange(-13000.0f, 13000.0f);
+			}
+
+			Encode(Random, Raw, Lens, 1, Data);
+			if (!Decode(Data, Size, Lens, Decoded, DecodedRaw, CameraId))
+			{
+				++NumFailed;
+				continue;
+			}
+
+			for (int32 k = 0; k < 3; ++k)
+			{
+				MaxAngleError = FMath::Max(MaxAngleError, FMath::Abs(Decoded.Rotation[k] - Random.Rotation[k]));
+				MaxPositionError = FMath::Max(MaxPositionError, FMath::Abs(Decoded.Location[k] - Random.Location[k]));
+			}
+		}
+
+		TestEqual(TEXT("Every random message is decoded"), NumFailed, 0);
+		TestTrue(TEXT("Angles are within a half step"), MaxAngleError <= AngleTolerance);
+		TestTrue(TEXT("Positions are within a half step"), MaxPositionError <= PositionTolerance);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneFreeDChecksumTest, "Technocrane.FreeD.Checksum", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneFreeDChecksumTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneFreeDTests;
+
+	const FLensEncoding Lens;
+	uint8 Data[Size];
+	Encode(MakeSample(), FCraneRawValues(), Lens, 1, Data);
+
+	// 0x40 minus the sum of all other bytes
+	uint8 Sum = 0;
+	for (const uint8 Byte : Data)
+	{
+		Sum += Byte;
+	}
+	TestEqual(TEXT("Message bytes sum up to 0x40"), static_cast<int32>(Sum), 0x40);
+
+	NTechnocraneShared::SSample Decoded;
+	FCraneRawValues DecodedRaw;
+	uint8 CameraId = 0;
+
+	TestTrue(TEXT("Intact message is decoded"), Decode(Data, Size, Lens, Decoded, DecodedRaw, CameraId));
+
+	// any damaged byte, the checksum one too
+	int32 NumAccepted = 0;
+	for (int32 i = 0; i < Size; ++i)
+	{
+		uint8 Damaged[Size];
+		FMemory::Memcpy(Damaged, Data, Size);
+		Damaged[i] ^= 0x10;
+
+		NumAccepted += (Decode(Damaged, Size, Lens, Decoded, DecodedRaw, CameraId)) ? 1 : 0;
+	}
+	TestEqual(TEXT("Damaged messages are rejected"), NumAccepted, 0);
+
+	TestFalse(TEXT("Short message is rejected"), Decode(Data, Size - 1, Lens, Decoded, DecodedRaw, CameraId));
+
+	// another message type with a valid checksum
+	uint8 OtherType[Size];
+	FMemory::Memcpy(OtherType, Data, Size);
+	OtherType[0] = 0xD0;
+	OtherType[Size - 1] = ComputeChecksum(OtherType);
+
+	TestFalse(TEXT("Other message type is rejected"), Decode(OtherType, Size, Lens, Decoded, DecodedRaw, CameraId));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneFreeDSigned24Test, "Technocrane.FreeD.Signed24", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneFreeDSigned24Test::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneFreeDTests;
+
+	auto RoundTrip24 = [](const int32 Value, uint8 (&OutBytes)[3])
+	{
+		Write24(OutBytes, Value);
+		return ReadSigned24(OutBytes);
+	};
+
+	uint8 Bytes[3];
+
+	TestEqual(TEXT("Zero"), RoundTrip24(0, Bytes), 0);
+	TestEqual(TEXT("One"), RoundTrip24(1, Bytes), 1);
+
+	TestEqual(TEXT("Minus one"), RoundTrip24(-1, Bytes), -1);
+	TestTrue(TEXT("Minus one is all ones"), Bytes[0] == 0xFF && Bytes[1] == 0xFF && Bytes[2] == 0xFF);
+
+	TestEqual(TEXT("Largest value"), RoundTrip24(MaxSigned24, Bytes), MaxSigned24);
+	TestTrue(TEXT("Largest value bytes"), Bytes[0] == 0x7F && Bytes[1] == 0xFF && Bytes[2] == 0xFF);
+
+	TestEqual(TEXT("Smallest value"), RoundTrip24(MinSigned24, Bytes), MinSigned24);
+	TestTrue(TEXT("Smallest value bytes"), Bytes[0] == 0x80 && Bytes[1] == 0x00 && Bytes[2] == 0x00);
+
+	Write24(Bytes, MaxUnsigned24);
+	TestEqual(TEXT("Unsigned field"), ReadUnsigned24(Bytes), MaxUnsigned24);
+
+	// values out of the field range are clamped instead of wrapped around
+	const FLensEncoding Lens;
+	NTechnocraneShared::SSample Sample = MakeSample();
+	FCraneRawValues Raw;
+	uint8 Data[Size];
+
+	Sample.Location[1] = 1.e7f;
+	Sample.Location[0] = -1.e7f;
+	Raw.Zoom = -5.0f;
+	Raw.Focus = 1.e9f;
+	Encode(Sample, Raw, Lens, 1, Data);
+
+	TestEqual(TEXT("Far right is clamped"), ReadSigned24(Data + 11), MaxSigned24);
+	TestEqual(TEXT("Far back is clamped"), ReadSigned24(Data + 14), MinSigned24);
+	TestEqual(TEXT("Negative encoder is clamped"), ReadUnsigned24(Data + 20), 0);
+	TestEqual(TEXT("Large encoder is clamped"), ReadUnsigned24(Data + 23), MaxUnsigned24);
+
+	// the largest position in range and a half turn
+	Sample.Location[1] = MaxSigned24 / PositionScale;
+	Sample.Location[0] = MinSigned24 / PositionScale;
+	Sample.Rotation[1] = -180.0f;
+	Encode(Sample, Raw, Lens, 1, Data);
+
+	NTechnocraneShared::SSample Decoded;
+	FCraneRawValues DecodedRaw;
+	uint8 CameraId = 0;
+
+	if (TestTrue(TEXT("Edge message is decoded"), Decode(Data, Size, Lens, Decoded, DecodedRaw, CameraId)))
+	{
+		TestEqual(TEXT("Largest position"), Decoded.Location[1], MaxSigned24 / PositionScale, PositionTolerance);
+		TestEqual(TEXT("Smallest position"), Decoded.Location[0], MinSigned24 / PositionScale, PositionTolerance);
+		TestEqual(TEXT("Half turn"), FMath::Abs(Decoded.Rotation[1]), 180.0f, AngleTolerance);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
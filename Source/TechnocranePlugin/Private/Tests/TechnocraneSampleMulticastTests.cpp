@@ -0,0 +1,124 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSampleMulticastTests.cpp
+// Sergei <Neill3d> Solokhin
+
+#include "TechnocraneSampleMulticast.h"
+#include "TechnocranePrivatePCH.h"
+
+#include "Common/UdpSocketBuilder.h"
+#include "Misc/AutomationTest.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace NTechnocraneSampleMulticastTests
+{
+	constexpr int32 NumSamples = 1000;
+	constexpr uint16 Port = 15248;
+	/** a datagram per sample, the sender thread has that long to send it */
+	constexpr double ReceiveTimeout = 0.1;
+
+	void MakeSample(const int32 Index, NTechnocraneShared::SSample& OutSample, FCraneRawValues& OutRaw)
+	{
+		FMemory::Memzero(OutSample);
+		OutSample.PacketNumber = Index;
+		OutSample.TrackPosition = 0.5f * Index;
+
+		OutRaw = FCraneRawValues();
+		OutRaw.Position[0] = 10.0f + Index;
+		OutRaw.Position[1] = -20.0f - Index;
+		OutRaw.Position[2] = 0.125f * Index;
+		OutRaw.Pan = 0.25f * Index;
+		OutRaw.Tilt = -0.125f * Index;
+		OutRaw.Roll = 0.0625f * Index;
+	}
+
+	bool IsSameRaw(const FCraneRawValues& A, const FCraneRawValues& B)
+	{
+		return A.Position[0] == B.Position[0] && A.Position[1] == B.Position[1] && A.Position[2] == B.Position[2]
+			&& A.Pan == B.Pan && A.Tilt == B.Tilt && A.Roll == B.Roll;
+	}
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTechnocraneSampleMulticastLoopbackTest, "Technocrane.Multicast.Loopback", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTechnocraneSampleMulticastLoopbackTest::RunTest(const FString& Parameters)
+{
+	using namespace NTechnocraneSampleMulticastTests;
+
+	const FIPv4Endpoint Endpoint(FIPv4Address(127, 0, 0, 1), Port);
+
+	FSocket* Socket = FUdpSocketBuilder(TEXT("Technocrane Loopback Test Receiver"))
+		.BoundToEndpoint(Endpoint)
+		.WithReceiveBufferSize(1024 * 1024)
+		.Build();
+
+	if (!TestNotNull(TEXT("Loopback receiver socket is bound"), Socket))
+	{
+		return false;
+	}
+
+	int32 NumReceived = 0;
+	int32 NumMismatched = 0;
+	int32 NumSequenceGaps = 0;
+	{
+		FCraneSampleMulticastSender Sender;
+		if (TestTrue(TEXT("Sender is started"), Sender.Start(Endpoint, 1)))
+		{
+			NTechnocraneShared::SSample Sample;
+			FCraneRawValues Raw;
+
+			uint8 Data[NTechnocraneSampleDatagram::Size + 1];
+			TSharedRef<FInternetAddr> From = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+
+			uint32 LastSequence = 0;
+
+			for (int32 i = 0; i < NumSamples; ++i)
+			{
+				MakeSample(i, Sample, Raw);
+				Sender.Enqueue(Sample, Raw);
+
+				// the next sample is sent once the datagram of this one is received, the sender queue never drops
+				int32 BytesRead = 0;
+				if (!Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(ReceiveTimeout))
+					|| !Socket->RecvFrom(Data, sizeof(Data), BytesRead, *From))
+				{
+					AddError(FString::Printf(TEXT("Datagram of sample %d is not received"), i));
+					break;
+				}
+
+				NTechnocraneShared::SSample Received;
+				FCraneRawValues ReceivedRaw;
+				uint32 Sequence = 0;
+
+				const bool bDecoded = NTechnocraneSampleDatagram::Decode(Data, BytesRead, Received, ReceivedRaw, Sequence);
+
+				NTechnocraneShared::SSample Expected;
+				FCraneRawValues ExpectedRaw;
+				MakeSample(i, Expected, ExpectedRaw);
+
+				NumMismatched += (!bDecoded || Received.PacketNumber != i || Received.TrackPosition != Expected.TrackPosition || !IsSameRaw(ReceivedRaw, ExpectedRaw)) ? 1 : 0;
+				NumSequenceGaps += (bDecoded && NumReceived > 0 && Sequence != LastSequence + 1) ? 1 : 0;
+
+				LastSequence = Sequence;
+				++NumReceived;
+			}
+
+			TestEqual(TEXT("Sender drops no samples"), Sender.GetNumDropped(), 0u);
+		}
+	}
+
+	TestEqual(TEXT("Every sent sample is received"), NumReceived, NumSamples);
+	TestEqual(TEXT("Received samples and raw crane values match the sent ones"), NumMismatched, 0);
+	TestEqual(TEXT("Datagram sequence has no gaps"), NumSequenceGaps, 0);
+
+	Socket->Close();
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -12,12 +12,52 @@
 #include "Animation/AnimNodeBase.h"
 #include "TechnocraneData.h"
 #include "TechnocraneShared.h"
+#include "TechnocraneRigKinematics.h"
+#include "TechnocranePresetRegistry.h"
+#include "TechnocraneRigPoseCache.h"
+#include "LiveLinkTypes.h"
 #include "AnimNode_TechnocraneRig.generated.h"
 
 DECLARE_CYCLE_STAT(TEXT("Technocrane Rig"), STAT_TechnocraneRig, STATGROUP_Anim);
 
+/** inputs of a crane rig evaluation, compared with a tolerance to reuse the last pose while the camera is parked */
+struct FCraneRigInputSnapshot
+{
+	FVector Target{ FVector::ZeroVector };
+	float TrackPosition{ 0.0f };
+	FVector RawRotation{ FVector::ZeroVector };
+	FQuat NeckQ{ FQuat::Identity };
+	FVector CameraPivotOffset{ FVector::ZeroVector };
+	FCraneRigPreset Preset;
+
+	bool Equals(const FCraneRigInputSnapshot& Other) const;
+};
+
+/**
+ * game thread state of a crane rig update, copied in PreUpdate.
+ *  Plain values only, so animation workers never touch actors or components.
+ */
+struct FCraneRigGameThreadInputs
+{
+	FQuat CameraActorRotation{ FQuat::Identity };
+	/** camera component location in world */
+	FVector CameraLocation{ FVector::ZeroVector };
+
+	FVector OwnerLocation{ FVector::ZeroVector };
+	FQuat OwnerRotation{ FQuat::Identity };
+	FVector OwnerScale{ FVector::OneVector };
+
+	float TrackPosition{ 0.0f };
+	bool bHasTrackPosition{ false };
+	bool bHasTarget{ false };
+};
+
 // forward
 class ACineCameraActor;
+class UCineCameraComponent;
+class UTechnocraneCameraComponent;
+class ULiveLinkComponentController;
+class UTechnocraneReachabilityField;
 
 USTRUCT(BlueprintInternalUseOnly)
 struct FAnimNode_TechnocraneRig : public FAnimNode_Base
@@ -47,6 +87,18 @@ struct FAnimNode_TechnocraneRig : public FAnimNode_Base
 	UPROPERTY(BlueprintReadWrite, transient, Category = Settings, meta = (PinShownByDefault))
 	bool bShowDebug = false;
 
+	/** optional precomputed reachability of the crane preset, used to warn when a target comes close to crane limits */
+	UPROPERTY(BlueprintReadWrite, transient, Category = Settings, meta = (PinHiddenByDefault))
+	TObjectPtr<UTechnocraneReachabilityField> ReachabilityField = nullptr;
+
+	/** warn when the target is closer to crane limits than the margin, in cm */
+	UPROPERTY(BlueprintReadWrite, transient, Category = Settings, meta = (PinHiddenByDefault))
+	float ReachWarningMargin = 20.0f;
+
+	/** reuse the last pose when crane inputs are not changed */
+	UPROPERTY(BlueprintReadWrite, transient, Category = Settings, meta = (PinHiddenByDefault))
+	bool bEnablePoseCache = true;
+
 	// FAnimNode_Base interface
 	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
 	virtual void CacheBones_AnyThread(const FAnimationCacheBonesContext& Context) override;
@@ -56,6 +108,10 @@ struct FAnimNode_TechnocraneRig : public FAnimNode_Base
 	virtual void PreUpdate(const UAnimInstance* InAnimInstance) override;
 	// End of FAnimNode_Base interface
 
+	/** baked crane poses replace the solver while they are set */
+	void SetPoseCache(FCraneRigPoseCachePtr InPoseCache, const float InTime);
+	void SetPoseCacheTime(const float InTime);
+
 	// load deprecated properties
 	bool Serialize(FArchive& Ar);
 	void PostSerialize(const FArchive& Ar);
@@ -64,15 +120,52 @@ private:
 	
 	float TrackPosition = 0.0f;
 
-	float GravityOffsetLen = 0.0f;
-	float DistCamHeadAndNeck = 0.0f;
-
-	ECraneJoints ColumnRotationBone = ECraneJoints::Columns;
+	// crane geometry derived from a skeletal mesh reference pose, shared between rigs of the same crane model
+	FCraneRigGeometryPtr Geometry;
 
 	FTransform Target = FTransform::Identity;
 	FVector RawRotation = FVector::ZeroVector;
 	FQuat NeckQ = FQuat::Identity;
 
+	float ReachMargin = 0.0f;
+	bool bNearReachLimit = false;
+
+	void UpdateReachMargin(const FString& OwnerName);
+	/** crane solver inputs from the game thread snapshot */
+	void UpdateCameraInput_AnyThread();
+
+	/** write crane joints into the output pose, other bones keep the reference pose */
+	void ApplyCranePose(FPoseContext& Output, const FCraneRigGeometry& RigGeometry, const FCraneRigPose& CranePose) const;
+
+	// look up target camera components only when the target changes
+	void ResolveTargetComponents();
+	void EvaluateLiveLink_AnyThread();
+
+	TWeakObjectPtr<ACineCameraActor> ResolvedCameraActor;
+	TWeakObjectPtr<UCineCameraComponent> CineCameraComponent;
+	TWeakObjectPtr<UTechnocraneCameraComponent> TechnocraneCameraComponent;
+	TWeakObjectPtr<ULiveLinkComponentController> LiveLinkComponent;
+	uint64 NextComponentLookupFrame = 0;
+
+	// a live link subject is copied on the game thread and evaluated on a worker thread
+	FLiveLinkSubjectRepresentation LiveLinkSubject;
+
+	FCraneRigGameThreadInputs GameThreadInputs;
+	// world location of the crane target from the last update, for debug drawing on the game thread
+	FVector DebugTargetLocation = FVector::ZeroVector;
+
+	// the last evaluated pose and its inputs
+	FCraneRigInputSnapshot CachedInputs;
+	FCompactHeapPose CachedPose;
+	uint16 CachedBoneSerialNumber = 0;
+	bool bPoseCacheValid = false;
+	// running average of a full evaluation, to estimate time saved by cache hits
+	double AverageEvaluateMs = 0.0;
+
+	// poses baked for a shot, set on the game thread before the update
+	FCraneRigPoseCachePtr BakedPoseCache;
+	float BakedPoseTime = 0.0f;
+
 	// map between technocrane a name in skeleton and compact pose bone index and it's parent index
 	TMap<ECraneJoints, TPair<FCompactPoseBoneIndex, FCompactPoseBoneIndex>>	CraneJointToCompactBoneIndex;
 
@@ -0,0 +1,57 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// MovieSceneTechnocraneSection.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MovieSceneSection.h"
+#include "TechnocraneTakeSamples.h"
+#include "MovieSceneTechnocraneSection.generated.h"
+
+/**
+ * A recorded crane take, raw samples at a hardware rate instead of a curve per channel.
+ *  The section timecode source is the take timecode at the section start, a movie scene time is mapped
+ *  through it into the take, so trimming or slipping the section keeps samples at their timecode.
+ *  Samples are interpolated linearly on evaluation.
+ */
+UCLASS()
+class TECHNOCRANEPLUGIN_API UMovieSceneTechnocraneSection : public UMovieSceneSection
+{
+	GENERATED_BODY()
+
+public:
+
+	UMovieSceneTechnocraneSection(const FObjectInitializer& ObjectInitializer);
+
+	/** replace samples of the section, the section range is set to the take duration from its current start and the timecode source to the take start */
+	void SetSamples(FCraneTakeSamples&& InSamples);
+
+	const FCraneTakeSamples& GetSamples() const { return Samples; }
+
+	/** take time in the sample rate at a movie scene time in the movie scene tick resolution */
+	FFrameTime GetTakeTime(const FFrameTime Time, const FFrameRate TickResolution) const;
+
+	/** sample values at a movie scene time in the movie scene tick resolution */
+	void EvaluateSamples(const FFrameTime Time, const FFrameRate TickResolution, TArrayView<float> OutSample) const;
+
+	//~ Begin UMovieSceneSection Interface
+	virtual void TrimSection(FQualifiedFrameTime TrimTime, bool bTrimLeft, bool bDeleteKeys) override;
+	virtual UMovieSceneSection* SplitSection(FQualifiedFrameTime SplitTime, bool bDeleteKeys) override;
+	//~ End UMovieSceneSection Interface
+
+	//~ Begin UObject Interface
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+	//~ End UObject Interface
+
+private:
+
+	/** move the timecode source by a movie scene time in the movie scene tick resolution */
+	void OffsetTimecodeSource(const FFrameNumber Offset);
+
+	FCraneTakeSamples Samples;
+};
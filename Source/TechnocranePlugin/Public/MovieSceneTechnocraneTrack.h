@@ -0,0 +1,56 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// MovieSceneTechnocraneTrack.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MovieSceneNameableTrack.h"
+#include "Compilation/IMovieSceneTrackTemplateProducer.h"
+#include "TechnocraneTakeSamples.h"
+#include "MovieSceneTechnocraneTrack.generated.h"
+
+class UMovieSceneTechnocraneSection;
+
+/**
+ * Crane takes of a technocrane camera binding.
+ *  Sections drive the camera actor transform, raw lens values and a track position of the technocrane camera component.
+ */
+UCLASS()
+class TECHNOCRANEPLUGIN_API UMovieSceneTechnocraneTrack : public UMovieSceneNameableTrack, public IMovieSceneTrackTemplateProducer
+{
+	GENERATED_BODY()
+
+public:
+
+	/** add a section with take samples, the section starts at a given frame in the movie scene tick resolution */
+	UMovieSceneTechnocraneSection* AddTake(FCraneTakeSamples&& Samples, const FFrameNumber StartFrame);
+
+	//~ Begin UMovieSceneTrack Interface
+	virtual bool SupportsType(TSubclassOf<UMovieSceneSection> SectionClass) const override;
+	virtual UMovieSceneSection* CreateNewSection() override;
+	virtual const TArray<UMovieSceneSection*>& GetAllSections() const override;
+	virtual bool HasSection(const UMovieSceneSection& Section) const override;
+	virtual void AddSection(UMovieSceneSection& Section) override;
+	virtual void RemoveSection(UMovieSceneSection& Section) override;
+	virtual void RemoveSectionAt(int32 SectionIndex) override;
+	virtual bool IsEmpty() const override;
+	virtual void RemoveAllAnimationData() override;
+	virtual bool SupportsMultipleRows() const override { return true; }
+#if WITH_EDITORONLY_DATA
+	virtual FText GetDefaultDisplayName() const override;
+#endif
+	//~ End UMovieSceneTrack Interface
+
+	//~ Begin IMovieSceneTrackTemplateProducer Interface
+	virtual FMovieSceneEvalTemplatePtr CreateTemplateForSection(const UMovieSceneSection& InSection) const override;
+	//~ End IMovieSceneTrackTemplateProducer Interface
+
+private:
+
+	UPROPERTY()
+	TArray<TObjectPtr<UMovieSceneSection>> Sections;
+};
@@ -15,6 +15,8 @@
 
 #include "TechnocraneCameraComponent.generated.h"
 
+class UTechnocraneLensProfile;
+
 /// <summary>
 /// A camera component class that exposes additional variables to align with Technocrane Trimmer exported camera data.
 /// @sa ATDCamera
@@ -32,16 +34,53 @@ public:
 public:	
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void OnRegister() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	/** Set raw lens values, calibration is evaluated right away */
+	UFUNCTION(BlueprintCallable, Category = "Tracking Raw Data")
+	void SetRawLensValues(float InZoom, float InIris, float InFocus);
+
+	UFUNCTION(BlueprintSetter)
+	void SetZoom(float InZoom);
+
+	UFUNCTION(BlueprintSetter)
+	void SetIris(float InIris);
+
+	UFUNCTION(BlueprintSetter)
+	void SetFocus(float InFocus);
+
+	/** setters are used by sequencer to animate ranges */
+	UFUNCTION(BlueprintSetter)
+	void SetZoomRange(FVector2D InZoomRange);
+
+	UFUNCTION(BlueprintSetter)
+	void SetIrisRange(FVector2D InIrisRange);
+
+	UFUNCTION(BlueprintSetter)
+	void SetFocusRange(FVector2D InFocusRange);
+
+	UFUNCTION(BlueprintSetter)
+	void SetSpaceScale(float InSpaceScale);
+
+	/**
+	 * Evaluate lens calibration when raw values, ranges or options are changed since the last evaluation
+	 * @return true if the calibration is evaluated
+	 */
+	bool UpdateCalibration(bool bForce = false);
 
 	//
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Raw Data")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetZoom, Category = "Tracking Raw Data")
 	float Zoom;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Raw Data")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetIris, Category = "Tracking Raw Data")
 	float Iris;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Raw Data")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetFocus, Category = "Tracking Raw Data")
 	float Focus;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Raw Data")
@@ -55,6 +94,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Calibrated")
 	bool ApplyCalibratedValues = true;
 
+	/**
+	 * Stop ticking while lens values don't change, setters wake the component up.
+	 *  Raw values written directly (not through setters) are not noticed while the component sleeps.
+	 *  The component keeps ticking with tracking focus or smooth focus changes.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Calibrated")
+	bool bSleepWhenIdle = false;
+
 	UPROPERTY(VisibleAnywhere, SkipSerialization, BlueprintReadOnly, Category = "Tracking Calibrated")
 	bool IsZoomCalibrated;
 
@@ -70,23 +117,63 @@ public:
 	UPROPERTY(VisibleAnywhere, SkipSerialization, BlueprintReadOnly, Category = "Tracking Calibrated")
 	float CalibratedIris;
 
-	UPROPERTY(VisibleAnywhere, SkipSerialization, BlueprintReadOnly, Category = "Tracking Calibrated")
+	/** focus distance in cm, from the lens profile or from the focus range scaled by the space scale */
+	UPROPERTY(VisibleAnywhere, SkipSerialization, BlueprintReadOnly, Category = "Tracking Calibrated", meta = (Units = cm))
 	float CalibratedFocus;
 
 	//
 
-	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, Category = "Tracking Options")
+	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetSpaceScale, Category = "Tracking Options")
 		float SpaceScale;
 
 	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, Category = "Tracking Options")
 		FFrameRate FrameRate;
 
-	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, Category = "Tracking Options")
+	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetZoomRange, Category = "Tracking Options")
 		FVector2D ZoomRange;
 
-	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, Category = "Tracking Options")
+	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetIrisRange, Category = "Tracking Options")
 		FVector2D IrisRange;
 
-	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, Category = "Tracking Options")
+	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetFocusRange, Category = "Tracking Options")
 		FVector2D FocusRange;
+
+	/** Per lens calibration tables, channels without calibration points fall back to the uncalibrated ranges */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracking Options")
+	TObjectPtr<UTechnocraneLensProfile> LensProfile;
+
+private:
+
+	/** values the calibration was evaluated for */
+	struct FCalibrationInputs
+	{
+		float Zoom{ 0.0f };
+		float Iris{ 0.0f };
+		float Focus{ 0.0f };
+		FVector2D ZoomRange{ FVector2D::ZeroVector };
+		FVector2D IrisRange{ FVector2D::ZeroVector };
+		FVector2D FocusRange{ FVector2D::ZeroVector };
+		float SpaceScale{ 0.0f };
+		bool bApply{ false };
+		const UTechnocraneLensProfile* LensProfile{ nullptr };
+		uint32 LensRevision{ 0 };
+
+		bool operator==(const FCalibrationInputs& Other) const
+		{
+			return Zoom == Other.Zoom && Iris == Other.Iris && Focus == Other.Focus
+				&& ZoomRange == Other.ZoomRange && IrisRange == Other.IrisRange && FocusRange == Other.FocusRange
+				&& SpaceScale == Other.SpaceScale && bApply == Other.bApply
+				&& LensProfile == Other.LensProfile && LensRevision == Other.LensRevision;
+		}
+	};
+
+	FCalibrationInputs MakeCalibrationInputs() const;
+	/** tick again after a setter, when the component sleeps */
+	void WakeUp();
+	bool CanSleep() const;
+
+	FCalibrationInputs LastCalibrationInputs;
+	bool bCalibrationValid{ false };
+	/** ticks in a row without a calibration change */
+	int32 IdleTicks{ 0 };
 };
@@ -0,0 +1,69 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClearanceQuery.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CollisionQueryParams.h"
+#include "CollisionShape.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "TechnocraneClearance.h"
+
+class UWorld;
+struct FOverlapResult;
+
+/** clearance of a whole crane against the set, the closest part is reported */
+struct FCraneClearanceResult
+{
+	/** distance from the crane body to the closest geometry in cm, the search distance when nothing is close */
+	float MinClearance{ 0.0f };
+	bool bCollision{ false };
+	/** the first crane part in collision, from the column to the head */
+	int32 CollisionJoint{ INDEX_NONE };
+	FName CollisionActor;
+};
+
+/**
+ * Async overlaps around world space crane parts.
+ *  A batch is issued on one frame and collected on the next one, the world keeps async results for one frame only,
+ *  so the query has to be collected every frame before a new batch is issued.
+ */
+class TECHNOCRANEPLUGIN_API FCraneClearanceQuery
+{
+public:
+
+	using FCapsules = TArray<FCraneClearanceCapsule, TFixedAllocator<FCraneRigClearance::MaxCapsules>>;
+
+	/** issue async overlaps for every capsule, a pending batch is dropped */
+	void Issue(UWorld& World, const FCapsules& InCapsules, const ECollisionChannel Channel, const float SearchDistance, const FCollisionQueryParams& Params);
+
+	/**
+	 * collect the batch issued on the previous frame
+	 * @return false when there is no batch, or when its results have expired, the batch is dropped either way
+	 */
+	bool Collect(UWorld& World, FCraneClearanceResult& OutResult);
+
+	bool IsPending() const { return Handles.Num() > 0; }
+
+	void Reset();
+
+	/** a query shape around a crane part grown by the search distance, engine capsules are up aligned */
+	static FCollisionShape MakeShape(const FCraneClearanceCapsule& Capsule, const float SearchDistance);
+
+	/**
+	* distance from a crane part surface to the closest overlapped body, the search distance when nothing is close.
+	*  A body without a distance query (complex collision only) is taken as touching the part
+	*/
+	static float ComputeClearance(const FCraneClearanceCapsule& Capsule, TArrayView<const FOverlapResult> Overlaps, const float SearchDistance, const AActor*& OutActor);
+
+private:
+
+	TArray<FTraceHandle, TFixedAllocator<FCraneRigClearance::MaxCapsules>> Handles;
+	FCapsules Capsules;
+	float SearchDistance{ 0.0f };
+};
@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneClusterSamples.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/** identity of a received crane sample, the same on every machine that receives the same stream */
+struct FCraneSampleKey
+{
+	int32 PacketNumber{ INDEX_NONE };
+	/** hours, minutes, seconds and frames packed from the high byte down, zero when a packet has no timecode */
+	uint32 Timecode{ 0 };
+
+	bool IsValid() const { return PacketNumber != INDEX_NONE; }
+
+	bool operator==(const FCraneSampleKey& Other) const { return PacketNumber == Other.PacketNumber && Timecode == Other.Timecode; }
+	bool operator!=(const FCraneSampleKey& Other) const { return !(*this == Other); }
+
+	/** an earlier sample, by timecode first and then by packet number */
+	bool operator<(const FCraneSampleKey& Other) const
+	{
+		return (Timecode != Other.Timecode) ? Timecode < Other.Timecode : PacketNumber < Other.PacketNumber;
+	}
+};
+
+/** a crane stream that takes part in a cluster sample selection, implemented by the LiveLink source */
+class ICraneClusterSampleSource
+{
+public:
+	virtual ~ICraneClusterSampleSource() = default;
+
+	/** the same on every node for the same crane stream, no separators of a serialized selection */
+	virtual FString GetClusterSourceId() const = 0;
+	/** the latest received sample, Delay latest samples are skipped */
+	virtual FCraneSampleKey GetLatestSample(const int32 Delay) const = 0;
+	/** push a received sample into LiveLink on the game thread, waits for a late sample, false when it is not received */
+	virtual bool PushSample(const FCraneSampleKey& Key, const double WaitSeconds) = 0;
+};
+
+enum class ECraneClusterMode : uint8
+{
+	/** every source pushes every sample it receives */
+	Disabled,
+	/** the node chooses a sample of every source for a frame */
+	Primary,
+	/** the node evaluates samples chosen by the primary */
+	Secondary
+};
+
+/**
+ * Sample selection shared by the crane sources of a render cluster.
+ *  With the selection on, sources keep received samples in a ring and push only the sample chosen for a rendered frame.
+ *  The primary node chooses the samples, the choice is replicated to other nodes as a string that they apply to their own rings.
+ *  All calls but GetMode are made on the game thread.
+ */
+class TECHNOCRANEPLUGIN_API FTechnocraneClusterSamples
+{
+public:
+
+	static void SetMode(const ECraneClusterMode InMode);
+	/** safe to call from any thread */
+	static ECraneClusterMode GetMode() { return Mode.load(std::memory_order_acquire); }
+	static bool IsEnabled() { return GetMode() != ECraneClusterMode::Disabled; }
+
+	static void RegisterSource(ICraneClusterSampleSource* Source);
+	static void UnregisterSource(ICraneClusterSampleSource* Source);
+
+	/** primary node, choose the latest samples of all sources and push them, returns the serialized selection */
+	static FString SelectSamples();
+	/** secondary node, push samples of a serialized primary selection */
+	static bool ApplySelection(const FString& Selection);
+
+	static FString GetLastSelection() { return LastSelection; }
+	/** frames with a selection and samples of a selection that were not received in time */
+	static uint32 GetNumSelections() { return NumSelections; }
+	static uint32 GetNumMissedSamples() { return NumMissedSamples; }
+
+private:
+
+	static std::atomic<ECraneClusterMode> Mode;
+	static TArray<ICraneClusterSampleSource*> Sources;
+
+	static FString LastSelection;
+	static uint32 NumSelections;
+	static uint32 NumMissedSamples;
+};
@@ -9,8 +9,12 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
+#include "Misc/PackageName.h"
+#include "UObject/SoftObjectPtr.h"
 #include "TechnocraneData.generated.h"
 
+class USkeletalMesh;
+
 /** Calculated values from simulation */
 USTRUCT(BlueprintType)
 struct FCraneSimulationData
@@ -28,6 +32,30 @@ struct FCraneSimulationData
 	/** the current length of beans, in cm */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Output", meta = (Units = cm))
 	float ExtensionLength{ 0.0f };
+
+	/** distance to the closest crane limit from a reachability field, negative when the target is out of reach, in cm */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Output", meta = (Units = cm))
+	float ReachMargin{ 0.0f };
+
+	/** the target is closer to crane limits than a warning margin, the solver is about to clamp */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Output")
+	bool bNearReachLimit{ false };
+
+	/** smallest distance from the crane column, beams and head to the set, up to a search distance, negative when they intersect, in cm */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Output", meta = (Units = cm))
+	float MinClearance{ 0.0f };
+
+	/** the crane body intersects the set */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Output")
+	bool bClearanceCollision{ false };
+
+	/** a crane joint at the start of the first crane part that intersects the set */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Output")
+	FName CollisionJoint;
+
+	/** an actor of the set that the crane intersects first */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Output")
+	FName CollisionActor;
 };
 
 /** Structure that defines a level up table entry */
@@ -50,7 +78,7 @@ public:
 		, PanMin(270.0f)
 		, PanMax(270.0f)
 		, CameraOffsetX(26.0f)
-		, CraneModelPath("/TechnocranePlugin/TechnodollyModel")
+		, CraneModel(FSoftObjectPath(TEXT("/TechnocranePlugin/TechnodollyModel.TechnodollyModel")))
 	{}
 
 	
@@ -102,7 +130,39 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = CameraPivot)
 		float CameraOffsetX;
 
-	/** Icon to use for Achivement */
+	/** Crane model of the preset, loaded on demand */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Data)
-		FString CraneModelPath;
+		TSoftObjectPtr<USkeletalMesh> CraneModel;
+
+	/** crane geometry derived from the crane model, stored by the editor so a simulation doesn't load the model */
+	UPROPERTY()
+		TArray<uint8> BakedRigGeometry;
+
+	/** a package path of the crane model, presets saved before the soft reference are converted on load */
+	UPROPERTY()
+		FString CraneModelPath_DEPRECATED;
+
+	FSoftObjectPath GetCraneModelPath() const { return CraneModel.ToSoftObjectPath(); }
+
+	void PostSerialize(const FArchive& Ar)
+	{
+		if (!Ar.IsLoading() || CraneModelPath_DEPRECATED.IsEmpty())
+		{
+			return;
+		}
+
+		// the path in a preset could be a package name without an object name
+		const FString& Path = CraneModelPath_DEPRECATED;
+		CraneModel = (Path.Contains(TEXT("."))) ? FSoftObjectPath(Path) : FSoftObjectPath(Path + TEXT(".") + FPackageName::GetShortName(Path));
+		CraneModelPath_DEPRECATED.Empty();
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FCraneData> : public TStructOpsTypeTraitsBase2<FCraneData>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
 };
\ No newline at end of file
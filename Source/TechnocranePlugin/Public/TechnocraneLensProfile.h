@@ -0,0 +1,102 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneLensProfile.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "TechnocraneLensTable.h"
+#include "TechnocraneLensProfile.generated.h"
+
+/**
+ * Calibration of a lens, maps raw zoom, focus and iris encoder values into lens values.
+ *  Calibration points are (encoder, value) pairs and values have to be monotonic over the encoder range.
+ *  Channels without points are calibrated by the camera uncalibrated ranges.
+ *  Focus distances are in cm, use ComputeFocusDistance to get a focus distance with or without a profile.
+ */
+UCLASS(BlueprintType, ClassGroup = "Technocrane")
+class TECHNOCRANEPLUGIN_API UTechnocraneLensProfile : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** zoom encoder to a focal length in mm */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Lens Calibration")
+	TArray<FVector2D> FocalLengthPoints;
+
+	/** focus encoder to a focus distance in cm */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Lens Calibration")
+	TArray<FVector2D> FocusDistancePoints;
+
+	/** iris encoder to a T-stop */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Lens Calibration")
+	TArray<FVector2D> TStopPoints;
+
+	/** number of lookup table entries over an encoder range */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Lens Calibration", meta = (ClampMin = 2, ClampMax = 65536))
+	int32 TableSize{ 1024 };
+
+	/** resample calibration points into lookup tables */
+	UFUNCTION(CallInEditor, BlueprintCallable, Category = "Lens Calibration")
+	void Build();
+
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Lens")
+	bool HasFocalLength() const { return FocalLengthTable.IsValid(); }
+
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Lens")
+	bool HasFocusDistance() const { return FocusDistanceTable.IsValid(); }
+
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Lens")
+	bool HasTStop() const { return TStopTable.IsValid(); }
+
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Lens")
+	float GetFocalLength(float Encoder) const { return FocalLengthTable.Evaluate(Encoder); }
+
+	/** focus distance in cm */
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Lens")
+	float GetFocusDistance(float Encoder) const { return FocusDistanceTable.Evaluate(Encoder); }
+
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Lens")
+	float GetTStop(float Encoder) const { return TStopTable.Evaluate(Encoder); }
+
+	/** lens values for many encoder samples at once, used to bake takes */
+	UFUNCTION(BlueprintCallable, Category = "Technocrane|Lens")
+	void GetFocalLengths(const TArray<float>& Encoders, TArray<float>& OutFocalLengths) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Technocrane|Lens")
+	void GetFocusDistances(const TArray<float>& Encoders, TArray<float>& OutFocusDistances) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Technocrane|Lens")
+	void GetTStops(const TArray<float>& Encoders, TArray<float>& OutTStops) const;
+
+	const FCraneLensTable& GetFocalLengthTable() const { return FocalLengthTable; }
+	const FCraneLensTable& GetFocusDistanceTable() const { return FocusDistanceTable; }
+	const FCraneLensTable& GetTStopTable() const { return TStopTable; }
+
+	/**
+	 * Focus distance in cm for a raw focus encoder value. A focus table gives cm directly, without a table
+	 *  the uncalibrated range gives a distance in crane units (m) and it's scaled by SpaceScale.
+	 * @return false when the focus can't be calibrated
+	 */
+	static bool ComputeFocusDistance(const FCraneLensTable& FocusTable, const float Encoder, const FVector2D& Range, const float SpaceScale, float& OutFocusDistance);
+
+	/** incremented every time tables are rebuilt */
+	uint32 GetRevision() const { return Revision; }
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	FCraneLensTable FocalLengthTable;
+	FCraneLensTable FocusDistanceTable;
+	FCraneLensTable TStopTable;
+
+	uint32 Revision{ 0 };
+};
@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocranePresetRegistry.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TechnocraneRigSolver.h"
+#include "TechnocraneData.h"
+#include "UObject/ObjectKey.h"
+
+// forward
+class UDataTable;
+class USkeletalMesh;
+enum class ECranePreviewModelsEnum : uint8;
+
+using FCraneRigGeometryPtr = TSharedPtr<const FCraneRigGeometry, ESPMode::ThreadSafe>;
+
+/** a crane preset compiled from the crane presets data table */
+struct FCranePresetEntry
+{
+	FName RowName;
+	FCraneData Data;
+	/** subset of the preset values for the rig solver */
+	FCraneRigPreset Preset;
+	/** crane model of the preset */
+	FSoftObjectPath ModelPath;
+	/** geometry stored with the preset, nullptr when it's missing or derived from another crane model */
+	FCraneRigGeometryPtr BakedGeometry;
+};
+
+using FCranePresetEntryPtr = TSharedPtr<const FCranePresetEntry, ESPMode::ThreadSafe>;
+
+/**
+ * Crane presets indexed by a crane model, the data table is looked up once.
+ *  Crane geometry derived from a skeletal mesh is shared between all rigs that use the mesh.
+ *  Entries are built on the game thread and never change, an edited table swaps in new entries,
+ *  so presets and geometry could be requested from any thread. A rig keeps the entry it has found until it looks it up again.
+ */
+class TECHNOCRANEPLUGIN_API FTechnocranePresetRegistry
+{
+public:
+
+	static FTechnocranePresetRegistry& Get();
+
+	/** compile presets from a given table or from the plugin crane presets data table, only the first call has effect */
+	bool Initialize(const UDataTable* InCranesData = nullptr);
+	bool IsInitialized() const { return bInitialized; }
+
+	int32 Num() const;
+
+	/** a preset of the crane model, nullptr when the registry is not initialized or the preset is missing */
+	FCranePresetEntryPtr Find(const ECranePreviewModelsEnum CraneModel) const;
+	FCranePresetEntryPtr Find(const int32 CraneModel) const;
+	FCranePresetEntryPtr FindByRowName(const FName& RowName) const;
+
+	/** crane geometry of a skeletal mesh, derived on the first request and shared after that */
+	FCraneRigGeometryPtr FindOrBuildGeometry(const USkeletalMesh* Mesh, const FName& ColumnRotationBone);
+
+	/** crane geometry of a preset, stored with the preset or derived from the crane model when it's missing, game thread */
+	FCraneRigGeometryPtr LoadGeometry(const ECranePreviewModelsEnum CraneModel);
+	FCraneRigGeometryPtr LoadGeometry(const int32 CraneModel);
+
+#if WITH_EDITOR
+	/** derive geometry of every crane model and store it with the presets, returns the number of stored presets */
+	int32 BakeGeometry();
+#endif
+
+	/** forget derived geometry, rigs keep their shared copies until they rebuild bones */
+	void ResetGeometry();
+
+	/** called on module shutdown */
+	void Shutdown();
+
+private:
+
+	/** compile rows of the table into new entries and swap them in */
+	void UpdateEntries(const UDataTable& CranesData);
+	/** replace an entry of the crane model */
+	void SetEntry(const int32 CraneModel, FCranePresetEntryPtr Entry);
+
+#if WITH_EDITOR
+	/** a reimported crane model has to derive its geometry again, other meshes are ignored */
+	void OnObjectPropertyChanged(UObject* Object, struct FPropertyChangedEvent& PropertyChangedEvent);
+	FDelegateHandle ObjectPropertyChangedHandle;
+
+	/** an edited or reimported presets table, changed rows are compiled again */
+	void OnDataTableChanged();
+	/** store geometry in a presets table row, the table has to be saved to keep it */
+	void BakeGeometry(const int32 CraneModel, const FCraneRigGeometry& Geometry);
+	TWeakObjectPtr<UDataTable> CranesDataTable;
+	FDelegateHandle DataTableChangedHandle;
+#endif
+
+	bool bInitialized{ false };
+
+	/** an entry per crane model, nullptr for missing rows */
+	TArray<FCranePresetEntryPtr> Entries;
+
+	/** guards entries and geometry */
+	mutable FCriticalSection GeometryLock;
+	TMap<TTuple<TObjectKey<USkeletalMesh>, FName>, FCraneRigGeometryPtr> Geometries;
+	/** geometry per crane model, it stays after the crane model is unloaded */
+	TMap<int32, FCraneRigGeometryPtr> ModelGeometries;
+};
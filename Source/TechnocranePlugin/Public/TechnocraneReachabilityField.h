@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneReachabilityField.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "TechnocraneRig.h"
+#include "TechnocraneReachField.h"
+#include "TechnocraneReachabilityField.generated.h"
+
+/**
+ * Precomputed reachability of a crane preset, answers how far a camera position is from crane tilt and extension limits.
+ *  Positions are in a crane rig local space, margins are in cm and negative when a position is out of reach.
+ */
+UCLASS(BlueprintType, ClassGroup = "Technocrane")
+class TECHNOCRANEPLUGIN_API UTechnocraneReachabilityField : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** crane preset to compute the reachability for */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reachability")
+	ECranePreviewModelsEnum CraneModel{ ECranePreviewModelsEnum::ECranePreview_Technodolly25 };
+
+	/** grid step, smaller cells give a more precise margin near limits */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reachability", meta = (Units = cm, ClampMin = 1.0))
+	float CellSize{ 10.0f };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reachability", meta = (Units = cm))
+	float MinExtension{ 0.0f };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reachability", meta = (Units = cm))
+	float MaxExtension{ 0.0f };
+
+	/** recompute the field from the crane preset data and the crane model */
+	UFUNCTION(CallInEditor, BlueprintCallable, Category = "Reachability")
+	bool Build();
+
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Reachability")
+	bool IsBuilt() const { return Field.IsValid(); }
+
+	/** signed distance to the closest crane limit in cm, negative when the position is out of reach */
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Reachability")
+	float GetReachMargin(const FVector& LocalPosition, float TrackPosition) const;
+
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Reachability")
+	bool IsReachable(const FVector& LocalPosition, float TrackPosition, float MinMargin = 0.0f) const;
+
+	/** margins for many positions at once */
+	UFUNCTION(BlueprintCallable, Category = "Technocrane|Reachability")
+	void GetReachMargins(const TArray<FVector>& LocalPositions, float TrackPosition, TArray<float>& OutMargins) const;
+
+	const FCraneReachField& GetField() const { return Field; }
+
+	/** true when the field is computed for the given crane model and its current kinematics */
+	bool IsBuiltFor(const ECranePreviewModelsEnum InCraneModel, const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset) const;
+
+	/**
+	 * A field to use with a rig of the given crane model. A stale field of the same model is rebuilt,
+	 *  for another crane model a transient field is built with the same cell size, Previous is reused when it still matches.
+	 */
+	static UTechnocraneReachabilityField* ResolveFor(UTechnocraneReachabilityField* InField, UObject* Outer, const ECranePreviewModelsEnum InCraneModel,
+		const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset, UTechnocraneReachabilityField* Previous);
+
+	virtual void Serialize(FArchive& Ar) override;
+
+private:
+	FCraneReachField Field;
+
+	void BuildFrom(const FCraneRigGeometry& Geometry, const FCraneRigPreset& Preset);
+};
@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneReceptionHealth.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "TechnocraneReceptionHealth.generated.h"
+
+/** link health of a crane source, counters of the hardware reception and rates derived from them */
+USTRUCT(BlueprintType)
+struct FCraneReceptionHealth
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** the same id a source is published with into shared memory, like Udp15246 or Com1 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reception")
+	FString SourceId;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reception")
+	bool bConnected{ false };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reception", meta = (Units = bytes))
+	int64 TotalBytesRead{ 0 };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reception")
+	int64 CompletePackets{ 0 };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reception")
+	int64 CheckSumErrors{ 0 };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reception")
+	int64 MissedSyncs{ 0 };
+
+	/** complete packets per second over the last sample interval */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reception")
+	float PacketRate{ 0.0f };
+
+	/** checksum errors and missed syncs per second over the last sample interval */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reception")
+	float ErrorRate{ 0.0f };
+
+	/** received packets that wait for the game thread to push them into LiveLink */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reception")
+	int32 QueueDepth{ 0 };
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reception", meta = (Units = s))
+	float SecondsSinceLastPacket{ 0.0f };
+};
+
+/**
+ * Reception health of all crane sources, sampled on their receiver threads a few times per second.
+ *  The latest samples feed the Technocrane stat group and Insights counters, totals over all sources.
+ */
+class TECHNOCRANEPLUGIN_API FTechnocraneReceptionStats
+{
+public:
+	static constexpr double SampleInterval = 0.25;
+
+	/** safe to call from any thread */
+	static void Update(const FCraneReceptionHealth& Health);
+	static void Remove(const FString& SourceId);
+
+	static TArray<FCraneReceptionHealth> GetAll();
+	static bool Find(const FString& SourceId, FCraneReceptionHealth& OutHealth);
+};
+
+UCLASS()
+class TECHNOCRANEPLUGIN_API UTechnocraneReceptionLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	/** The latest reception health of every crane source */
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Reception")
+	static TArray<FCraneReceptionHealth> GetReceptionHealth();
+
+	/** The latest reception health of a source with the id, false when there is no such source */
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Reception")
+	static bool FindReceptionHealth(const FString& SourceId, FCraneReceptionHealth& OutHealth);
+};
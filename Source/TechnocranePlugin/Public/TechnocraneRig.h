@@ -9,13 +9,18 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Engine/EngineBaseTypes.h"
 #include "Engine/DataTable.h"
+#include "Misc/FrameRate.h"
 #include "TechnocraneData.h"
 #include "TechnocraneRig.generated.h"
 
 class USkeletalMeshComponent;
 class UPoseableMeshComponent;
 class USkeletalMesh;
+class UInstancedStaticMeshComponent;
+class UTechnocraneReachabilityField;
+class UMovieSceneSignedObject;
 
 /** Shake start offset parameter */
 UENUM(BlueprintType)
@@ -33,6 +38,17 @@ enum class ECranePreviewModelsEnum : uint8
 	ECranePreview_Count					UMETA(Hidden)
 };
 
+/** how a crane rig updates depending on its significance */
+UENUM(BlueprintType)
+enum class ECraneRigUpdateTier : uint8
+{
+	FullRate = 0		UMETA(DisplayName = "Full Rate"),
+	ReducedRate = 1		UMETA(DisplayName = "Reduced Rate"),
+	SimulationOnly = 2	UMETA(DisplayName = "Simulation Only"),
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCraneSimulationUpdated, const FCraneSimulationData&, SimulationData);
+
 class FTechnocraneRigImpl;
 
 class FTechnocraneRig
@@ -47,6 +63,31 @@ public:
 	TUniquePtr<FTechnocraneRigImpl> Impl;
 };
 
+/**
+ * clearance of a crane rig is checked every frame after the pose is evaluated,
+ *  async overlaps have to be collected on the next frame, while the actor tick is throttled
+ */
+USTRUCT()
+struct FCraneRigClearanceTickFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+	class ATechnocraneRig* Target{ nullptr };
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FCraneRigClearanceTickFunction> : public TStructOpsTypeTraitsBase2<FCraneRigClearanceTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
 /**
  * an actor that simulates a Technocrane Crane Rig to follow a target camera position
  *  in case tracks are used, the position on track could be received from live or exported tecnocrane data
@@ -63,11 +104,15 @@ public:
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
+	virtual void BeginDestroy() override;
+
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
 	virtual bool ShouldTickIfViewportsOnly() const override;
+	virtual void RegisterActorTickFunctions(bool bRegister) override;
 
 	/** Defines how to begin (either at zero, or at a randomized value. */
 	UPROPERTY(EditAnywhere, Category = "Crane Controls")
@@ -81,10 +126,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Controls")
 	bool bShowTracksIfSupported{ true };
 
-	/** Controls the amount of rails for the crane rig. */
-	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, Category = "Crane Controls", meta = (ClampMin = 0, ClampMax = 6))
+	/** Controls the amount of track segments in the crane run, zero lays the run out up to the farthest crane track position */
+	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, Category = "Crane Controls", meta = (ClampMin = 0, ClampMax = 200, UIMax = 50))
 	int AmountOfTracks{ 0 };
 
+	/** Track position where the run of tracks begins */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Controls", meta = (Units = cm))
+	float TracksStartPosition{ 0.0f };
+
+	/** Turn between neighbour track segments for a curved run, zero for a straight one. The crane simulation follows a straight line */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Controls", meta = (Units = degrees, ClampMin = -45.0, ClampMax = 45.0))
+	float TracksCurveAngle{ 0.0f };
+
 	/** Controls the attaced camera pivot offset. */
 	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, Category = "Crane Controls", meta = (Units = cm))
 	FVector CameraPivotOffset;
@@ -93,6 +146,98 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Controls")
 	bool bShowDebug{ false };
 
+	/** Precomputed reachability of the crane preset, used to warn when the target comes close to crane limits */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Reachability")
+	UTechnocraneReachabilityField* ReachabilityField{ nullptr };
+
+	/** Warn when the target is closer to crane limits than the margin */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Reachability", meta = (Units = cm, ClampMin = 0.0))
+	float ReachWarningMargin{ 20.0f };
+
+	/** The crane always evaluates at full rate, even when it's off-screen or far away from a view */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Update")
+	bool bHeroCrane{ false };
+
+	/** Beyond the distance from the closest view the crane pose is evaluated at a reduced rate */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Update", meta = (Units = cm, ClampMin = 0.0))
+	float ReducedRateDistance{ 5000.0f };
+
+	/** Pose updates per second for a distant crane */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Update", meta = (ClampMin = 1.0))
+	float ReducedUpdateRate{ 10.0f };
+
+	/** Current update tier, an off-screen crane skips the pose and only solves simulation data */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient, Category = "Crane Update")
+	ECraneRigUpdateTier UpdateTier{ ECraneRigUpdateTier::FullRate };
+
+	/** Use baked crane poses when they are valid, instead of solving the crane every frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Pose Cache")
+	bool bUsePoseCache{ true };
+
+	/** Time in the baked shot, animated by Sequencer when the shot is baked */
+	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetPoseCacheTime, Category = "Crane Pose Cache", meta = (Units = s))
+	float PoseCacheTime{ 0.0f };
+
+	/** Check the evaluated crane column, beams and head against the set, results are one frame behind */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Clearance")
+	bool bCheckClearance{ false };
+
+	/** Set geometry that blocks or overlaps the channel is checked */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Clearance")
+	TEnumAsByte<ECollisionChannel> ClearanceChannel{ ECC_Visibility };
+
+	/** Clearance is measured up to the distance, further geometry is not looked up */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Clearance", meta = (Units = cm, ClampMin = 0.0))
+	float ClearanceSearchDistance{ 100.0f };
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Clearance", meta = (Units = cm, ClampMin = 0.0))
+	float ColumnClearanceRadius{ 30.0f };
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Clearance", meta = (Units = cm, ClampMin = 0.0))
+	float BeamClearanceRadius{ 15.0f };
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Clearance", meta = (Units = cm, ClampMin = 0.0))
+	float HeadClearanceRadius{ 35.0f };
+
+	/** Set a camera actor to follow */
+	UFUNCTION(BlueprintCallable, Category = "Technocrane")
+	void SetTargetActor(AActor* InTargetActor);
+
+	/** the setter is used by sequencer to pick a baked pose while scrubbing */
+	UFUNCTION(BlueprintSetter)
+	void SetPoseCacheTime(float InTime);
+
+	/**
+	 * Bake crane poses for camera transforms of every frame of a shot, frames are solved in parallel on worker threads
+	 * @param CameraTransforms world transforms of the target camera actor, the first one is at zero pose cache time
+	 * @param TrackPositions camera track position of every frame, the current one of the target camera when empty
+	 * @param Source the camera track, the cache is dropped when the track is modified
+	 * @param TrackPositionSource the track of camera track positions, the cache is dropped when the track is modified
+	 */
+	bool BakePoseCache(TArrayView<const FTransform> CameraTransforms, TArrayView<const float> TrackPositions, const FFrameRate FrameRate,
+		const UMovieSceneSignedObject* Source, const UMovieSceneSignedObject* TrackPositionSource = nullptr);
+
+	void ClearPoseCache();
+
+	UFUNCTION(BlueprintPure, Category = "Technocrane")
+	bool HasPoseCache() const;
+
+	/**
+	 * Check clearance of every baked frame against the set, frames are checked in parallel on worker threads
+	 * @param OutClearance min clearance per frame of the baked shot, in cm
+	 * @return the first frame where the crane intersects the set, INDEX_NONE when the shot is clear or not baked
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Technocrane|Clearance")
+	int32 CheckPoseCacheClearance(TArray<float>& OutClearance) const;
+
+	/** Length of the run of tracks along the crane in cm, measured straight, zero when there are no track segments */
+	UFUNCTION(BlueprintPure, Category = "Technocrane")
+	float GetTracksLength() const;
+
+	/** Signed distance from a world location to the closest crane limit in cm, negative when the location is out of reach */
+	UFUNCTION(BlueprintPure, Category = "Technocrane|Reachability")
+	float GetReachMargin(const FVector& WorldLocation) const;
+
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 	virtual void PostEditUndo() override;
@@ -105,15 +250,50 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient, Category = "Output", meta = (Units = cm))
 	FCraneSimulationData	SimulationData;
 
+	/** Called on the game thread every time the crane is evaluated, or solved by the rig when the crane is off-screen */
+	UPROPERTY(BlueprintAssignable, Category = "Output")
+	FOnCraneSimulationUpdated OnSimulationUpdated;
+
 private:
 
-	bool PreloadPreviewMeshes();
+	void CreatePreviewMeshComponent();
+	/** request an async load of the selected crane model */
 	void UpdatePreviewMeshes();
+	void OnPreviewMeshLoaded(ECranePreviewModelsEnum InCraneModel);
+	void ApplyPreviewMesh(USkeletalMesh* InPreviewMesh, const TSharedPtr<const struct FCranePresetEntry, ESPMode::ThreadSafe>& Preset);
 	bool PreloadTracksMesh();
 	void UpdateTracksMesh();
+	/** add or remove track segments to match the amount of tracks, the layout is updated only when it changes */
+	void UpdateTrackSegments();
+	/** a segment placed at the end of a previous one, in the rig space */
+	FTransform GetTrackSegmentTransform(const FVector& SegmentStart, const float Heading) const;
+	float GetTrackSegmentLength() const;
+	/** amount of tracks, or the segments to cover track positions the crane has been at when the amount is zero */
+	int32 GetNumTrackSegments() const;
+	/** crane position on tracks, from the technocrane camera component of the target when there is one */
+	float GetCraneTrackPosition() const;
 
 	void UpdateCraneComponents();
 
+	void UpdateSignificance();
+	void SetUpdateTier(const ECraneRigUpdateTier InTier);
+	void ApplyUpdateTier(const ECraneRigUpdateTier InTier);
+	void ResetTierStats();
+	/** solve the crane without a pose, when the mesh is not evaluated */
+	void UpdateSimulationData();
+	void ConfigureAnimInstance();
+	/** pick a reachability field computed for the crane model and its current kinematics */
+	void ResolveReachabilityField();
+	/** drop the pose cache when the camera track or its track positions, the pivot offset, the preset or the rig transform has changed, and pass it to the anim instance */
+	void UpdatePoseCache();
+	/** collect clearance of the last batch of async overlaps and issue a new batch for the evaluated pose */
+	void UpdateClearance();
+	/** the clearance tick runs every frame while clearance is checked */
+	void EnableClearanceTick();
+	void ApplyClearance(FCraneSimulationData& InOutData) const;
+	/** simulation output pushed by the anim instance after an evaluation */
+	void HandleSimulationUpdated(const FCraneSimulationData& InData);
+
 	/** Root component to give the whole actor a transform. */
 	UPROPERTY(EditDefaultsOnly, Category = "Crane Components")
 	USceneComponent* TransformComponent{ nullptr };
@@ -122,9 +302,9 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Crane Components")
 	FComponentReference		TargetComponent;
 
-	/** Preview meshes for visualization */
+	/** Preview mesh of the selected crane model, loaded on demand */
 	UPROPERTY(Transient)
-	TArray<USkeletalMesh*> PreviewMeshes;
+	USkeletalMesh* PreviewMesh{ nullptr };
 	
 	UPROPERTY(Transient)
 	USkeletalMeshComponent* MeshComponent{ nullptr };
@@ -133,17 +313,29 @@ private:
 	UPROPERTY(Transient)
 	UStaticMesh* CraneTracksMesh{ nullptr };
 
-	/** mesh component for tracks */
+	/** instanced track segments, the whole run is drawn at once */
 	UPROPERTY(Transient)
-	UStaticMeshComponent* CraneTracksMeshComponent{ nullptr };
+	UInstancedStaticMeshComponent* CraneTracksMeshComponent{ nullptr };
 
 	/** Data table with crane presets, the asset is part of technocrane plugin content */
 	UPROPERTY(Transient)
 	UDataTable* CranesData{ nullptr };
 
+	/** Reachability field in use, a transient one when the assigned field is computed for another crane model */
+	UPROPERTY(Transient)
+	UTechnocraneReachabilityField* ActiveReachabilityField{ nullptr };
+
 private:
+	friend struct FCraneRigClearanceTickFunction;
+
+	FCraneRigClearanceTickFunction ClearanceTickFunction;
+
 	FTechnocraneRig				TechnocraneRig;
 	ECranePreviewModelsEnum		LastPreviewModel;
 	bool						bLastSupportTracks{ false };
 	float						LastTracksOffset{ 0.0f };
+	float						LastTracksStartPosition{ 0.0f };
+	float						LastTracksCurveAngle{ 0.0f };
+	/** the farthest track position since the run start has changed, an automatic run covers it */
+	float						TracksRunEnd{ 0.0f };
 };
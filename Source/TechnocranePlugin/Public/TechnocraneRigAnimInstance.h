@@ -10,6 +10,7 @@
 #include "Animation/AnimInstance.h"
 #include "Animation/AnimNodeBase.h"
 #include "AnimNode_TechnocraneRig.h"
+#include "TechnocraneSimulationOutput.h"
 
 #include "TechnocraneRigAnimInstance.generated.h"
 
@@ -18,6 +19,8 @@ class USkeletalMeshComponent;
 struct FAnimNode_TechnocraneRig;
 struct FTechnocraneRigInstanceProxy;
 
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnCraneSimulationData, const FCraneSimulationData&);
+
 ///////////////////////////
 /// Anim Instance 
 ///////////////////////////
@@ -30,20 +33,46 @@ class UTechnocraneRigAnimInstance : public UAnimInstance
 	friend FTechnocraneRigInstanceProxy;
 
 public:
+	UTechnocraneRigAnimInstance(const FObjectInitializer& ObjectInitializer);
+
 	/**
 	* Configure TechnocraneRig AnimInstance
 	* @param InTargetActor the actor which location will be used as a target for the crane simulation.
 	*/
-	void ConfigureAnimInstance(TWeakObjectPtr<AActor> InTargetActor, FCraneData& InCraneData, const FVector& InCameraPivotOffset, bool bShowDebug);
+	void ConfigureAnimInstance(TWeakObjectPtr<AActor> InTargetActor, const FCraneData& InCraneData, const FVector& InCameraPivotOffset, bool bShowDebug);
 	
-	void GetSimulationOutData(FCraneSimulationData& OutData);
+	void SetReachabilityField(UTechnocraneReachabilityField* InField, const float InWarningMargin);
+
+	/**
+	* baked crane poses to use instead of the solver, null to solve the crane again.
+	*  Cheap to call every frame, the proxy picks the cache and the time up in its PreUpdate
+	*/
+	void SetPoseCache(FCraneRigPoseCachePtr InPoseCache, const float InTime);
+
+	/** the latest published simulation output, safe to call while the animation is evaluated */
+	void GetSimulationOutData(FCraneSimulationData& OutData) const;
+
+	/** broadcasts on the game thread when a new simulation output is published */
+	FOnCraneSimulationData& OnSimulationUpdated() { return SimulationUpdatedEvent; }
 
 protected:
 	/** UAnimInstance interface */
 	virtual void NativeInitializeAnimation() override;
+	virtual void NativePostEvaluateAnimation() override;
 	virtual FAnimInstanceProxy* CreateAnimInstanceProxy() override;
 	/** UAnimInstance interface end*/
 	
 	UPROPERTY()
 	FAnimNode_TechnocraneRig AnimNode;
+
+	/** written by the proxy after every evaluation */
+	FCraneSimulationOutput SimulationOutput;
+	uint32 LastBroadcastVersion{ 0 };
+
+	/** game thread side of the pose cache, copied into the proxy before the animation update */
+	FCraneRigPoseCachePtr PoseCache;
+	float PoseCacheTime{ 0.0f };
+	bool bPoseCacheChanged{ false };
+
+	FOnCraneSimulationData SimulationUpdatedEvent;
 };
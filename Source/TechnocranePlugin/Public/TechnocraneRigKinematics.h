@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneRigKinematics.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TechnocraneRigSolver.h"
+#include "TechnocraneData.h"
+
+// forward
+struct FReferenceSkeleton;
+class AActor;
+
+/**
+ * A bridge between crane presets, skeletal meshes and the engine independent crane kinematics (TechnocraneKinematics module)
+ */
+class TECHNOCRANEPLUGIN_API FTechnocraneRigKinematics
+{
+public:
+
+	static FCraneRigPreset MakePreset(const FCraneData& InCraneData);
+
+	/** a row name of a crane model in the crane presets data table */
+	static FName GetPresetRowName(const int32 CraneModel);
+
+	/** load a crane preset from the plugin crane presets data table and derive geometry from its crane model */
+	static bool LoadPreset(const FName& RowName, FCraneData& OutCraneData, FCraneRigGeometry& OutGeometry);
+
+	/** derive crane geometry from a crane skeletal mesh reference skeleton */
+	static bool BuildGeometry(FCraneRigGeometry& OutGeometry, const FReferenceSkeleton& RefSkeleton, const FName& InColumnRotationBone);
+
+	/**
+	 * derive crane geometry from any bone hierarchy, crane joints are found by name
+	 * @param BoneNames a name for every bone
+	 * @param RefPose reference local transform for every bone
+	 * @param ParentIndices a parent bone index for every bone, INDEX_NONE for a root bone
+	 */
+	static bool BuildGeometry(FCraneRigGeometry& OutGeometry, TArrayView<const FName> BoneNames, TArrayView<const FTransform> RefPose,
+		TArrayView<const int32> ParentIndices, const FName& InColumnRotationBone);
+
+	/**
+	 * solve the crane to follow a given target
+	 * @param Target a camera attachment transform in the crane local space
+	 * @return false if the crane geometry is not valid
+	 */
+	static bool Evaluate(const FCraneData& InCraneData, const FCraneRigGeometry& Geometry, const FTransform& Target, const float TrackPosition,
+		FCraneRigPose& OutPose, FCraneSimulationData& OutData);
+
+	/**
+	 * solver input to follow a camera, the same way the crane rig anim node does
+	 * @param CameraActorTransform the camera pivot offset is applied along camera actor axes
+	 * @param CameraTransform world transform of the camera component
+	 * @param OwnerTransform crane rig transform, the target is computed in the crane rig space
+	 */
+	static void MakeCameraInput(const FTransform& CameraActorTransform, const FTransform& CameraTransform, const FVector& CameraPivotOffset,
+		const FTransform& OwnerTransform, FCraneRigSolverInput& OutInput);
+
+	/**
+	 * solver input to follow a cine camera actor, a track position is taken from a technocrane camera component when there is one
+	 * @return false when the target is not a cine camera actor
+	 */
+	static bool MakeTargetInput(const AActor* TargetActor, const FVector& CameraPivotOffset, const FTransform& OwnerTransform,
+		const float DefaultTrackPosition, FCraneRigSolverInput& OutInput);
+
+	static void ToSimulationData(const FCraneRigSolution& Solution, FCraneSimulationData& OutData);
+};
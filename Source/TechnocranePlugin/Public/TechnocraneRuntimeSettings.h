@@ -11,8 +11,17 @@
 #include "UObject/ObjectMacros.h"
 #include "UObject/Object.h"
 #include "Misc/FrameRate.h"
+#include "UObject/SoftObjectPtr.h"
 #include "TechnocraneRuntimeSettings.generated.h"
 
+/** what zoom and focus fields of FreeD messages carry */
+UENUM()
+enum class ECraneFreeDLensEncoding : uint8
+{
+	EncoderCounts = 0	UMETA(DisplayName = "Encoder Counts"),
+	Calibrated = 1		UMETA(DisplayName = "Focal Length and Focus Distance"),
+};
+
 /**
  * Implements the settings for the Paper2D plugin.
  */
@@ -65,6 +74,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = UncalibratedRanges)
 	FFloatInterval IrisRange;
 
+	// Per lens calibration tables for the live link source, used instead of uncalibrated ranges when set
+	UPROPERTY(EditAnywhere, config, Category = UncalibratedRanges)
+	TSoftObjectPtr<class UTechnocraneLensProfile> LensProfile;
+
 	// Specify a default packet raw data space scale
 	UPROPERTY(EditAnywhere, config, Category = Settings)
 	bool bPacketContainsRawAndCalibratedData;
@@ -72,4 +85,53 @@ public:
 	// Default camera frame rate
 	UPROPERTY(EditAnywhere, config, Category = Settings)
 	FFrameRate	CameraFrameRate;
+
+	// Publish decoded samples into a named shared memory ring, other processes on the machine read them without a socket to the crane
+	UPROPERTY(EditAnywhere, config, Category = NetworkSettings)
+	bool bPublishSharedSamples;
+
+	// Re-send decoded samples as compact datagrams, other editor instances receive them with a Technocrane Multicast LiveLink source
+	UPROPERTY(EditAnywhere, config, Category = NetworkSettings)
+	bool bMulticastSamples;
+
+	// A multicast group (or any udp endpoint, like 127.0.0.1 for a loopback) and a port of decoded sample datagrams
+	UPROPERTY(EditAnywhere, config, Category = NetworkSettings)
+	FString MulticastEndpoint;
+
+	// How many network hops multicast datagrams pass, 1 keeps them in the local network
+	UPROPERTY(EditAnywhere, config, Category = NetworkSettings, meta = (ClampMin = "1", ClampMax = "255"))
+	int32 MulticastTtl;
+
+	// Stream decoded samples out as FreeD D1 messages at the crane rate
+	UPROPERTY(EditAnywhere, config, Category = FreeDSettings)
+	bool bFreeDOutput;
+
+	// An endpoint FreeD messages are sent to
+	UPROPERTY(EditAnywhere, config, Category = FreeDSettings)
+	FString FreeDOutputEndpoint;
+
+	// An endpoint a Technocrane FreeD LiveLink source receives messages on, 0.0.0.0 for any address.
+	// A source doesn't start on a local port the FreeD output is sent to, it would receive the crane back
+	UPROPERTY(EditAnywhere, config, Category = FreeDSettings)
+	FString FreeDInputEndpoint;
+
+	// Zoom and focus of sent and received FreeD messages, raw encoder counts or a focal length in 1/1000 mm and a focus distance in mm
+	UPROPERTY(EditAnywhere, config, Category = FreeDSettings)
+	ECraneFreeDLensEncoding FreeDLensEncoding;
+
+	// FreeD encoder counts per unit of a raw crane zoom and focus encoder value
+	UPROPERTY(EditAnywhere, config, Category = FreeDSettings, meta = (ClampMin = "1.0", EditCondition = "FreeDLensEncoding == ECraneFreeDLensEncoding::EncoderCounts"))
+	float FreeDEncoderScale;
+
+	// A camera id of sent FreeD messages
+	UPROPERTY(EditAnywhere, config, Category = FreeDSettings, meta = (ClampMin = "0", ClampMax = "255"))
+	int32 FreeDCameraId;
+
+	// In a render cluster the primary node chooses a sample that many samples older than the latest one, a headroom for other nodes to receive it
+	UPROPERTY(EditAnywhere, config, Category = ClusterSettings, meta = (ClampMin = "0", ClampMax = "32"))
+	int32 ClusterSampleDelay;
+
+	// How long a cluster node waits for a sample chosen by the primary node before it renders a frame without it, in milliseconds
+	UPROPERTY(EditAnywhere, config, Category = ClusterSettings, meta = (ClampMin = "0.0", ClampMax = "20.0"))
+	float ClusterSampleWaitTime;
 };
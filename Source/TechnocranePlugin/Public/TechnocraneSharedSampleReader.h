@@ -0,0 +1,177 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSharedSampleReader.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "TechnocraneSharedSamples.h"
+
+#include <string>
+
+#if defined(_WIN32)
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+/**
+ * Header only reader of crane samples published by the plugin, for processes outside of the engine.
+ *  Any number of readers share one region, a reader never blocks the publisher and a slow reader loses the oldest samples.
+ *
+ *  NTechnocraneShared::CSampleReader reader;
+ *  if (reader.Open("Udp15246"))
+ *  {
+ *      NTechnocraneShared::SSample sample;
+ *      while (reader.ReadNext(sample)) { ... }
+ *  }
+ */
+namespace NTechnocraneShared
+{
+	class CSampleReader
+	{
+	public:
+		CSampleReader() = default;
+		CSampleReader(const CSampleReader&) = delete;
+		CSampleReader& operator=(const CSampleReader&) = delete;
+		~CSampleReader() { Close(); }
+
+		/** map a region of a crane source, reading starts from samples published after the call */
+		bool Open(const char* source_id)
+		{
+			Close();
+			const std::string name = std::string(RegionPrefix) + source_id;
+
+#if defined(_WIN32)
+			m_Mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+			if (!m_Mapping)
+			{
+				return false;
+			}
+
+			m_View = MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0);
+			MEMORY_BASIC_INFORMATION info;
+			m_Size = (m_View && VirtualQuery(m_View, &info, sizeof(info))) ? info.RegionSize : 0;
+#else
+			const int fd = shm_open(("/" + name).c_str(), O_RDONLY, 0);
+			if (fd < 0)
+			{
+				return false;
+			}
+
+			struct stat info;
+			if (fstat(fd, &info) == 0 && info.st_size > 0)
+			{
+				m_Size = static_cast<size_t>(info.st_size);
+				m_View = mmap(nullptr, m_Size, PROT_READ, MAP_SHARED, fd, 0);
+				m_View = (m_View == MAP_FAILED) ? nullptr : m_View;
+			}
+			close(fd);
+#endif
+			if (!m_View || !IsValidRegion(GetHeader(), m_Size))
+			{
+				Close();
+				return false;
+			}
+
+			m_NextIndex = GetHeader()->Count.load(std::memory_order_acquire);
+			m_NumLost = 0;
+			return true;
+		}
+
+		void Close()
+		{
+#if defined(_WIN32)
+			if (m_View)
+			{
+				UnmapViewOfFile(m_View);
+			}
+			if (m_Mapping)
+			{
+				CloseHandle(m_Mapping);
+			}
+			m_Mapping = nullptr;
+#else
+			if (m_View)
+			{
+				munmap(m_View, m_Size);
+			}
+#endif
+			m_View = nullptr;
+			m_Size = 0;
+		}
+
+		bool IsOpen() const { return m_View != nullptr; }
+
+		/** the latest sample, samples in between are not read */
+		bool ReadLatest(SSample& out)
+		{
+			uint64_t index = 0;
+			if (!IsOpen() || !NTechnocraneShared::ReadLatest(GetHeader(), out, &index))
+			{
+				return false;
+			}
+
+			m_NextIndex = index + 1;
+			return true;
+		}
+
+		/** the next sample in order of publishing, false when there is no new sample */
+		bool ReadNext(SSample& out)
+		{
+			if (!IsOpen())
+			{
+				return false;
+			}
+
+			const SHeader* header = GetHeader();
+			for (;;)
+			{
+				const uint64_t count = header->Count.load(std::memory_order_acquire);
+				if (m_NextIndex >= count)
+				{
+					return false;
+				}
+
+				// the publisher has lapped the reader
+				if (count - m_NextIndex > header->Capacity)
+				{
+					m_NumLost += count - header->Capacity - m_NextIndex;
+					m_NextIndex = count - header->Capacity;
+				}
+
+				const uint64_t index = m_NextIndex++;
+				if (ReadSample(header, index, out))
+				{
+					return true;
+				}
+				++m_NumLost;
+			}
+		}
+
+		/** samples overwritten before the reader got to them */
+		uint64_t GetNumLost() const { return m_NumLost; }
+		/** samples published by the plugin since the region was created */
+		uint64_t GetNumPublished() const { return (IsOpen()) ? GetHeader()->Count.load(std::memory_order_acquire) : 0; }
+
+	private:
+		const SHeader* GetHeader() const { return static_cast<const SHeader*>(m_View); }
+
+#if defined(_WIN32)
+		HANDLE		m_Mapping{ nullptr };
+#endif
+		void*		m_View{ nullptr };
+		size_t		m_Size{ 0 };
+
+		uint64_t	m_NextIndex{ 0 };
+		uint64_t	m_NumLost{ 0 };
+	};
+};
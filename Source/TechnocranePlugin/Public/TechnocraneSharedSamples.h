@@ -0,0 +1,151 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSharedSamples.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * Layout of decoded crane samples that the plugin publishes into a named shared memory region.
+ *  No engine types here, other processes on the same machine include the header to read samples without a socket to the crane.
+ *  A region is a header followed by a ring of slots and the publisher is the only writer.
+ *  Every slot is guarded by a sequence number, it is odd while the slot is written and readers retry or skip a torn slot.
+ */
+namespace NTechnocraneShared
+{
+	constexpr uint32_t Magic = 0x4E415243;
+	constexpr uint32_t Version = 1;
+	constexpr uint32_t DefaultCapacity = 256;
+
+	/** a region name is the prefix and a crane source id, like TechnocraneSamples_Udp15246 */
+	constexpr const char* RegionPrefix = "TechnocraneSamples_";
+
+	enum ESampleFlags : uint32_t
+	{
+		HasTimeCode = 1 << 0,
+		CameraOn = 1 << 1,
+		Running = 1 << 2,
+		ZoomCalibrated = 1 << 3,
+		FocusCalibrated = 1 << 4,
+		IrisCalibrated = 1 << 5
+	};
+
+	/** a decoded sample in engine units, cm and degrees, Z is up */
+	struct SSample
+	{
+		/** seconds of the publisher clock when the packet was decoded */
+		double		WorldTime;
+		int32_t		PacketNumber;
+		/** hours, minutes, seconds and frames packed from the high byte down */
+		uint32_t	Timecode;
+
+		float		Location[3];
+		/** pitch, yaw and roll */
+		float		Rotation[3];
+		float		TrackPosition;
+
+		float		FocalLength;
+		float		FocusDistance;
+		float		Aperture;
+
+		uint32_t	Flags;
+	};
+
+	struct alignas(64) SSlot
+	{
+		std::atomic<uint32_t>	Sequence;
+		SSample					Sample;
+	};
+
+	struct alignas(64) SHeader
+	{
+		uint32_t				Magic;
+		uint32_t				Version;
+		uint32_t				Capacity;
+		uint32_t				SlotSize;
+		/** samples published so far, the latest one is at (Count - 1) % Capacity */
+		std::atomic<uint64_t>	Count;
+	};
+
+	static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free, "shared atomics have to be lock free");
+
+	inline size_t GetRegionSize(const uint32_t capacity) { return sizeof(SHeader) + sizeof(SSlot) * capacity; }
+
+	inline SSlot* GetSlots(SHeader* header) { return reinterpret_cast<SSlot*>(header + 1); }
+	inline const SSlot* GetSlots(const SHeader* header) { return reinterpret_cast<const SSlot*>(header + 1); }
+
+	inline bool IsValidRegion(const SHeader* header, const size_t region_size)
+	{
+		return header && region_size >= sizeof(SHeader) && header->Magic == Magic && header->Version == Version
+			&& header->SlotSize == sizeof(SSlot) && header->Capacity > 0 && region_size >= GetRegionSize(header->Capacity);
+	}
+
+	/** a slot is written once per lap of the ring, the sequence grows by two with every write */
+	inline uint32_t GetSequence(const uint64_t index, const uint32_t capacity)
+	{
+		return static_cast<uint32_t>(2 * (index / capacity + 1));
+	}
+
+	/** the only writer, a reader never blocks it */
+	inline void WriteSample(SHeader* header, const uint64_t index, const SSample& sample)
+	{
+		SSlot& slot = GetSlots(header)[index % header->Capacity];
+		const uint32_t sequence = GetSequence(index, header->Capacity);
+
+		slot.Sequence.store(sequence - 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		memcpy(&slot.Sample, &sample, sizeof(SSample));
+
+		slot.Sequence.store(sequence, std::memory_order_release);
+		header->Count.store(index + 1, std::memory_order_release);
+	}
+
+	/** a sample with the index, false when it is not published yet, overwritten or being written */
+	inline bool ReadSample(const SHeader* header, const uint64_t index, SSample& out)
+	{
+		const SSlot& slot = GetSlots(header)[index % header->Capacity];
+		const uint32_t sequence = GetSequence(index, header->Capacity);
+
+		if (slot.Sequence.load(std::memory_order_acquire) != sequence)
+		{
+			return false;
+		}
+
+		memcpy(&out, &slot.Sample, sizeof(SSample));
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		return slot.Sequence.load(std::memory_order_relaxed) == sequence;
+	}
+
+	/** the latest published sample, false when nothing is published */
+	inline bool ReadLatest(const SHeader* header, SSample& out, uint64_t* out_index = nullptr)
+	{
+		// the writer could lap a slot between the count and the copy, the next latest sample is taken then
+		for (int attempt = 0; attempt < 4; ++attempt)
+		{
+			const uint64_t count = header->Count.load(std::memory_order_acquire);
+			if (count == 0)
+			{
+				return false;
+			}
+
+			if (ReadSample(header, count - 1, out))
+			{
+				if (out_index)
+				{
+					*out_index = count - 1;
+				}
+				return true;
+			}
+		}
+		return false;
+	}
+};
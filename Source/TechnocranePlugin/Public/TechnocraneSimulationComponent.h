@@ -0,0 +1,105 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSimulationComponent.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "TechnocraneData.h"
+#include "TechnocraneShared.h"
+#include "TechnocraneRig.h"
+#include "TechnocranePresetRegistry.h"
+#include "TechnocraneSimulationComponent.generated.h"
+
+class UTechnocraneReachabilityField;
+
+/**
+ * Crane simulation without a skeletal mesh or an animation instance.
+ *  The component transform is the crane base, crane kinematics are solved directly from a preset geometry,
+ *  so it works on a dedicated server and on headless render nodes.
+ */
+UCLASS(ClassGroup = Technocrane, meta = (BlueprintSpawnableComponent))
+class TECHNOCRANEPLUGIN_API UTechnocraneSimulationComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UTechnocraneSimulationComponent();
+
+	/** Crane model to simulate */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Controls")
+	ECranePreviewModelsEnum CraneModel{ ECranePreviewModelsEnum::ECranePreview_Technodolly25 };
+
+	/** Cine camera actor to follow */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Controls")
+	TObjectPtr<AActor> TargetActor;
+
+	/** Crane position on tracks, used when the target camera has no technocrane camera component */
+	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, Category = "Crane Controls", meta = (Units = cm))
+	float TrackPosition{ 0.0f };
+
+	/** Controls the attaced camera pivot offset. */
+	UPROPERTY(Interp, EditAnywhere, BlueprintReadWrite, Category = "Crane Controls", meta = (Units = cm))
+	FVector CameraPivotOffset{ -70.0f, 0.0f, 0.0f };
+
+	/** Compute component space transforms of crane joints, simulation data only needs the solver */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Controls")
+	bool bComputeJointTransforms{ true };
+
+	/** Precomputed reachability of the crane model to fill the reach margin of the simulation data */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Reachability")
+	TObjectPtr<UTechnocraneReachabilityField> ReachabilityField;
+
+	/** Distance to crane limits in cm, closer targets are reported as near the limit */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crane Reachability", meta = (Units = cm, ClampMin = 0.0))
+	float ReachWarningMargin{ 20.0f };
+
+	/** some calculated output from a crane simulation */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient, Category = "Output")
+	FCraneSimulationData SimulationData;
+
+	/** Called every time the crane is solved */
+	UPROPERTY(BlueprintAssignable, Category = "Output")
+	FOnCraneSimulationUpdated OnSimulationUpdated;
+
+	/** Solve the crane for the current target, called every tick */
+	UFUNCTION(BlueprintCallable, Category = "Technocrane")
+	bool Simulate();
+
+	/** Transform of a crane joint from the last simulation, in world or in the component space */
+	UFUNCTION(BlueprintCallable, Category = "Technocrane")
+	FTransform GetJointTransform(ECraneJoints Joint, bool bWorldSpace = true) const;
+
+	/** component space transforms of crane joints from the last simulation */
+	const FCraneRigPose& GetPose() const { return Pose; }
+
+	//~ Begin UActorComponent Interface
+	virtual void BeginPlay() override;
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	//~ End UActorComponent Interface
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+
+	/** preset and geometry of the selected crane model */
+	void UpdatePreset();
+
+	FCranePresetEntryPtr Preset;
+	FCraneRigGeometryPtr Geometry;
+	ECranePreviewModelsEnum LastCraneModel{ ECranePreviewModelsEnum::ECranePreview_Count };
+
+	/** reachability field in use, a transient one when the assigned field is computed for another crane model */
+	UPROPERTY(Transient)
+	TObjectPtr<UTechnocraneReachabilityField> ActiveReachabilityField;
+	TWeakObjectPtr<UTechnocraneReachabilityField> LastReachabilityField;
+
+	FCraneRigPose Pose;
+};
@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Technocrane s.r.o.
+//
+// https://github.com/technocranes/technocrane-unreal
+//
+// TechnocraneSimulationOutput.h
+// Sergei <Neill3d> Solokhin
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TechnocraneData.h"
+#include <atomic>
+
+/**
+ * The latest simulation output of a crane rig, published by an animation worker thread and read on the game thread.
+ *  There are two slots, a writer fills the slot readers don't point to and then flips the version.
+ *  A per slot sequence lets a reader detect a slot that is overwritten while it's being copied.
+ */
+class FCraneSimulationOutput
+{
+public:
+
+	/** a single writer, called after every crane evaluation */
+	void Publish(const FCraneSimulationData& InData)
+	{
+		const uint32 NextVersion = Version.load(std::memory_order_relaxed) + 1;
+		FSlot& Slot = Slots[NextVersion & 1];
+
+		// odd sequence while the slot is being written
+		Slot.Sequence.store(Slot.Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		Slot.Data = InData;
+
+		Slot.Sequence.store(Slot.Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		Version.store(NextVersion, std::memory_order_release);
+	}
+
+	/**
+	 * copy the latest published output, never blocks the writer
+	 * @return a version of the output, 0 when nothing has been published yet
+	 */
+	uint32 Read(FCraneSimulationData& OutData) const
+	{
+		for (;;)
+		{
+			const uint32 CurrentVersion = Version.load(std::memory_order_acquire);
+			const FSlot& Slot = Slots[CurrentVersion & 1];
+			const uint32 SequenceBefore = Slot.Sequence.load(std::memory_order_acquire);
+
+			if ((SequenceBefore & 1) == 0)
+			{
+				OutData = Slot.Data;
+				std::atomic_thread_fence(std::memory_order_acquire);
+
+				if (Slot.Sequence.load(std::memory_order_relaxed) == SequenceBefore)
+				{
+					return CurrentVersion;
+				}
+			}
+			FPlatformProcess::YieldThread();
+		}
+	}
+
+	uint32 GetVersion() const { return Version.load(std::memory_order_acquire); }
+
+private:
+
+	struct FSlot
+	{
+		std::atomic<uint32> Sequence{ 0 };
+		FCraneSimulationData Data;
+	};
+
+	FSlot Slots[2];
+	std::atomic<uint32> Version{ 0 };
+};
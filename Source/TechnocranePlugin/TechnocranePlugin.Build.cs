@@ -52,7 +52,9 @@ namespace UnrealBuildTool.Rules
                     "LiveLinkInterface",
                     "LiveLinkComponents",
                     "Messaging",
-                    "Networking"
+                    "Networking",
+                    "MovieScene",
+                    "TechnocraneKinematics"
                 }
 			);
 